@@ -1,8 +1,13 @@
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <fstream>
 #include <charconv>
+#include <functional>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "pugixml.hpp"
 
@@ -41,6 +46,613 @@ struct BlockInfo {
     int data[BLOCKSIZE] { 0 };
 };
 
+constexpr char32_t NCPS = 0x110000;
+
+///
+/// Calls body(cp, node) for every code point of repertoire,
+/// including ranges (first-cp/last-cp), reserved etc.
+///
+template <class Body>
+void forEachCp(pugi::xml_node hRepertoire, const Body& body)
+{
+    for (auto hNode : hRepertoire.children()) {
+        std::string_view sCp = hNode.attribute("cp").as_string();
+        if (!sCp.empty()) {
+            body(fromHex(sCp), hNode);
+        } else {
+            auto first = fromHex(hNode.attribute("first-cp").as_string());
+            auto last = fromHex(hNode.attribute("last-cp").as_string());
+            for (auto cp = first; cp <= last; ++cp)
+                body(cp, hNode);
+        }
+    }
+}
+
+template <class T> constexpr std::string_view TYPE_NAME;
+template <> constexpr std::string_view TYPE_NAME<unsigned char> = "unsigned char";
+template <> constexpr std::string_view TYPE_NAME<unsigned short> = "unsigned short";
+
+///
+/// Writes a small-valued property as two-level table:
+///   lookup[cp >> shift] → index of block, blocks[index][cp & mask] → value
+/// Equal blocks are merged; lookup stops at the last block that has
+/// non-default values.
+/// @param [in] values   NCPS values
+///
+template <class T>
+void writeSmallTable(std::ostream& os, std::string_view name, int shift,
+                     const std::vector<T>& values, T deflt)
+{
+    const unsigned blockSize = 1u << shift;
+    const unsigned nLookup = NCPS >> shift;
+    std::vector<std::vector<T>> blocks;
+    std::map<std::vector<T>, unsigned> blockIndex;
+    std::vector<unsigned> lookup;
+    unsigned lastUseful = 0;
+    for (unsigned i = 0; i < nLookup; ++i) {
+        std::vector<T> blk(values.begin() + i * blockSize,
+                           values.begin() + (i + 1) * blockSize);
+        if (std::any_of(blk.begin(), blk.end(),
+                        [deflt](T x) { return x != deflt; }))
+            lastUseful = i + 1;
+        auto [it, isNew] = blockIndex.try_emplace(blk, blocks.size());
+        if (isNew)
+            blocks.push_back(blk);
+        lookup.push_back(it->second);
+    }
+    lookup.resize(lastUseful);
+    if (blocks.size() > 65535)
+        throw std::logic_error("[writeSmallTable] Too many blocks");
+
+    os << "constinit const " << TYPE_NAME<T> << " mojibake::detail::" << name << "Blocks["
+                << blocks.size() << "][" << blockSize << "] = {" "\n";
+    for (auto& blk : blocks) {
+        os << " {";
+        for (size_t j = 0; j < blockSize; ++j) {
+            if (j % 32 == 0 && j != 0) {
+                os << "\n  ";
+            }
+            os << static_cast<unsigned>(blk[j]) << ',';
+        }
+        os << " }," "\n";
+    }
+    os << "};" "\n";
+
+    auto indexType = (blocks.size() <= 256) ? TYPE_NAME<unsigned char> : TYPE_NAME<unsigned short>;
+    os << "constinit const " << indexType << " mojibake::detail::" << name << "Lookup["
+                << lookup.size() << "] {";
+    for (size_t i = 0; i < lookup.size(); ++i) {
+        if (i % 16 == 0)
+            os << "\n ";
+        os << lookup[i] << ",";
+    }
+    os << "\n" "};" "\n";
+    std::cout << name << ": " << blocks.size() << " blocks, "
+              << lookup.size() << " lookup items" << std::endl;
+}
+
+// Grapheme cluster break (according to Unicode 14)
+// Tags and variation selectors (E0000…E0FFF) are the last non-default blocks
+//
+// Block = 5: 258 blocks, 28800 items in lookup table (short)
+//  258·32 + 28800·2 = 65856
+//
+// Block = 6: 208 blocks, 14400 items in lookup table
+//  208·64 + 14400 = 27712
+//
+// Block = 7: 149 blocks, 7200 items in lookup table
+//  149·128 + 7200 = 26272
+//
+// Block = 8: 101 blocks, 3600 items in lookup table
+//  101·256 + 3600 = 29456
+
+constexpr int GCB_BLOCKSHIFT = 7;
+
+// Values MUST match mojibake::detail::Gcb
+const std::map<std::string_view, unsigned char> gcbValues {
+    { "XX", 0 }, { "CR", 1 }, { "LF", 2 }, { "CN", 3 }, { "EX", 4 },
+    { "ZWJ", 5 }, { "RI", 6 }, { "PP", 7 }, { "SM", 8 }, { "L", 9 },
+    { "V", 10 }, { "T", 11 }, { "LV", 12 }, { "LVT", 13 } };
+constexpr unsigned char GCB_EXT_PICT = 14;
+
+void writeGcb(pugi::xml_node hRepertoire)
+{
+    std::cout << "Generating grapheme break table..." << std::flush;
+    std::vector<unsigned char> values(NCPS, 0);
+    forEachCp(hRepertoire, [&values](char32_t cp, pugi::xml_node hNode) {
+        std::string_view sGcb = hNode.attribute("GCB").as_string();
+        auto it = gcbValues.find(sGcb);
+        if (it == gcbValues.end()) {
+            std::string errm = "[writeGcb] Unknown GCB ";
+            errm.append(sGcb);
+            throw std::invalid_argument(errm);
+        }
+        auto v = it->second;
+        if (hNode.attribute("ExtPict").as_string()[0] == 'Y') {
+            // Extended_Pictographic are Other, and we merge them
+            if (v != 0)
+                throw std::logic_error("[writeGcb] Pictographic char is not GCB=XX");
+            v = GCB_EXT_PICT;
+        }
+        values[cp] = v;
+    });
+    std::cout << "OK" << std::endl;
+
+    std::ofstream os("auto_gcb.cpp");
+    os << "// This file is autogenerated!" "\n";
+    os << R"(#include "../internal/auto.hpp")" "\n";
+    writeSmallTable<unsigned char>(os, "gcb", GCB_BLOCKSHIFT, values, 0);
+}
+
+// Display width (according to Unicode 14)
+// Same story, variation selectors E0100…E01EF are zero-width
+//
+// Block = 6: 214 blocks, 14344 items in lookup table
+//  214·64 + 14344 = 28040
+//
+// Block = 7: 152 blocks, 7172 items in lookup table
+//  152·128 + 7172 = 26628
+//
+// Block = 8: 103 blocks, 3586 items in lookup table
+//  103·256 + 3586 = 29954
+
+constexpr int WIDTH_BLOCKSHIFT = 7;
+
+/// @return  0 = zero (marks, format, control), 1 = narrow, 2 = wide
+unsigned char widthOf(pugi::xml_node hNode)
+{
+    std::string_view gc = hNode.attribute("gc").as_string();
+    if (gc == "Mn" || gc == "Me" || gc == "Cc")
+        return 0;
+    if (gc == "Cf")
+        // Soft hyphen is usually drawn
+        return (hNode.attribute("cp").as_string() == std::string_view{"00AD"}) ? 1 : 0;
+    // Hangul medial vowels and final consonants join the syllable
+    std::string_view gcb = hNode.attribute("GCB").as_string();
+    if (gcb == "V" || gcb == "T")
+        return 0;
+    std::string_view ea = hNode.attribute("ea").as_string();
+    if (ea == "W" || ea == "F")
+        return 2;
+    return 1;
+}
+
+void writeWidth(pugi::xml_node hRepertoire)
+{
+    std::cout << "Generating width table..." << std::flush;
+    std::vector<unsigned char> values(NCPS, 1);
+    forEachCp(hRepertoire, [&values](char32_t cp, pugi::xml_node hNode) {
+        values[cp] = widthOf(hNode);
+    });
+    std::cout << "OK" << std::endl;
+
+    std::ofstream os("auto_width.cpp");
+    os << "// This file is autogenerated!" "\n";
+    os << R"(#include "../internal/auto.hpp")" "\n";
+    writeSmallTable<unsigned char>(os, "width", WIDTH_BLOCKSHIFT, values, 1);
+}
+
+// Normalization (according to Unicode 14)
+// Hangul syllables are algorithmic, and not in tables
+//
+// CCC
+//  Block = 5: 128·32 + 3915 = 8011
+//  Block = 6: 111·64 + 1958 = 9062
+//  Block = 7: 90·128 + 979 = 12499
+// Flags
+//  Block = 5: 174·32 + 6097 = 11665
+//  Block = 6: 133·64 + 3049 = 11561
+//  Block = 7: 95·128 + 1525 = 13685
+// Canonical decomposition, 2-byte values
+//  Block = 5: 127·32·2 + 6097 = 14225
+//  Block = 6: 81·64·2 + 3049 = 13417
+//  Block = 7: 55·128·2 + 1525 = 15605
+// Compatibility decomposition, 2-byte values
+//  Block = 5: 279·32·2 + 6097·2 = 30050
+//  Block = 6: 170·64·2 + 3049 = 24809
+//  Block = 7: 105·128·2 + 1525 = 28405
+
+constexpr int CCC_BLOCKSHIFT = 5;
+constexpr int NORMFLAGS_BLOCKSHIFT = 6;
+constexpr int DECOMP_BLOCKSHIFT = 6;
+
+// Quick check flags, MUST match mojibake::detail::NF_XXX
+constexpr unsigned char NF_C_MAYBE = 1;
+constexpr unsigned char NF_C_NO = 2;
+constexpr unsigned char NF_KC_MAYBE = 4;
+constexpr unsigned char NF_KC_NO = 8;
+constexpr unsigned char NF_D_NO = 16;
+constexpr unsigned char NF_KD_NO = 32;
+
+constexpr char32_t HANGUL_FIRST = 0xAC00;
+constexpr char32_t HANGUL_LAST = 0xD7A3;
+
+unsigned char qcFlags(std::string_view qc, unsigned char maybe, unsigned char no)
+{
+    if (qc == "M")
+        return maybe;
+    if (qc == "N")
+        return no;
+    return 0;
+}
+
+std::vector<char32_t> fromHexList(std::string_view x)
+{
+    std::vector<char32_t> r;
+    while (!x.empty()) {
+        auto pos = x.find(' ');
+        r.push_back(fromHex(x.substr(0, pos)));
+        if (pos == std::string_view::npos)
+            break;
+        x = x.substr(pos + 1);
+    }
+    return r;
+}
+
+void writeNorm(pugi::xml_node hRepertoire)
+{
+    std::cout << "Generating normalization tables..." << std::flush;
+    std::vector<unsigned char> ccc(NCPS, 0), flags(NCPS, 0);
+    std::map<char32_t, std::vector<char32_t>> canonMap, compatMap;
+    std::set<char32_t> compEx;
+    forEachCp(hRepertoire,
+              [&](char32_t cp, pugi::xml_node hNode) {
+        ccc[cp] = hNode.attribute("ccc").as_uint();
+        auto& fl = flags[cp];
+        fl |= qcFlags(hNode.attribute("NFC_QC").as_string(), NF_C_MAYBE, NF_C_NO);
+        fl |= qcFlags(hNode.attribute("NFKC_QC").as_string(), NF_KC_MAYBE, NF_KC_NO);
+        std::string_view dt = hNode.attribute("dt").as_string();
+        std::string_view dm = hNode.attribute("dm").as_string();
+        if (dt != "none") {
+            fl |= NF_KD_NO;
+            if (dt == "can")
+                fl |= NF_D_NO;
+        }
+        if (hNode.attribute("Comp_Ex").as_string()[0] == 'Y')
+            compEx.insert(cp);
+        if (dm != "#" && (cp < HANGUL_FIRST || cp > HANGUL_LAST)) {
+            auto& map = (dt == "can") ? canonMap : compatMap;
+            map[cp] = fromHexList(dm);
+        }
+    });
+
+    std::function<void(char32_t, bool, std::vector<char32_t>&)> decompose =
+            [&](char32_t cp, bool isCompat, std::vector<char32_t>& r) {
+        if (cp >= HANGUL_FIRST && cp <= HANGUL_LAST) {
+            auto index = cp - HANGUL_FIRST;
+            r.push_back(0x1100 + index / (21 * 28));
+            r.push_back(0x1161 + (index % (21 * 28)) / 28);
+            if (index % 28 != 0)
+                r.push_back(0x11A7 + index % 28);
+            return;
+        }
+        const std::vector<char32_t>* mapping = nullptr;
+        if (auto it = canonMap.find(cp); it != canonMap.end()) {
+            mapping = &it->second;
+        } else if (auto it = compatMap.find(cp); isCompat && it != compatMap.end()) {
+            mapping = &it->second;
+        }
+        if (!mapping) {
+            r.push_back(cp);
+            return;
+        }
+        for (auto v : *mapping)
+            decompose(v, isCompat, r);
+    };
+
+    // Pool: length, then code points; 0th is “nothing”
+    std::vector<char32_t> pool { 0 };
+    std::map<std::vector<char32_t>, unsigned short> poolIndex;
+    auto addToPool = [&](const std::vector<char32_t>& x) {
+        auto [it, isNew] = poolIndex.try_emplace(x, pool.size());
+        if (isNew) {
+            pool.push_back(x.size());
+            pool.insert(pool.end(), x.begin(), x.end());
+            if (pool.size() > 65535)
+                throw std::logic_error("[writeNorm] Pool is too big");
+        }
+        return it->second;
+    };
+
+    std::vector<unsigned short> canonIndex(NCPS, 0), compatIndex(NCPS, 0);
+    for (char32_t cp = 0; cp < NCPS; ++cp) {
+        if (!canonMap.contains(cp) && !compatMap.contains(cp))
+            continue;
+        std::vector<char32_t> full;
+        if (canonMap.contains(cp)) {
+            decompose(cp, false, full);
+            canonIndex[cp] = addToPool(full);
+            full.clear();
+        }
+        decompose(cp, true, full);
+        compatIndex[cp] = addToPool(full);
+    }
+
+    // Primary composites: canonical pairs, not excluded
+    std::vector<std::array<char32_t, 3>> composites;
+    for (auto& [cp, v] : canonMap) {
+        if (v.size() == 2 && !compEx.contains(cp))
+            composites.push_back({ v[0], v[1], cp });
+    }
+    std::sort(composites.begin(), composites.end());
+    std::cout << "OK" << std::endl;
+
+    std::ofstream os("auto_norm.cpp");
+    os << "// This file is autogenerated!" "\n";
+    os << R"(#include "../internal/auto.hpp")" "\n";
+    writeSmallTable<unsigned char>(os, "ccc", CCC_BLOCKSHIFT, ccc, 0);
+    writeSmallTable<unsigned char>(os, "normFlags", NORMFLAGS_BLOCKSHIFT, flags, 0);
+    writeSmallTable<unsigned short>(os, "canonDecomp", DECOMP_BLOCKSHIFT, canonIndex, 0);
+    writeSmallTable<unsigned short>(os, "compatDecomp", DECOMP_BLOCKSHIFT, compatIndex, 0);
+
+    os << "constinit const char32_t mojibake::detail::normPool["
+                << pool.size() << "] {";
+    for (size_t i = 0; i < pool.size(); ++i) {
+        if (i % 16 == 0)
+            os << "\n ";
+        os << static_cast<unsigned>(pool[i]) << ",";
+    }
+    os << "\n" "};" "\n";
+
+    os << "constinit const mojibake::detail::Composite mojibake::detail::normComposites["
+                << composites.size() << "] {";
+    for (size_t i = 0; i < composites.size(); ++i) {
+        if (i % 4 == 0)
+            os << "\n ";
+        auto& v = composites[i];
+        os << '{' << static_cast<unsigned>(v[0]) << ',' << static_cast<unsigned>(v[1])
+           << ',' << static_cast<unsigned>(v[2]) << "},";
+    }
+    os << "\n" "};" "\n";
+    std::cout << "pool: " << pool.size() << ", composites: " << composites.size() << std::endl;
+}
+
+// Single-byte code pages, from Unicode mapping files
+//   (MAPPINGS/VENDORS/MICSFT/WINDOWS, MAPPINGS/VENDORS/MISC, MAPPINGS/ISO8859)
+// All of them are ASCII-based, so only bytes 80…FF are in tables.
+// Reverse table is shared by all code pages: lookup[page][cp >> shift] → block
+//
+// Block = 5: 62 blocks, 9·302 items in lookup
+//  62·32 + 9·302 = 4702
+//
+// Block = 6: 46 blocks, 9·151 items in lookup
+//  46·64 + 9·151 = 4303
+//
+// Block = 7: 35 blocks, 9·76 items in lookup
+//  35·128 + 9·76 = 5164
+
+constexpr int CODEPAGE_BLOCKSHIFT = 6;
+
+// Frequent non-ASCII chars of languages that use a code page
+// Russian/Ukrainian
+constexpr std::u32string_view DET_CYRILLIC = U"оеаинтсрвлкмдпуяыіїє";
+// French, Spanish, Portuguese, German; ¿¡ are as frequent as letters in Spanish.
+// Not too many: Cyrillic in Western code page gets them all
+constexpr std::u32string_view DET_WESTERN = U"éèàçêôùâœäöüßñáíóúãõ¿¡";
+// Czech, Polish, Hungarian, Romanian
+constexpr std::u32string_view DET_CENTRAL = U"čřžšěůýłąęśćńżőűşţáéíóúöüô";
+
+struct CodePageFile {
+    std::string_view fname;
+    std::u32string_view frequent;   ///< frequent chars of its languages
+};
+
+/// MUST match mojibake::Cp
+constexpr CodePageFile CODEPAGE_FILES[] {
+    { "CP1250.TXT", DET_CENTRAL }, { "CP1251.TXT", DET_CYRILLIC },
+    { "CP1252.TXT", DET_WESTERN }, { "KOI8-R.TXT", DET_CYRILLIC },
+    { "KOI8-U.TXT", DET_CYRILLIC }, { "8859-1.TXT", DET_WESTERN },
+    { "8859-2.TXT", DET_CENTRAL }, { "8859-5.TXT", DET_CYRILLIC },
+    { "8859-15.TXT", DET_WESTERN } };
+
+/// @return  bytes 80…FF → code point, 0 = undefined
+std::array<char32_t, 128> loadCodePage(std::string_view fname)
+{
+    std::ifstream is("codepages/" + std::string{fname});
+    if (!is)
+        throw std::logic_error("Cannot open codepages/" + std::string{fname});
+    std::array<char32_t, 128> r {};
+    std::string line;
+    while (std::getline(is, line)) {
+        std::string_view v = line;
+        if (auto pos = v.find('#'); pos != std::string_view::npos)
+            v = v.substr(0, pos);
+        auto pos1 = v.find_first_of(" \t");
+        if (pos1 == std::string_view::npos)
+            continue;
+        auto sByte = v.substr(0, pos1);
+        auto pos2 = v.find_first_not_of(" \t", pos1);
+        if (pos2 == std::string_view::npos)
+            continue;   // undefined
+        auto sCp = v.substr(pos2, v.find_first_of(" \t", pos2) - pos2);
+        if (!sByte.starts_with("0x") || !sCp.starts_with("0x"))
+            throw std::invalid_argument("[loadCodePage] Bad line " + line);
+        auto byte = fromHex(sByte.substr(2));
+        auto cp = fromHex(sCp.substr(2));
+        if (byte < 0x80) {
+            if (cp != byte)
+                throw std::logic_error("[loadCodePage] Code page is not ASCII-based");
+        } else if (byte <= 0xFF) {
+            r[byte - 0x80] = cp;
+        }
+    }
+    return r;
+}
+
+// Code page detection: weights of bytes 80…FF.
+// Text is mostly lowercase, and frequent letters are even more important
+// DETW_FREQUENT MUST match mojibake::detail::DETECT_MAX_WEIGHT
+constexpr signed char DETW_UNDEFINED = -100;
+constexpr signed char DETW_CONTROL = -50;
+constexpr signed char DETW_FREQUENT = 4;
+constexpr signed char DETW_LOWER = 2;
+constexpr signed char DETW_UPPER = 1;
+
+/// @return  weights of bytes 80…FF for a code page
+/// @param [in] frequent  frequent chars of code page’s own languages:
+///         other letters are not, otherwise ż of CP1250 (¿ of CP1252) wins
+///         over Spanish, and ů (ù) over French
+std::array<signed char, 128> detectWeights(
+        const std::array<char32_t, 128>& page,
+        std::u32string_view frequent,
+        const std::map<char32_t, std::string>& gcs)
+{
+    std::array<signed char, 128> r;
+    for (unsigned i = 0; i < page.size(); ++i) {
+        auto cp = page[i];
+        if (cp == 0) {
+            r[i] = DETW_UNDEFINED;
+            continue;
+        }
+        auto& gc = gcs.at(cp);
+        if (gc == "Cc") {
+            r[i] = DETW_CONTROL;
+        } else if (frequent.find(cp) != std::u32string_view::npos) {
+            r[i] = DETW_FREQUENT;
+        } else if (gc == "Ll") {
+            r[i] = DETW_LOWER;
+        } else if (gc == "Lu" || gc == "Lt") {
+            r[i] = DETW_UPPER;
+        } else {
+            r[i] = 0;
+        }
+    }
+    return r;
+}
+
+void writeCodePages(pugi::xml_node hRepertoire)
+{
+    std::cout << "Generating code pages..." << std::flush;
+    std::vector<std::array<char32_t, 128>> pages;
+    char32_t maxCp = 0;
+    for (auto& file : CODEPAGE_FILES) {
+        auto& page = pages.emplace_back(loadCodePage(file.fname));
+        for (auto cp : page) {
+            if (cp > 0xFFFF)
+                throw std::logic_error("[writeCodePages] Code page out of BMP");
+            maxCp = std::max(maxCp, cp);
+        }
+    }
+    std::cout << "OK" << std::endl;
+
+    const unsigned blockSize = 1u << CODEPAGE_BLOCKSHIFT;
+    const unsigned nLookup = (maxCp >> CODEPAGE_BLOCKSHIFT) + 1;
+    std::vector<std::vector<unsigned char>> blocks;
+    std::map<std::vector<unsigned char>, unsigned> blockIndex;
+    std::vector<std::vector<unsigned>> lookups;
+    for (auto& page : pages) {
+        std::vector<unsigned char> values(nLookup * blockSize, 0);
+        for (unsigned i = 0; i < page.size(); ++i) {
+            if (page[i] != 0)
+                values[page[i]] = i + 0x80;
+        }
+        auto& lookup = lookups.emplace_back();
+        for (unsigned i = 0; i < nLookup; ++i) {
+            std::vector<unsigned char> blk(values.begin() + i * blockSize,
+                                           values.begin() + (i + 1) * blockSize);
+            auto [it, isNew] = blockIndex.try_emplace(blk, blocks.size());
+            if (isNew)
+                blocks.push_back(blk);
+            lookup.push_back(it->second);
+        }
+    }
+    if (blocks.size() > 256)
+        throw std::logic_error("[writeCodePages] Too many blocks");
+
+    std::ofstream os("auto_codepage.cpp");
+    os << "// This file is autogenerated!" "\n";
+    os << R"(#include "../internal/auto.hpp")" "\n";
+
+    os << "constinit const char16_t mojibake::detail::cpToUnicode["
+                << pages.size() << "][128] = {" "\n";
+    for (auto& page : pages) {
+        os << " {";
+        for (size_t j = 0; j < page.size(); ++j) {
+            if (j % 16 == 0 && j != 0) {
+                os << "\n  ";
+            }
+            os << static_cast<unsigned>(page[j]) << ',';
+        }
+        os << " }," "\n";
+    }
+    os << "};" "\n";
+
+    // All 256 bytes in UTF-8: bytes in lower 3 bytes, length in the highest byte
+    os << "constinit const unsigned mojibake::detail::cpToUtf8["
+                << pages.size() << "][256] = {" "\n";
+    for (auto& page : pages) {
+        os << " {";
+        for (unsigned j = 0; j < 256; ++j) {
+            if (j % 8 == 0 && j != 0) {
+                os << "\n  ";
+            }
+            auto cp = (j < 0x80) ? j : page[j - 0x80];
+            unsigned v = 0;
+            if (j < 0x80) {
+                v = (1u << 24) | j;
+            } else if (cp >= 0x800) {
+                v = (3u << 24) | ((0x80 | (cp & 0x3F)) << 16)
+                        | ((0x80 | ((cp >> 6) & 0x3F)) << 8) | (0xE0 | (cp >> 12));
+            } else if (cp != 0) {
+                v = (2u << 24) | ((0x80 | (cp & 0x3F)) << 8) | (0xC0 | (cp >> 6));
+            }
+            os << "0x" << std::hex << v << std::dec << ',';
+        }
+        os << " }," "\n";
+    }
+    os << "};" "\n";
+
+    os << "constinit const unsigned char mojibake::detail::cpFromUnicodeBlocks["
+                << blocks.size() << "][" << blockSize << "] = {" "\n";
+    for (auto& blk : blocks) {
+        os << " {";
+        for (size_t j = 0; j < blockSize; ++j) {
+            if (j % 32 == 0 && j != 0) {
+                os << "\n  ";
+            }
+            os << static_cast<unsigned>(blk[j]) << ',';
+        }
+        os << " }," "\n";
+    }
+    os << "};" "\n";
+
+    os << "constinit const unsigned char mojibake::detail::cpFromUnicodeLookup["
+                << pages.size() << "][" << nLookup << "] = {" "\n";
+    for (auto& lookup : lookups) {
+        os << " {";
+        for (size_t j = 0; j < lookup.size(); ++j) {
+            if (j % 32 == 0 && j != 0) {
+                os << "\n  ";
+            }
+            os << lookup[j] << ',';
+        }
+        os << " }," "\n";
+    }
+    os << "};" "\n";
+    std::cout << "cpFromUnicode: " << blocks.size() << " blocks, "
+              << pages.size() << "·" << nLookup << " lookup items" << std::endl;
+
+    std::map<char32_t, std::string> gcs;
+    forEachCp(hRepertoire, [&gcs](char32_t cp, pugi::xml_node hNode) {
+        if (cp <= 0xFFFF)
+            gcs[cp] = hNode.attribute("gc").as_string();
+    });
+    os << "constinit const signed char mojibake::detail::cpDetectWeights["
+                << pages.size() << "][128] = {" "\n";
+    for (size_t i = 0; i < pages.size(); ++i) {
+        auto weights = detectWeights(pages[i], CODEPAGE_FILES[i].frequent, gcs);
+        os << " {";
+        for (size_t j = 0; j < weights.size(); ++j) {
+            if (j % 32 == 0 && j != 0) {
+                os << "\n  ";
+            }
+            os << static_cast<int>(weights[j]) << ',';
+        }
+        os << " }," "\n";
+    }
+    os << "};" "\n";
+}
+
 int main()
 {
     try {
@@ -138,6 +750,11 @@ int main()
         }
         os.close();
 
+        writeGcb(hRepertoire);
+        writeWidth(hRepertoire);
+        writeNorm(hRepertoire);
+        writeCodePages(hRepertoire);
+
         return 0;
     } catch (const std::exception& e) {
         std::cout << "ERROR: " << e.what() << std::endl;
@@ -15,11 +15,36 @@ SOURCES += \
     ../GoogleTest/src/gtest-all.cc \
     ../GoogleTest/src/gtest_main.cc \
     ../include/cpp/auto_casefold.cpp \
+    ../include/cpp/auto_codepage.cpp \
+    ../include/cpp/auto_gcb.cpp \
+    ../include/cpp/auto_norm.cpp \
+    ../include/cpp/auto_width.cpp \
     test_Mojibake.cpp
 
 HEADERS += \
+    ../include/internal/async.hpp \
     ../include/internal/auto.hpp \
+    ../include/internal/bulk.hpp \
+    ../include/internal/byteorder.hpp \
+    ../include/internal/caseless.hpp \
+    ../include/internal/cesu.hpp \
+    ../include/internal/codepage.hpp \
+    ../include/internal/compare.hpp \
+    ../include/internal/cpindex.hpp \
     ../include/internal/detail2.hpp \
+    ../include/internal/detect.hpp \
+    ../include/internal/escape.hpp \
+    ../include/internal/fdio.hpp \
+    ../include/internal/grapheme.hpp \
+    ../include/internal/hash.hpp \
+    ../include/internal/inplace.hpp \
+    ../include/internal/latin1.hpp \
+    ../include/internal/limited.hpp \
+    ../include/internal/normalize.hpp \
+    ../include/internal/profile.hpp \
+    ../include/internal/simd.hpp \
+    ../include/internal/stream.hpp \
+    ../include/internal/width.hpp \
     ../include/mojibake.h \
     ../include/internal/detail.hpp
 
@@ -4,6 +4,13 @@
 // Google test
 #include "gtest/gtest.h"
 
+// STL
+#include <deque>
+#include <forward_list>
+#include <set>
+#include <span>
+#include <sstream>
+
 using namespace std::string_view_literals;
 
 
@@ -2686,6 +2693,19 @@ TEST (SimpleCaseFold, Container2U32)
 
 ///
 /// Simple workability on const char* → container
+
+///
+/// Case fold to code page: fold that is not in it → code point itself,
+/// code point that is not in it → skipped as bad data
+///
+TEST (SimpleCaseFold, CodePage)
+{
+    std::string_view s = "\u00B5 \u00C4 \u4E2D";
+    std::string r;
+    mojibake::simpleCaseFold<std::string, std::string_view, mojibake::Cp1252>(s, r);
+    EXPECT_EQ("\xB5 \xE4 ", r);
+}
+
 ///
 TEST (SimpleCaseFold, ConstChar)
 {
@@ -3863,3 +3883,2483 @@ TEST(CountCps, WstringPChar)
     EXPECT_TRUE(len == 6 || len == 7);
     EXPECT_EQ(6u, mojibake::countCps(s));
 }
+
+
+///// Grapheme clusters ////////////////////////////////////////////////////////
+
+
+///
+/// ASCII: every char is a cluster, except CR+LF
+///
+TEST (Grapheme, Ascii)
+{
+    std::string_view s = "ab\r\ncd\n\r\t";
+    EXPECT_EQ(9u, mojibake::countCps(s));
+    EXPECT_EQ(8u, mojibake::countGraphemes(s));
+    EXPECT_EQ(s.begin() + 1, mojibake::nextGrapheme(s.begin(), s.end()));
+    EXPECT_EQ(s.begin() + 4, mojibake::nextGrapheme(s.begin() + 2, s.end()));
+    EXPECT_EQ(0u, mojibake::countGraphemes(""sv));
+}
+
+
+///
+/// Combining marks, incl. ASCII + combining
+///
+TEST (Grapheme, Combining)
+{
+    // e + acute, a + ring + dot below, x
+    std::u8string_view s = u8"e\u0301a\u030A\u0323x";
+    EXPECT_EQ(6u, mojibake::countCps(s));
+    EXPECT_EQ(3u, mojibake::countGraphemes(s));
+    EXPECT_EQ(s.begin() + 3, mojibake::nextGrapheme(s.begin(), s.end()));
+}
+
+
+///
+/// Emoji ZWJ sequences: countCps is wrong here
+///
+TEST (Grapheme, EmojiZwj)
+{
+    // man + ZWJ + woman + ZWJ + girl, thumbs up + skin tone, smile
+    std::u16string_view s = u"\U0001F468\u200D\U0001F469\u200D\U0001F467"
+                            u"\U0001F44D\U0001F3FD" u"\U0001F600";
+    EXPECT_EQ(8u, mojibake::countCps(s));
+    EXPECT_EQ(3u, mojibake::countGraphemes(s));
+    // ZWJ without pictograph before → break
+    EXPECT_EQ(2u, mojibake::countGraphemes(U"a\u200D\U0001F467"sv));
+}
+
+
+///
+/// Regional indicators go in pairs
+///
+TEST (Grapheme, Flags)
+{
+    // UA, RU + lone R
+    std::u32string_view s = U"\U0001F1FA\U0001F1E6\U0001F1F7\U0001F1FA\U0001F1F7";
+    EXPECT_EQ(3u, mojibake::countGraphemes(s));
+}
+
+
+///
+/// Hangul jamo: L V T is one syllable, + precomposed LV + T
+///
+TEST (Grapheme, Hangul)
+{
+    std::u32string_view s = U"\u1100\u1161\u11A8" U"\uAC00\u11A8" U"\u1100";
+    EXPECT_EQ(3u, mojibake::countGraphemes(s));
+}
+
+
+///
+/// Bad data is mojibake, and still combines with marks
+///
+TEST (Grapheme, Bad)
+{
+    std::string_view s = "a" "\xD1" "\xCC\x81" "\x80\x80" "b";
+    // a | D1 + combining acute | 80 80 (one bad sequence) | b
+    EXPECT_EQ(4u, mojibake::countGraphemes(s));
+}
+
+
+///
+/// UTF-16 in bytes: ASCII fast path should not break inside unit
+///
+TEST (Grapheme, Utf16Bytes)
+{
+    using It = std::string::const_iterator;
+    std::string le("A\0B\0\r\0\n\0"sv), be("\0A\0B\0\r\0\n"sv);
+    EXPECT_EQ(3u, (mojibake::countGraphemes<It, mojibake::Utf16LE>(le.begin(), le.end())));
+    EXPECT_EQ(3u, (mojibake::countGraphemes<It, mojibake::Utf16BE>(be.begin(), be.end())));
+    EXPECT_EQ(le.begin() + 2, (mojibake::nextGrapheme<It, mojibake::Utf16LE>(le.begin(), le.end())));
+    EXPECT_EQ(be.begin() + 2, (mojibake::nextGrapheme<It, mojibake::Utf16BE>(be.begin(), be.end())));
+    EXPECT_EQ(le.end(), (mojibake::nextGrapheme<It, mojibake::Utf16LE>(le.begin() + 4, le.end())));
+}
+
+
+///
+/// Break iterator
+///
+TEST (Grapheme, Iterator)
+{
+    std::string_view s = "x\u0301\r\n\U0001F44D\U0001F3FD";
+    std::vector<std::string_view> clusters;
+    for (mojibake::GraphemeIterator it(s.begin(), s.end()); !it.isEnd(); ++it)
+        clusters.emplace_back(it.clusterBeg(), it.clusterEnd());
+    ASSERT_EQ(3u, clusters.size());
+    EXPECT_EQ("x\u0301", clusters[0]);
+    EXPECT_EQ("\r\n", clusters[1]);
+    EXPECT_EQ("\U0001F44D\U0001F3FD", clusters[2]);
+}
+
+
+///// Display width ////////////////////////////////////////////////////////////
+
+
+///
+/// Single code points
+///
+TEST (Width, Cp)
+{
+    EXPECT_EQ(1, mojibake::cpWidth('a'));
+    EXPECT_EQ(0, mojibake::cpWidth('\t'));
+    EXPECT_EQ(0, mojibake::cpWidth(0x7F));
+    EXPECT_EQ(1, mojibake::cpWidth(0x00AD));     // soft hyphen
+    EXPECT_EQ(0, mojibake::cpWidth(0x0301));     // combining acute
+    EXPECT_EQ(0, mojibake::cpWidth(0x200B));     // ZWSP
+    EXPECT_EQ(1, mojibake::cpWidth(0x0416));     // Cyrillic Zhe
+    EXPECT_EQ(2, mojibake::cpWidth(0x4E00));     // CJK
+    EXPECT_EQ(2, mojibake::cpWidth(0xFF21));     // fullwidth A
+    EXPECT_EQ(1, mojibake::cpWidth(0xFF61));     // halfwidth ideographic stop
+    EXPECT_EQ(2, mojibake::cpWidth(0xAC00));     // Hangul syllable
+    EXPECT_EQ(0, mojibake::cpWidth(0x1161));     // Hangul medial vowel
+    EXPECT_EQ(2, mojibake::cpWidth(0x1F600));    // emoji
+    EXPECT_EQ(2, mojibake::cpWidth(0x2A6DF));    // CJK ext B
+    EXPECT_EQ(2, mojibake::cpWidth(0x3FFFD));    // plane 3, unassigned
+    EXPECT_EQ(0, mojibake::cpWidth(0xE0100));    // variation selector
+    EXPECT_EQ(1, mojibake::cpWidth(0xF0000));    // private-use
+}
+
+
+///
+/// Long ASCII (SIMD), with controls, + non-ASCII
+///
+TEST (Width, Utf8)
+{
+    std::string_view s = "The quick brown fox\tjumps\r\n over the lazy dog";
+    EXPECT_EQ(s.length() - 3, mojibake::displayWidth(s));
+    std::string_view s2 = "Hello, \u4E16\u754C! e\u0301\U0001F600 \xFF";
+    // 7 + 2·2 + 1 + 2 + 1 + 2 + 1
+    EXPECT_EQ(18u, mojibake::displayWidth(s2));
+    EXPECT_EQ(18u, mojibake::displayWidth(s2.begin(), s2.end()));
+}
+
+
+///
+/// Same for UTF-16 and 32
+///
+TEST (Width, Utf16And32)
+{
+    std::u16string_view s = u"Hello, \u4E16\u754C! e\u0301\U0001F600 abcdefghijklmnopqrstuvwxyz";
+    EXPECT_EQ(43u, mojibake::displayWidth(s));
+    std::u32string_view s2 = U"Hello, \u4E16\u754C! e\u0301\U0001F600 abcdefghijklmnopqrstuvwxyz";
+    EXPECT_EQ(43u, mojibake::displayWidth(s2));
+}
+
+
+///
+/// Truncation
+///
+TEST (Width, Truncate)
+{
+    std::string_view s = "abcdefghijklmnopqrstuvwxyz\u4E16\u754C";
+    EXPECT_EQ(s.begin() + 20, mojibake::truncateWidth(s, 20));
+    EXPECT_EQ(s.begin() + 26, mojibake::truncateWidth(s, 27));
+    EXPECT_EQ(s.begin() + 29, mojibake::truncateWidth(s, 28));
+    EXPECT_EQ(s.end(), mojibake::truncateWidth(s, 100));
+    EXPECT_EQ(s.begin(), mojibake::truncateWidth(s, 0));
+    // Control and combining chars after the cut are kept
+    std::u16string_view s2 = u"a\tbe\u0301\u0302f";
+    EXPECT_EQ(s2.begin() + 6, mojibake::truncateWidth(s2, 3));
+}
+
+
+///// Normalization ////////////////////////////////////////////////////////////
+
+using mojibake::Nf;
+using mojibake::Qc;
+
+
+///
+/// Simple composition/decomposition
+///
+TEST (Normalize, Simple)
+{
+    std::u8string_view composed = u8"Caf\u00E9";
+    std::u8string_view decomposed = u8"Cafe\u0301";
+    EXPECT_EQ(composed, (mojibake::normalizeM<Nf::NFC, std::u8string>(decomposed)));
+    EXPECT_EQ(composed, (mojibake::normalizeM<Nf::NFC, std::u8string>(composed)));
+    EXPECT_EQ(decomposed, (mojibake::normalizeM<Nf::NFD, std::u8string>(composed)));
+    EXPECT_EQ(decomposed, (mojibake::normalizeM<Nf::NFD, std::u8string>(decomposed)));
+    // Other encoding
+    EXPECT_EQ(u"Caf\u00E9", (mojibake::normalizeM<Nf::NFC, std::u16string>(decomposed)));
+}
+
+
+///
+/// Canonical ordering: dot below (220) goes before circumflex (230)
+///
+TEST (Normalize, Order)
+{
+    std::u32string_view s1 = U"a\u0323\u0302";
+    std::u32string_view s2 = U"a\u0302\u0323";
+    EXPECT_EQ(U"\u1EAD", (mojibake::normalizeM<Nf::NFC, std::u32string>(s1)));
+    EXPECT_EQ(U"\u1EAD", (mojibake::normalizeM<Nf::NFC, std::u32string>(s2)));
+    EXPECT_EQ(U"a\u0323\u0302", (mojibake::normalizeM<Nf::NFD, std::u32string>(s2)));
+    // Blocked: grave after another acute (same class)
+    EXPECT_EQ(U"\u00E9\u0300", (mojibake::normalizeM<Nf::NFC, std::u32string>(U"e\u0301\u0300"sv)));
+}
+
+
+///
+/// Singletons, exclusions, Hangul
+///
+TEST (Normalize, Special)
+{
+    // Angstrom sign → A with ring
+    EXPECT_EQ(U"\u00C5", (mojibake::normalizeM<Nf::NFC, std::u32string>(U"\u212B"sv)));
+    // Devanagari qa is excluded from composition
+    EXPECT_EQ(U"\u0915\u093C", (mojibake::normalizeM<Nf::NFC, std::u32string>(U"\u0958"sv)));
+    // Hangul: LVT, LV + T, + lone T
+    EXPECT_EQ(U"\uAC01\uAC01\u11A8", (mojibake::normalizeM<Nf::NFC, std::u32string>(U"\u1100\u1161\u11A8\uAC00\u11A8\u11A8"sv)));
+    EXPECT_EQ(U"\u1100\u1161\u11A8", (mojibake::normalizeM<Nf::NFD, std::u32string>(U"\uAC01"sv)));
+}
+
+
+///
+/// Compatibility forms
+///
+TEST (Normalize, Compat)
+{
+    std::u16string_view s = u"\uFB01x\u00B2 \u2460\u212B";
+    EXPECT_EQ(u"fix2 1\u00C5", (mojibake::normalizeM<Nf::NFKC, std::u16string>(s)));
+    EXPECT_EQ(u"fix2 1A\u030A", (mojibake::normalizeM<Nf::NFKD, std::u16string>(s)));
+    EXPECT_EQ(u"\uFB01x\u00B2 \u2460\u00C5", (mojibake::normalizeM<Nf::NFC, std::u16string>(s)));
+}
+
+
+///
+/// Bad data follows mojibake handlers
+///
+TEST (Normalize, Bad)
+{
+    std::string_view s = "e\xCC" "\x81" "\xFF" "e";
+    EXPECT_EQ("\u00E9" "\uFFFD" "e", (mojibake::normalizeM<Nf::NFC, std::string>(s)));
+    using Sk = mojibake::handler::Skip<std::string_view::const_iterator>;
+    EXPECT_EQ("\u00E9e", (mojibake::normalize<Nf::NFC, std::string>(s, Sk{})));
+    // Mojibake is a starter, and blocks
+    std::string_view s2 = "e\xFF\xCC\x81";
+    EXPECT_EQ("e\uFFFD\u0301", (mojibake::normalizeM<Nf::NFC, std::string>(s2)));
+}
+
+
+///
+/// Code page: what is not in it goes to handler as CODE, like in copy
+///
+TEST (Normalize, CodePage)
+{
+    using It = std::string_view::const_iterator;
+    std::string_view s = "e\u0301 \u4E2D x\xFF";
+    std::vector<std::pair<size_t, mojibake::Event>> events;
+    auto onMojibake = [&events, &s](It place, mojibake::Event event) {
+        events.emplace_back(place - s.begin(), event);
+        return U'\uFFFD';
+    };
+    EXPECT_EQ("\xE9 ? x?", (mojibake::normalize<Nf::NFC, std::string, std::string_view,
+                         decltype(onMojibake), mojibake::Cp1252>(s, onMojibake)));
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ(4u, events[0].first);
+    EXPECT_EQ(mojibake::Event::CODE, events[0].second);
+    EXPECT_EQ(9u, events[1].first);
+    EXPECT_EQ(mojibake::Event::BYTE_START, events[1].second);
+
+    using Sk = mojibake::handler::Skip<It>;
+    using Mh = mojibake::handler::MojiHalt<It>;
+    EXPECT_EQ("\xE9  x", (mojibake::normalize<Nf::NFC, std::string, std::string_view,
+                         Sk, mojibake::Cp1252>(s)));
+    EXPECT_EQ("\xE9 ?", (mojibake::normalize<Nf::NFC, std::string, std::string_view,
+                         Mh, mojibake::Cp1252>(s)));
+    // Same as copy
+    EXPECT_EQ((mojibake::to<std::string, std::string_view, Sk, mojibake::Cp1251>(
+                    std::string_view("\u0416 \u4E2D x"))),
+              (mojibake::normalize<Nf::NFC, std::string, std::string_view, Sk,
+                    mojibake::Cp1251>(std::string_view("\u0416 \u4E2D x"))));
+}
+
+
+///
+/// Quick check
+///
+TEST (Normalize, QuickCheck)
+{
+    std::string_view ascii = "The quick brown fox jumps over the lazy dog";
+    EXPECT_EQ(Qc::YES, mojibake::quickCheck<Nf::NFC>(ascii));
+    EXPECT_EQ(Qc::YES, mojibake::quickCheck<Nf::NFKD>(ascii));
+    EXPECT_EQ(Qc::YES, mojibake::quickCheck<Nf::NFC>(u8"Caf\u00E9"sv));
+    EXPECT_EQ(Qc::NO,  mojibake::quickCheck<Nf::NFD>(u8"Caf\u00E9"sv));
+    EXPECT_EQ(Qc::MAYBE, mojibake::quickCheck<Nf::NFC>(u8"Cafe\u0301"sv));
+    EXPECT_EQ(Qc::YES, mojibake::quickCheck<Nf::NFD>(u8"Cafe\u0301"sv));
+    EXPECT_EQ(Qc::NO,  mojibake::quickCheck<Nf::NFD>(u"\u1EAD"sv));
+    EXPECT_EQ(Qc::NO,  mojibake::quickCheck<Nf::NFC>("abc\xFF"sv));
+    EXPECT_EQ(Qc::NO,  mojibake::quickCheck<Nf::NFKC>(U"\uFB01"sv));
+
+    EXPECT_TRUE (mojibake::isNormalized<Nf::NFC>(u8"\u00E9\u0301"sv));
+    EXPECT_FALSE(mojibake::isNormalized<Nf::NFC>(u8"e\u0301"sv));
+    EXPECT_TRUE (mojibake::isNormalized<Nf::NFC>(ascii));
+}
+
+
+///
+/// Zero copy if normalized
+///
+TEST (Normalize, NormString)
+{
+    std::string_view s = "Caf\u00E9 au lait";
+    mojibake::NormString<Nf::NFC, char> q1(s);
+    EXPECT_FALSE(q1.isConverted());
+    EXPECT_EQ(s.data(), q1.data());
+
+    // MAYBE, but normalized
+    std::string_view s2 = "\u00E9\u0301";
+    mojibake::NormString<Nf::NFC, char> q2(s2);
+    EXPECT_FALSE(q2.isConverted());
+    EXPECT_EQ(s2.data(), q2.data());
+
+    std::string_view s3 = "Cafe\u0301 au lait";
+    mojibake::NormString<Nf::NFC, char> q3(s3);
+    EXPECT_TRUE(q3.isConverted());
+    EXPECT_EQ(s, q3.sv());
+    auto q4 = q3;
+    EXPECT_EQ(s, q4.sv());
+}
+
+
+///// Code pages ///////////////////////////////////////////////////////////////
+
+
+///
+/// Decoding several code pages
+///
+TEST (CodePage, Decode)
+{
+    std::u16string_view expected = u"\u041F\u0440\u0438\u0432\u0435\u0442, \u043C\u0438\u0440";
+    std::string_view s1251 = "\xCF\xF0\xE8\xE2\xE5\xF2, \xEC\xE8\xF0";
+    std::string_view sKoi = "\xF0\xD2\xC9\xD7\xC5\xD4, \xCD\xC9\xD2";
+    std::string_view sIso = "\xBF\xE0\xD8\xD2\xD5\xE2, \xDC\xD8\xE0";
+    EXPECT_EQ(expected, (mojibake::toM<std::u16string, std::string_view,
+                         mojibake::Utf16, mojibake::Cp1251>(s1251)));
+    EXPECT_EQ(expected, (mojibake::toM<std::u16string, std::string_view,
+                         mojibake::Utf16, mojibake::Koi8r>(sKoi)));
+    EXPECT_EQ(expected, (mojibake::toM<std::u16string, std::string_view,
+                         mojibake::Utf16, mojibake::Iso8859_5>(sIso)));
+    EXPECT_EQ(u8"\u20AC caf\u00E9", (mojibake::toM<std::u8string, std::string_view,
+                         mojibake::Utf8, mojibake::Cp1252>("\x80 caf\xE9"sv)));
+    EXPECT_EQ(11u, (mojibake::countCps<std::string_view, mojibake::Cp1251>(s1251)));
+    EXPECT_TRUE((mojibake::isValid<std::string_view, mojibake::Cp1251>(s1251)));
+}
+
+
+///
+/// Undefined bytes
+///
+TEST (CodePage, DecodeBad)
+{
+    // 98 is undefined in CP1251
+    std::string_view s = "a\x98\xE1";
+    using It = std::string_view::const_iterator;
+    using Sk = mojibake::handler::Skip<It>;
+    EXPECT_EQ(U"a\uFFFD\u0431", (mojibake::toM<std::u32string, std::string_view,
+                         mojibake::Utf32, mojibake::Cp1251>(s)));
+    EXPECT_EQ(U"a\u0431", (mojibake::to<std::u32string, std::string_view, Sk,
+                         mojibake::Utf32, mojibake::Cp1251>(s)));
+    EXPECT_EQ(2u, (mojibake::countCps<std::string_view, mojibake::Cp1251>(s)));
+    EXPECT_FALSE((mojibake::isValid<std::string_view, mojibake::Cp1251>(s)));
+
+    std::vector<std::pair<size_t, mojibake::Event>> events;
+    auto onMojibake = [&events, &s](It place, mojibake::Event event) {
+        events.emplace_back(place - s.begin(), event);
+        return mojibake::handler::RET_SKIP;
+    };
+    mojibake::to<std::u32string, std::string_view, decltype(onMojibake),
+                 mojibake::Utf32, mojibake::Cp1251>(s, onMojibake);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(1u, events[0].first);
+    EXPECT_EQ(mojibake::Event::CODE, events[0].second);
+}
+
+
+///
+/// Encoding, incl. code points that are not in code page
+///
+TEST (CodePage, Encode)
+{
+    std::string_view s = "\u041F\u0440\u0438\u0432\u0435\u0442, \u043C\u0438\u0440 \u20AC";
+    std::string_view s2 = "\u041F\u0440\u0438\u0432\u0435\u0442, \u4E2D \u043C\u0438\u0440 \u20AC";
+    using It = std::string_view::const_iterator;
+    using Sk = mojibake::handler::Skip<It>;
+    using Mh = mojibake::handler::MojiHalt<It>;
+    std::string_view expected = "\xCF\xF0\xE8\xE2\xE5\xF2, \xEC\xE8\xF0 \x88";
+    EXPECT_EQ(expected, (mojibake::toM<std::string, std::string_view,
+                         mojibake::Cp1251, mojibake::Utf8>(s)));
+    EXPECT_EQ("\xF0\xD2\xC9\xD7\xC5\xD4, \xCD\xC9\xD2 ?",
+              (mojibake::toM<std::string, std::string_view,
+                         mojibake::Koi8r, mojibake::Utf8>(s)));
+    // Skip
+    EXPECT_EQ("\xCF\xF0\xE8\xE2\xE5\xF2,  \xEC\xE8\xF0 \x88",
+              (mojibake::to<std::string, std::string_view, Sk,
+                         mojibake::Cp1251, mojibake::Utf8>(s2)));
+    // Mojibake in code page is ?
+    EXPECT_EQ("\xCF\xF0\xE8\xE2\xE5\xF2, ? \xEC\xE8\xF0 \x88",
+              (mojibake::toM<std::string, std::string_view,
+                         mojibake::Cp1251, mojibake::Utf8>(s2)));
+    EXPECT_EQ("\xCF\xF0\xE8\xE2\xE5\xF2, ?",
+              (mojibake::to<std::string, std::string_view, Mh,
+                         mojibake::Cp1251, mojibake::Utf8>(s2)));
+
+    // Bad UTF-8 and unmappable: handler is called once for each
+    std::string_view s3 = "a\xFF" "b\u4E2D";
+    std::vector<std::pair<size_t, mojibake::Event>> events;
+    auto onMojibake = [&events, &s3](It place, mojibake::Event event) {
+        events.emplace_back(place - s3.begin(), event);
+        return U'\uFFFD';
+    };
+    EXPECT_EQ("a?b?", (mojibake::to<std::string, std::string_view, decltype(onMojibake),
+                         mojibake::Cp1251, mojibake::Utf8>(s3, onMojibake)));
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ(1u, events[0].first);
+    EXPECT_EQ(mojibake::Event::BYTE_START, events[0].second);
+    EXPECT_EQ(3u, events[1].first);
+    EXPECT_EQ(mojibake::Event::CODE, events[1].second);
+}
+
+
+///
+/// Limited buffer
+///
+TEST (CodePage, Limited)
+{
+    std::u32string_view s = U"\u041F\u0440\u0438\u0432\u0435\u0442";
+    char buf[4];
+    auto end = mojibake::copyLim<mojibake::handler::Skip<std::u32string_view::const_iterator>,
+                std::u32string_view, char*, mojibake::Utf32, mojibake::Cp1251>(s, buf, std::size(buf));
+    EXPECT_EQ("\xCF\xF0\xE8\xE2", std::string_view(buf, end - buf));
+}
+
+
+///
+/// All defined bytes of all code pages survive the round trip
+///
+TEST (CodePage, RoundTrip)
+{
+    auto check = [](auto enc) {
+        using Enc = decltype(enc);
+        std::string all;
+        for (unsigned i = 0; i < 256; ++i)
+            all.push_back(i);
+        auto u8 = mojibake::toS<std::string, std::string, mojibake::Utf8, Enc>(all);
+        auto nCps = mojibake::countCps<std::string, Enc>(all);
+        EXPECT_EQ(nCps, mojibake::countCps(u8));
+        auto back = mojibake::toM<std::string, std::string, Enc, mojibake::Utf8>(u8);
+        EXPECT_EQ(nCps, back.length());
+        EXPECT_TRUE((mojibake::isValid<std::string, Enc>(back)));
+        std::string expected;
+        std::copy_if(all.begin(), all.end(), std::back_inserter(expected),
+            [](char c) {
+                std::string_view sv(&c, 1);
+                return mojibake::isValid<std::string_view, Enc>(sv);
+            });
+        EXPECT_EQ(expected, back);
+    };
+    check(mojibake::Cp1250{});
+    check(mojibake::Cp1251{});
+    check(mojibake::Cp1252{});
+    check(mojibake::Koi8r{});
+    check(mojibake::Koi8u{});
+    check(mojibake::Iso8859_1{});
+    check(mojibake::Iso8859_2{});
+    check(mojibake::Iso8859_5{});
+    check(mojibake::Iso8859_15{});
+}
+
+
+///
+/// ConvString with code pages
+///
+TEST (CodePage, ConvString)
+{
+    std::string_view s = "\xCF\xF0\xE8\xE2\xE5\xF2";
+    using Conv = mojibake::ConvString<char, char, mojibake::Utf8, mojibake::Cp1251>;
+    static_assert(Conv::isConverted());
+    Conv q(s);
+    EXPECT_EQ("\u041F\u0440\u0438\u0432\u0435\u0442", q.sv());
+
+    using Conv2 = mojibake::ConvString<char, char, mojibake::Cp1251, mojibake::Cp1251>;
+    static_assert(Conv2::isStringView());
+    Conv2 q2(s);
+    EXPECT_EQ(s.data(), q2.data());
+}
+
+
+///
+/// Block kernel code page → UTF-8 gives the same as per-byte way
+///
+TEST (CodePage, ToUtf8Kernel)
+{
+    // Long runs of ASCII and high bytes, and undefined 98
+    std::string s;
+    for (unsigned i = 0; i < 300; ++i) {
+        s.push_back(static_cast<char>(i % 256));
+        if (i % 7 == 0)
+            s.append("Some longer ASCII run, longer than SIMD register");
+        if (i % 11 == 0)
+            s.append("\xCF\xF0\xE8\xE2\xE5\xF2\xCF\xF0\xE8\xE2\xE5\xF2\xCF\xF0\xE8\xE2\xE5\xF2");
+    }
+    std::deque<char> d(s.begin(), s.end());     // per-byte way
+    auto expected = mojibake::toM<std::string, std::deque<char>,
+                        mojibake::Utf8, mojibake::Cp1251>(d);
+    auto r = mojibake::toM<std::string, std::string,
+                        mojibake::Utf8, mojibake::Cp1251>(s);
+    EXPECT_EQ(expected, r);
+    EXPECT_EQ(s.length(), mojibake::countCps(r));   // undefined 98 → U+FFFD
+    EXPECT_EQ(r, (mojibake::toM<std::string, std::u32string, mojibake::Utf8, mojibake::Utf32>(
+                        mojibake::toM<std::u32string, std::string, mojibake::Utf32, mojibake::Cp1251>(s))));
+
+    // Skip, pointer output
+    using Sk = mojibake::handler::Skip<std::string::const_iterator>;
+    std::vector<char> buf(s.length() * 3);
+    auto end = mojibake::copy<mojibake::Cp1251, mojibake::Utf8, Sk>(
+                        s.cbegin(), s.cend(), buf.data());
+    auto expectedS = mojibake::toS<std::string, std::deque<char>,
+                        mojibake::Utf8, mojibake::Cp1251>(d);
+    EXPECT_EQ(expectedS, std::string_view(buf.data(), end));
+
+    // Unsigned char units go the same way
+    std::vector<unsigned char> u(s.begin(), s.end());
+    EXPECT_EQ(expected, (mojibake::toM<std::string, std::vector<unsigned char>,
+                        mojibake::Utf8, mojibake::Cp1251>(u)));
+
+    // 3-byte sequences: € and ™
+    EXPECT_EQ("\u20AC\u2026\u2122", (mojibake::toM<std::string, std::string_view,
+                        mojibake::Utf8, mojibake::Cp1252>("\x80\x85\x99"sv)));
+}
+
+
+///// Encoding detection ///////////////////////////////////////////////////////
+
+namespace {
+
+    const std::string_view TEXT_RU =
+            "\u0421\u044A\u0435\u0448\u044C \u0436\u0435 \u0435\u0449\u0451 \u044D\u0442\u0438\u0445 \u043C\u044F\u0433\u043A\u0438\u0445 \u0444\u0440\u0430\u043D\u0446\u0443\u0437\u0441\u043A\u0438\u0445 \u0431\u0443\u043B\u043E\u043A, \u0434\u0430 \u0432\u044B\u043F\u0435\u0439 \u0447\u0430\u044E. "
+            "\u0428\u0438\u0440\u043E\u043A\u0430\u044F \u044D\u043B\u0435\u043A\u0442\u0440\u0438\u0444\u0438\u043A\u0430\u0446\u0438\u044F \u044E\u0436\u043D\u044B\u0445 \u0433\u0443\u0431\u0435\u0440\u043D\u0438\u0439 \u0434\u0430\u0441\u0442 \u043C\u043E\u0449\u043D\u044B\u0439 \u0442\u043E\u043B\u0447\u043E\u043A "
+            "\u043F\u043E\u0434\u044A\u0451\u043C\u0443 \u0441\u0435\u043B\u044C\u0441\u043A\u043E\u0433\u043E \u0445\u043E\u0437\u044F\u0439\u0441\u0442\u0432\u0430.";
+    const std::string_view TEXT_FR =
+            "Voix ambigu\u00EB d'un c\u0153ur qui, au z\u00E9phyr, pr\u00E9f\u00E8re les jattes de kiwis. "
+            "Le c\u0153ur d\u00E9\u00E7u mais l'\u00E2me plut\u00F4t na\u00EFve, Lou\u00FFs r\u00EAva de crapa\u00FCter "
+            "en cano\u00EB au del\u00E0 des \u00EEles.";
+    const std::string_view TEXT_CZ =
+            "P\u0159\u00EDli\u0161 \u017Elu\u0165ou\u010Dk\u00FD k\u016F\u0148 \u00FAp\u011Bl \u010F\u00E1belsk\u00E9 \u00F3dy. Za\u017C\u00F3\u0142\u0107 g\u0119\u015Bl\u0105 ja\u017A\u0144, "
+            "pchn\u0105\u0107 w t\u0119 \u0142\u00F3d\u017A je\u017Ca lub o\u015Bm skrzy\u0144 fig.";
+    /// Plain prose, no pangram: letters as frequent as in real text
+    const std::string_view TEXT_FR_PROSE =
+            "Il \u00E9tait une fois une petite fille qui vivait dans un village pr\u00E8s de la for\u00EAt. "
+            "Un matin, sa m\u00E8re lui demanda de porter une galette \u00E0 sa grand-m\u00E8re, qui \u00E9tait malade. "
+            "O\u00F9 vas-tu, mon enfant ? Je vais chez ma grand-m\u00E8re, r\u00E9pondit-elle, l\u00E0-bas, derri\u00E8re le moulin.";
+    const std::string_view TEXT_ES =
+            "En un lugar de la Mancha, de cuyo nombre no quiero acordarme, no ha mucho tiempo que viv\u00EDa "
+            "un hidalgo de los de lanza en astillero, adarga antigua, roc\u00EDn flaco y galgo corredor. "
+            "Duelos y quebrantos los s\u00E1bados, alg\u00FAn palomino de a\u00F1adidura los domingos. \u00BFQu\u00E9 m\u00E1s pod\u00EDa pedir?";
+
+    template <class Enc>
+    std::string encode(std::string_view x)
+        { return mojibake::toM<std::string, std::string_view, Enc, mojibake::Utf8>(x); }
+
+    /// @return  UTF-16 as bytes
+    std::string toUtf16Bytes(std::string_view x, bool isBigEndian)
+    {
+        std::string r;
+        for (auto c : mojibake::toM<std::u16string>(x)) {
+            char lo = static_cast<char>(c & 0xFF), hi = static_cast<char>(c >> 8);
+            r.push_back(isBigEndian ? hi : lo);
+            r.push_back(isBigEndian ? lo : hi);
+        }
+        return r;
+    }
+
+}   // anon namespace
+
+
+///
+/// Byte order marks
+///
+TEST (Detect, Bom)
+{
+    auto d = mojibake::detect("\xEF\xBB\xBF" "abc"sv);
+    EXPECT_EQ(mojibake::Charset::UTF8, d.charset);
+    EXPECT_EQ(3, d.bomSize);
+    EXPECT_EQ(100, d.confidence);
+
+    d = mojibake::detect("\xFF\xFE" "a\0"sv);
+    EXPECT_EQ(mojibake::Charset::UTF16LE, d.charset);
+    EXPECT_EQ(2, d.bomSize);
+    d = mojibake::detect("\xFE\xFF" "\0a"sv);
+    EXPECT_EQ(mojibake::Charset::UTF16BE, d.charset);
+    d = mojibake::detect("\xFF\xFE\0\0" "a\0\0\0"sv);
+    EXPECT_EQ(mojibake::Charset::UTF32LE, d.charset);
+    EXPECT_EQ(4, d.bomSize);
+    d = mojibake::detect("\0\0\xFE\xFF" "\0\0\0a"sv);
+    EXPECT_EQ(mojibake::Charset::UTF32BE, d.charset);
+}
+
+
+///
+/// UTF-16/32 w/o BOM
+///
+TEST (Detect, Wide)
+{
+    auto d = mojibake::detect(toUtf16Bytes(TEXT_RU, false));
+    EXPECT_EQ(mojibake::Charset::UTF16LE, d.charset);
+    EXPECT_EQ(0, d.bomSize);
+    EXPECT_GT(d.confidence, 50);
+    d = mojibake::detect(toUtf16Bytes(TEXT_RU, true));
+    EXPECT_EQ(mojibake::Charset::UTF16BE, d.charset);
+    d = mojibake::detect(toUtf16Bytes(TEXT_FR, false));
+    EXPECT_EQ(mojibake::Charset::UTF16LE, d.charset);
+
+    std::string s32;
+    for (auto c : mojibake::toM<std::u32string>(TEXT_FR)) {
+        for (int i = 0; i < 4; ++i)
+            s32.push_back(static_cast<char>(c >> (i * 8)));
+    }
+    d = mojibake::detect(s32);
+    EXPECT_EQ(mojibake::Charset::UTF32LE, d.charset);
+
+    // Binary
+    d = mojibake::detect("\x01\x00\x00\x97\xFF\x00\x10\x00\x00\x00\x12\x34\x56\x00\x00\x00"sv);
+    EXPECT_EQ(mojibake::Charset::UNKNOWN, d.charset);
+}
+
+
+///
+/// UTF-8 and ASCII
+///
+TEST (Detect, Utf8)
+{
+    auto d = mojibake::detect("The quick brown fox jumps over the lazy dog"sv);
+    EXPECT_EQ(mojibake::Charset::UTF8, d.charset);
+    EXPECT_EQ(100, d.confidence);
+
+    d = mojibake::detect(TEXT_RU);
+    EXPECT_EQ(mojibake::Charset::UTF8, d.charset);
+    EXPECT_EQ(100, d.confidence);
+
+    // Prefix cuts sequence: still UTF-8
+    d = mojibake::detect(TEXT_RU, 5);
+    EXPECT_EQ(mojibake::Charset::UTF8, d.charset);
+
+    // Bad data after prefix: not seen
+    std::string s(TEXT_FR);
+    s += "\xFF\xFF";
+    d = mojibake::detect(s, TEXT_FR.length());
+    EXPECT_EQ(mojibake::Charset::UTF8, d.charset);
+    d = mojibake::detect(s);
+    EXPECT_NE(mojibake::Charset::UTF8, d.charset);
+}
+
+
+///
+/// Single-byte code pages
+///
+TEST (Detect, CodePage)
+{
+    auto check = [](std::string_view text, auto enc) {
+        using Enc = decltype(enc);
+        auto d = mojibake::detect(encode<Enc>(text));
+        EXPECT_EQ(mojibake::Charset::CODE_PAGE, d.charset);
+        EXPECT_EQ(Enc::id, d.codePage);
+        EXPECT_EQ(0, d.bomSize);
+        EXPECT_GT(d.confidence, 20);
+    };
+    check(TEXT_RU, mojibake::Cp1251{});
+    check(TEXT_RU, mojibake::Koi8r{});
+    check(TEXT_RU, mojibake::Iso8859_5{});
+    check(TEXT_FR, mojibake::Cp1252{});
+    check(TEXT_FR_PROSE, mojibake::Cp1252{});
+    check(TEXT_ES, mojibake::Cp1252{});
+    check(TEXT_CZ, mojibake::Cp1250{});
+    check(TEXT_CZ, mojibake::Iso8859_2{});
+}
+
+
+///// UTF-16/32 of some byte order /////////////////////////////////////////////
+
+namespace {
+
+    /// @return  UTF-32 as bytes
+    std::string toUtf32Bytes(std::string_view x, bool isBigEndian)
+    {
+        std::string r;
+        for (auto c : mojibake::toM<std::u32string>(x)) {
+            for (int i = 0; i < 4; ++i)
+                r.push_back(static_cast<char>(c >> ((isBigEndian ? 3 - i : i) * 8)));
+        }
+        return r;
+    }
+
+    const std::string_view TEXT_MIXED =
+            "The quick brown fox jumps over the lazy dog. "
+            "\u0421\u044A\u0435\u0448\u044C \u0436\u0435 \u0435\u0449\u0451 \u044D\u0442\u0438\u0445 \u043C\u044F\u0433\u043A\u0438\u0445 \u0431\u0443\u043B\u043E\u043A \U0001F600 \u0434\u0430 \u0432\u044B\u043F\u0435\u0439 \U0001D11E \u0447\u0430\u044E.";
+
+}   // anon namespace
+
+
+///
+/// Decoding long text: both blocks and tail
+///
+TEST (ByteOrder, Decode)
+{
+    for (auto text : { TEXT_MIXED, TEXT_RU, TEXT_CZ }) {
+        auto be = toUtf16Bytes(text, true);
+        auto le = toUtf16Bytes(text, false);
+        EXPECT_EQ(text, (mojibake::toM<std::string, std::string, mojibake::Utf8, mojibake::Utf16BE>(be)));
+        EXPECT_EQ(text, (mojibake::toM<std::string, std::string, mojibake::Utf8, mojibake::Utf16LE>(le)));
+        EXPECT_EQ(mojibake::toM<std::u16string>(text),
+                  (mojibake::toM<std::u16string, std::string, mojibake::Utf16, mojibake::Utf16BE>(be)));
+        auto be32 = toUtf32Bytes(text, true);
+        auto le32 = toUtf32Bytes(text, false);
+        EXPECT_EQ(text, (mojibake::toM<std::string, std::string, mojibake::Utf8, mojibake::Utf32BE>(be32)));
+        EXPECT_EQ(text, (mojibake::toM<std::string, std::string, mojibake::Utf8, mojibake::Utf32LE>(le32)));
+        EXPECT_EQ(mojibake::toM<std::u32string>(text),
+                  (mojibake::toM<std::u32string, std::string, mojibake::Utf32, mojibake::Utf32LE>(le32)));
+
+        auto nCps = mojibake::countCps(text);
+        EXPECT_EQ(nCps, (mojibake::countCps<std::string, mojibake::Utf16BE>(be)));
+        EXPECT_EQ(nCps, (mojibake::countCps<std::string, mojibake::Utf32LE>(le32)));
+        EXPECT_TRUE((mojibake::isValid<std::string, mojibake::Utf16LE>(le)));
+        EXPECT_TRUE((mojibake::isValid<std::string, mojibake::Utf32BE>(be32)));
+    }
+}
+
+
+///
+/// std::byte buffers, unaligned data
+///
+TEST (ByteOrder, Bytes)
+{
+    auto s = toUtf16Bytes(TEXT_MIXED, true);
+    std::vector<std::byte> bytes(s.length() + 1);
+    std::transform(s.begin(), s.end(), bytes.begin() + 1,
+                   [](char c) { return static_cast<std::byte>(c); });
+    std::span<const std::byte> unaligned(bytes.data() + 1, s.length());
+    EXPECT_EQ(TEXT_MIXED, (mojibake::toM<std::string, std::span<const std::byte>,
+                           mojibake::Utf8, mojibake::Utf16BE>(unaligned)));
+
+    // Writing
+    auto r = mojibake::toM<std::vector<std::byte>, std::string_view,
+                           mojibake::Utf16BE, mojibake::Utf8>(TEXT_MIXED);
+    EXPECT_TRUE(std::equal(r.begin(), r.end(), unaligned.begin(), unaligned.end()));
+    EXPECT_EQ(toUtf32Bytes(TEXT_MIXED, false),
+              (mojibake::toM<std::string, std::string_view, mojibake::Utf32LE, mojibake::Utf8>(TEXT_MIXED)));
+}
+
+
+///
+/// Bad data, including incomplete units
+///
+TEST (ByteOrder, Bad)
+{
+    // Odd # of bytes
+    std::string_view s1 = "\x00" "a" "\x04"sv;
+    EXPECT_EQ(u"a\uFFFD", (mojibake::toM<std::u16string, std::string_view,
+                           mojibake::Utf16, mojibake::Utf16BE>(s1)));
+    EXPECT_EQ(1u, (mojibake::countCps<std::string_view, mojibake::Utf16BE>(s1)));
+    EXPECT_FALSE((mojibake::isValid<std::string_view, mojibake::Utf16BE>(s1)));
+
+    // Lone surrogates
+    std::string_view s2 = "\x00\xDC" "a\x00" "\x00\xD8" "b\x00" "\x00\xD8" ""sv;
+    std::vector<mojibake::Event> events;
+    auto onMojibake = [&events](std::string_view::const_iterator, mojibake::Event event) {
+        events.push_back(event);
+        return mojibake::handler::RET_SKIP;
+    };
+    EXPECT_EQ(u"ab", (mojibake::to<std::u16string, std::string_view, decltype(onMojibake),
+                      mojibake::Utf16, mojibake::Utf16LE>(s2, onMojibake)));
+    EXPECT_EQ((std::vector { mojibake::Event::BYTE_START, mojibake::Event::BYTE_NEXT,
+                             mojibake::Event::END }), events);
+
+    // In the middle of long block
+    auto s3 = toUtf16Bytes("Lorem ipsum dolor sit amet, consectetur adipiscing elit", false);
+    s3[24] = '\x00';  s3[25] = '\xDC';
+    auto r3 = mojibake::toM<std::string, std::string, mojibake::Utf8, mojibake::Utf16LE>(s3);
+    EXPECT_EQ("Lorem ipsum \uFFFDolor sit amet, consectetur adipiscing elit", r3);
+
+    // UTF-32: too high, surrogate
+    auto s4 = toUtf32Bytes("Lorem ipsum dolor sit amet", true);
+    s4[4] = '\x00';  s4[5] = '\x11';
+    s4[16] = '\x00';  s4[17] = '\x00';  s4[18] = '\xDA';
+    auto r4 = mojibake::toM<std::string, std::string, mojibake::Utf8, mojibake::Utf32BE>(s4);
+    EXPECT_EQ("L\uFFFDre\uFFFD ipsum dolor sit amet", r4);
+}
+
+
+///
+/// Limited buffer
+///
+TEST (ByteOrder, Limited)
+{
+    char buf[7];
+    auto r = mojibake::copyLim<mojibake::handler::Skip<std::u16string_view::const_iterator>,
+            std::u16string_view, char*, mojibake::Utf16, mojibake::Utf16BE>(u"ab\U0001F600", buf, std::size(buf));
+    EXPECT_EQ(buf + 4, r);
+}
+
+
+///// Code point view //////////////////////////////////////////////////////////
+
+
+///
+/// Range-for, ranges algorithms, reverse
+///
+TEST (CpView, Simple)
+{
+    std::string s = "A\u0436\U0001F600";
+    std::u32string r;
+    for (auto c : mojibake::codepoints(s))
+        r += c;
+    EXPECT_EQ(U"A\u0436\U0001F600", r);
+
+    auto v = mojibake::codepoints(s);
+    static_assert(std::ranges::bidirectional_range<decltype(v)>);
+    static_assert(std::ranges::view<decltype(v)>);
+    EXPECT_EQ(3, std::ranges::distance(v));
+    auto it = std::ranges::find(v, U'\u0436');
+    EXPECT_EQ(1, it.base() - s.begin());
+    EXPECT_EQ(3, it.nextBase() - s.begin());
+
+    r.clear();
+    for (auto c : v | std::views::reverse)
+        r += c;
+    EXPECT_EQ(U"\U0001F600\u0436A", r);
+}
+
+
+///
+/// Other encodings, const char*, forward-only data
+///
+TEST (CpView, Encodings)
+{
+    std::u32string r;
+    for (auto c : mojibake::codepoints(u"ab\U0001F600"))
+        r += c;
+    EXPECT_EQ(U"ab\U0001F600", r);
+
+    auto bytes = toUtf16Bytes("ab\U0001F600", true);
+    r.clear();
+    for (auto c : mojibake::codepoints<std::string, mojibake::Utf16BE>(bytes))
+        r += c;
+    EXPECT_EQ(U"ab\U0001F600", r);
+
+    std::forward_list<char> list { 'a', '\xD0', '\xB6' };
+    auto v = mojibake::codepoints(list);
+    static_assert(std::ranges::forward_range<decltype(v)>);
+    static_assert(!std::ranges::bidirectional_range<decltype(v)>);
+    EXPECT_EQ(U"a\u0436", std::u32string(v.begin(), v.end()));
+}
+
+
+///
+/// Bad data: the same as conversion, and backward = forward
+///
+TEST (CpView, Bad)
+{
+    std::string_view s = "a\x80\x80" "\xE2\x82" "b" "\xC3\xA9\xA9" "\xF8\x80"
+                         "\xE0\x80\x80\x80" "\xF0\x9F\x98"sv;
+    auto v = mojibake::codepoints(s);
+    std::u32string r(v.begin(), v.end());
+    EXPECT_EQ(mojibake::toM<std::u32string>(s), r);
+    std::u32string rev;
+    for (auto c : v | std::views::reverse)
+        rev += c;
+    std::reverse(rev.begin(), rev.end());
+    EXPECT_EQ(r, rev);
+
+    auto vs = mojibake::codepoints(s, mojibake::handler::Skip<std::string_view::const_iterator>{});
+    EXPECT_EQ(U"ab\u00E9", std::u32string(vs.begin(), vs.end()));
+    EXPECT_EQ(U'\u00E9', *std::ranges::prev(vs.end()));
+}
+
+
+///
+/// Forward and backward iteration split data in the same places
+///
+TEST (CpView, FwdBack)
+{
+    unsigned seed = 12345;
+    auto random = [&seed](size_t n) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % n;
+    };
+    auto check = [](const auto& v) {
+        using It = decltype(v.begin().base());
+        std::vector<std::pair<It, char32_t>> fwd, back;
+        for (auto it = v.begin(); it != v.end(); ++it)
+            fwd.emplace_back(it.base(), *it);
+        for (auto it = v.end(); it != v.begin(); ) {
+            --it;
+            back.emplace_back(it.base(), *it);
+        }
+        std::reverse(back.begin(), back.end());
+        EXPECT_EQ(fwd, back);
+    };
+    static constexpr unsigned char BYTES[] {
+        'a', 0x80, 0xBF, 0xC2, 0xC0, 0xE0, 0xE2, 0xED, 0xA0, 0xF0, 0xF4, 0x90, 0xF8, 0xFF };
+    static constexpr char16_t WORDS[] { 'a', 0xD800, 0xDBFF, 0xDC00, 0xDFFF, 0xE000 };
+    for (int i = 0; i < 300; ++i) {
+        std::string s;
+        std::u16string s16;
+        for (auto len = random(12); len != 0; --len) {
+            s += static_cast<char>(BYTES[random(std::size(BYTES))]);
+            s16 += WORDS[random(std::size(WORDS))];
+        }
+        check(mojibake::codepoints(s));
+        check(mojibake::codepoints(s16));
+        check(mojibake::codepoints<std::string, mojibake::Utf16LE>(s));
+        check(mojibake::codepoints<std::string, mojibake::Utf32BE>(s));
+    }
+}
+
+
+///
+/// Handler that halts
+///
+TEST (CpView, Halt)
+{
+    std::string_view s = "ab\xFF" "cd";
+    auto v = mojibake::codepoints(s, mojibake::handler::MojiHalt<std::string_view::const_iterator>{});
+    EXPECT_EQ(U"ab\uFFFD", std::u32string(v.begin(), v.end()));
+}
+
+
+///// Backward reading /////////////////////////////////////////////////////////
+
+
+///
+/// Reading backwards
+///
+TEST (Backward, GetBack)
+{
+    std::string_view s = "a\u0436\U0001F600\xE2\x82"sv;
+    auto p = s.end();
+    EXPECT_EQ(U'\uFFFD', mojibake::getBack(s.begin(), p));
+    EXPECT_EQ(s.begin() + 7, p);
+    EXPECT_EQ(U'\U0001F600', mojibake::getBack(s.begin(), p));
+    EXPECT_EQ(U'\u0436', mojibake::getBack(s.begin(), p));
+    EXPECT_EQ(U'a', mojibake::getBack(s.begin(), p));
+    EXPECT_EQ(s.begin(), p);
+
+    std::vector<mojibake::Event> events;
+    auto onMojibake = [&events](std::string_view::const_iterator, mojibake::Event event) {
+        events.push_back(event);
+        return mojibake::handler::RET_SKIP;
+    };
+    p = s.end();
+    EXPECT_EQ(mojibake::handler::RET_SKIP,
+              (mojibake::getBack<std::string_view::const_iterator, mojibake::Utf8>(s.begin(), p, onMojibake)));
+    EXPECT_EQ(std::vector { mojibake::Event::END }, events);
+
+    std::u16string_view s16 = u"a\U0001F600\xDC00";
+    auto p16 = s16.end();
+    EXPECT_EQ(U'\uFFFD', mojibake::getBack(s16.begin(), p16));
+    EXPECT_EQ(U'\U0001F600', mojibake::getBack(s16.begin(), p16));
+    EXPECT_EQ(s16.begin() + 1, p16);
+}
+
+
+///
+/// Last code points
+///
+TEST (Backward, LastCps)
+{
+    std::string s = "\u041B\u043E\u0433: \u0432\u0441\u0451 \u0445\u043E\u0440\u043E\u0448\u043E \U0001F600";
+    EXPECT_EQ(s.end() - 4, mojibake::lastCps(s, 1));
+    EXPECT_EQ(s.end() - 17, mojibake::lastCps(s, 8));
+    EXPECT_EQ(s.begin(), mojibake::lastCps(s, 100));
+    EXPECT_EQ(s.end(), mojibake::lastCps(s, 0));
+
+    // Bad sequences count as one
+    std::string_view s2 = "abc\x80\x80\xC3"sv;
+    EXPECT_EQ(s2.end() - 1, mojibake::lastCps(s2, 1));
+    EXPECT_EQ(s2.end() - 3, mojibake::lastCps(s2, 2));
+    EXPECT_EQ(s2.end() - 4, mojibake::lastCps(s2, 3));
+
+    std::u16string s16 = u"ab\U0001F600";
+    EXPECT_EQ(s16.begin() + 2, mojibake::lastCps(s16, 1));
+}
+
+
+///
+/// Trimming whitespace
+///
+TEST (Backward, TrimRight)
+{
+    std::string s = "\u0421\u0442\u0440\u043E\u043A\u0430\u3000 \t\u00A0\r\n";
+    EXPECT_EQ(s.begin() + 12, mojibake::trimRight(s));
+    std::string_view s1 = "   ";
+    EXPECT_EQ(s1.begin(), mojibake::trimRight(s1));
+    std::string_view s2 = "a \xA0"sv;     // bad byte is not space
+    EXPECT_EQ(s2.end(), mojibake::trimRight(s2));
+    std::u32string s32 = U"a\u2009\u2028";
+    EXPECT_EQ(s32.begin() + 1, mojibake::trimRight(s32));
+
+    EXPECT_TRUE(mojibake::isSpace(U'\u0085'));
+    EXPECT_FALSE(mojibake::isSpace(U'\u200B'));    // zero width space is not White_Space
+    EXPECT_FALSE(mojibake::isSpace(U'x'));
+}
+
+
+///// Code point index /////////////////////////////////////////////////////////
+
+namespace {
+
+    /// Checks index against simple scan
+    template <class Ch>
+    void checkCpIndex(std::basic_string_view<Ch> s)
+    {
+        mojibake::CpIndex<Ch> index(s);
+        std::vector<size_t> starts;
+        for (size_t i = 0; i < s.length(); ++i) {
+            if (i == 0 || mojibake::detail::isStartUnit(s[i]))
+                starts.push_back(i);
+        }
+        ASSERT_EQ(starts.size(), index.cpCount());
+        for (size_t i = 0; i < starts.size(); ++i)
+            EXPECT_EQ(starts[i], index.unitOfCp(i));
+        EXPECT_EQ(s.length(), index.unitOfCp(starts.size()));
+        size_t iCp = 0;
+        for (size_t i = 0; i < s.length(); ++i) {
+            if (iCp + 1 < starts.size() && starts[iCp + 1] == i)
+                ++iCp;
+            EXPECT_EQ(iCp, index.cpOfUnit(i));
+        }
+        EXPECT_EQ(starts.size(), index.cpOfUnit(s.length()));
+    }
+
+}   // anon namespace
+
+
+///
+/// UTF-8 and UTF-16, good and bad data, several index entries
+///
+TEST (CpIndex, Simple)
+{
+    std::string s;
+    for (int i = 0; i < 40; ++i)
+        s += "Abc \u0436\u0437 \U0001F600 ";
+    checkCpIndex<char>(s);
+    checkCpIndex<char16_t>(mojibake::toM<std::u16string>(s));
+
+    s.insert(0, "\x80\x80");
+    s.insert(100, "\xBF\xBF\xBF\xBF\xBF");
+    checkCpIndex<char>(s);
+
+    std::u16string s16 = u"\xDC00" "ab";
+    s16 += mojibake::toM<std::u16string>(s);
+    checkCpIndex<char16_t>(s16);
+
+    checkCpIndex<char>("");
+    checkCpIndex<char>("a");
+}
+
+
+///
+/// Exact multiples of index step
+///
+TEST (CpIndex, Step)
+{
+    std::string s(mojibake::CPINDEX_STEP * 3, 'a');
+    checkCpIndex<char>(s);
+    mojibake::CpIndex<char> index(s);
+    EXPECT_EQ(mojibake::CPINDEX_STEP * 2, index.unitOfCp(mojibake::CPINDEX_STEP * 2));
+    EXPECT_EQ(s.length(), index.unitOfCp(s.length()));
+}
+
+
+///// Truncation to units //////////////////////////////////////////////////////
+
+
+///
+/// Code point boundaries
+///
+TEST (TruncateToUnits, Simple)
+{
+    std::string_view s = "a\u0436\U0001F600b";
+    size_t expected[] { 0, 1, 1, 3, 3, 3, 3, 7, 8, 8 };
+    for (size_t i = 0; i < std::size(expected); ++i)
+        EXPECT_EQ(s.begin() + expected[i], mojibake::truncateToUnits(s, i)) << i;
+
+    std::u16string_view s16 = u"a\U0001F600b";
+    EXPECT_EQ(s16.begin() + 1, mojibake::truncateToUnits(s16, 2));
+    EXPECT_EQ(s16.begin() + 3, mojibake::truncateToUnits(s16, 3));
+
+    // Bad data: the same sequences forward reading finds
+    std::string_view s2 = "ab\x80\x80\x80\x80" "c\xE2\x82\xAC\xAC"sv;
+    EXPECT_EQ(s2.begin() + 2, mojibake::truncateToUnits(s2, 4));
+    EXPECT_EQ(s2.begin() + 7, mojibake::truncateToUnits(s2, 9));
+    EXPECT_EQ(s2.begin() + 10, mojibake::truncateToUnits(s2, 10));
+}
+
+
+///
+/// Grapheme cluster boundaries
+///
+TEST (TruncateToUnits, Grapheme)
+{
+    using mojibake::Bound;
+    std::string_view s = "e\u0301x";
+    EXPECT_EQ(s.begin() + 1, mojibake::truncateToUnits(s, 2));
+    EXPECT_EQ(s.begin(), mojibake::truncateToUnits<Bound::GRAPHEME>(s, 2));
+    EXPECT_EQ(s.begin() + 3, mojibake::truncateToUnits<Bound::GRAPHEME>(s, 3));
+
+    std::string_view flags = "\U0001F1F7\U0001F1FA\U0001F1FA\U0001F1F8";
+    EXPECT_EQ(flags.begin() + 12, mojibake::truncateToUnits(flags, 13));
+    EXPECT_EQ(flags.begin() + 8, mojibake::truncateToUnits<Bound::GRAPHEME>(flags, 13));
+    EXPECT_EQ(flags.begin() + 8, mojibake::truncateToUnits<Bound::GRAPHEME>(flags, 8));
+    EXPECT_EQ(flags.begin(), mojibake::truncateToUnits<Bound::GRAPHEME>(flags, 7));
+
+    std::string_view family = "\U0001F468\u200D\U0001F469 \U0001F469";
+    EXPECT_EQ(family.begin() + 7, mojibake::truncateToUnits(family, 10));
+    EXPECT_EQ(family.begin(), mojibake::truncateToUnits<Bound::GRAPHEME>(family, 10));
+    EXPECT_EQ(family.begin() + 11, mojibake::truncateToUnits<Bound::GRAPHEME>(family, 11));
+
+    std::string_view crlf = "a\r\nb";
+    EXPECT_EQ(crlf.begin() + 1, mojibake::truncateToUnits<Bound::GRAPHEME>(crlf, 2));
+}
+
+
+///// Limited copy, bulk mode //////////////////////////////////////////////////
+
+namespace {
+
+    /// Checks copyLim against checking every code point
+    template <class To, class Mjh, class From>
+    void checkBulkCopyLim(const From& from, const Mjh& onMojibake)
+    {
+        using ItFrom = decltype(std::begin(from));
+        using Enc1 = typename mojibake::detail::ContUtfTraits<From>::Enc;
+        using Enc2 = typename mojibake::detail::UtfTraits<To>::Enc;
+        for (size_t size : { 0, 1, 100, 255, 256, 257, 300, 1000, 5000 }) {
+            std::vector<To> buf1(size), buf2(size);
+            auto r1 = mojibake::copyLim(from, buf1.data(), size, onMojibake);
+            mojibake::LimitedIterator it(buf2.data(), size);
+            auto r2 = mojibake::detail::copy<ItFrom, decltype(it), Enc1, Enc2, Mjh>(
+                        std::begin(from), std::end(from), it, onMojibake).curr;
+            ASSERT_EQ(r2 - buf2.data(), r1 - buf1.data()) << size;
+            EXPECT_TRUE(std::equal(buf1.data(), r1, buf2.data()));
+        }
+    }
+
+}   // anon namespace
+
+
+///
+/// Bulk mode gives the same as checking every code point
+///
+TEST (CopyLimBulk, Simple)
+{
+    std::string s;
+    for (int i = 0; i < 30; ++i)
+        s += "Some text, \u0435\u0449\u0451 \u0442\u0435\u043A\u0441\u0442 \U0001F600 ";
+    using It = std::string::const_iterator;
+    checkBulkCopyLim<char>(s, mojibake::handler::Moji<It>{});
+    checkBulkCopyLim<char16_t>(s, mojibake::handler::Moji<It>{});
+    checkBulkCopyLim<char32_t>(s, mojibake::handler::Skip<It>{});
+    auto s16 = mojibake::toM<std::u16string>(s);
+    checkBulkCopyLim<char>(s16, mojibake::handler::Moji<std::u16string::const_iterator>{});
+}
+
+
+///
+/// Bad data at block ends, handlers that halt
+///
+TEST (CopyLimBulk, Bad)
+{
+    std::string s;
+    for (int i = 0; i < 100; ++i)
+        s += "abc\xE2\x82" "d\x80\x80\xF0\x9F";
+    using It = std::string::const_iterator;
+    checkBulkCopyLim<char>(s, mojibake::handler::Moji<It>{});
+    checkBulkCopyLim<char16_t>(s, mojibake::handler::Skip<It>{});
+    checkBulkCopyLim<char>(s, mojibake::handler::MojiHalt<It>{});
+
+    std::vector<std::pair<ptrdiff_t, mojibake::Event>> events1, events2;
+    auto* events = &events1;
+    auto onMojibake = [&s, &events](It place, mojibake::Event event) {
+        events->emplace_back(place - s.cbegin(), event);
+        return (events->size() == 150) ? mojibake::handler::RET_HALT : U'?';
+    };
+    char buf1[2000], buf2[2000];
+    auto r1 = mojibake::copyLim(s, buf1, std::size(buf1), onMojibake);
+    events = &events2;
+    mojibake::LimitedIterator it(buf2, std::size(buf2));
+    auto r2 = mojibake::detail::copy<It, decltype(it), mojibake::Utf8, mojibake::Utf8>(
+                s.cbegin(), s.cend(), it, onMojibake).curr;
+    EXPECT_EQ(r2 - buf2, r1 - buf1);
+    EXPECT_EQ(events2, events1);
+    EXPECT_EQ(150u, events1.size());
+}
+
+
+///
+/// CESU-8 and Modified UTF-8 take 6 bytes per supplementary code point,
+/// bulk mode should not outrun buffer end
+///
+TEST (CopyLimBulk, Cesu8)
+{
+    std::u32string src(256, U'\U0001F600');
+    src[200] = U'a';
+    auto check = [&src]<class Enc2>(Enc2) {
+        auto full = mojibake::toM<std::string, std::u32string, Enc2>(src);
+        for (size_t size : { 255, 256, 257, 300, 383, 384, 385, 1000, 1536, 2000 }) {
+            std::vector<char> buf(size + 8, 'Q');
+            auto r = mojibake::copyLimM<std::u32string, char*, mojibake::Utf32, Enc2>(
+                        src, buf.data(), buf.data() + size);
+            ASSERT_LE(r - buf.data(), static_cast<ptrdiff_t>(size)) << size;
+            EXPECT_EQ(std::string(8, 'Q'), std::string(buf.data() + size, 8)) << size;
+            // Whole code points only
+            auto len = static_cast<size_t>(r - buf.data());
+            EXPECT_EQ(std::string_view(full).substr(0, len), std::string_view(buf.data(), len));
+            EXPECT_GT(len + 6, std::min(size, full.length() + 5)) << size;
+        }
+    };
+    check(mojibake::Cesu8{});
+    check(mojibake::Mutf8{});
+}
+
+
+///// transcodeInPlace /////////////////////////////////////////////////////////
+
+
+///
+/// UTF-32 → UTF-16: never grows
+///
+TEST (TranscodeInPlace, U32to16)
+{
+    std::u32string s = U"Abc \u0435\u0449\u0451 \u4E2D\u6587 \U0001F600 bad:\xD800\x110000 end";
+    auto expected = mojibake::toM<std::u16string>(s);
+    auto n = mojibake::transcodeInPlace<mojibake::Utf16>(s.data(), s.length());
+    ASSERT_EQ(expected.length(), n);
+    std::u16string actual(n, 0);
+    std::memcpy(actual.data(), s.data(), n * sizeof(char16_t));
+    EXPECT_EQ(expected, actual);
+}
+
+
+///
+/// UTF-16 → UTF-8: grows at CJK, but ASCII around gives room
+///
+TEST (TranscodeInPlace, U16to8)
+{
+    std::u16string s = u"\u4E2D\u6587 text is mostly ASCII";
+    auto expected = mojibake::toM<std::string>(s);
+    auto n = mojibake::transcodeInPlace<mojibake::Utf8>(s.data(), s.length());
+    ASSERT_EQ(expected.length(), n);
+    EXPECT_EQ(expected, std::string_view(reinterpret_cast<const char*>(s.data()), n));
+}
+
+
+///
+/// UTF-16 → UTF-8: does not fit
+///
+TEST (TranscodeInPlace, NoRoom)
+{
+    const std::u16string original = u"\u4E2D\u6587\u5B57";
+    auto s = original;
+    auto n = mojibake::transcodeInPlace<mojibake::Utf8>(s.data(), s.length());
+    EXPECT_EQ(mojibake::INPLACE_NO_ROOM, n);
+    EXPECT_EQ(original, s);
+}
+
+
+///
+/// Containers: UTF-8 → code page in place, → UTF-16 bytes grows
+///
+TEST (TranscodeInPlace, Container)
+{
+    std::string s = "\u041F\u0440\u0438\u0432\u0435\u0442, \u043C\u0438\u0440";
+    auto n = mojibake::transcodeInPlace<mojibake::CodePage<mojibake::Cp::CP1251>>(s);
+    EXPECT_EQ(11u, n);
+    EXPECT_EQ("\xCF\xF0\xE8\xE2\xE5\xF2, \xEC\xE8\xF0", s);
+
+    s = "Abc";
+    n = mojibake::transcodeInPlace<mojibake::Utf16LE>(s);
+    EXPECT_EQ(6u, n);
+    EXPECT_EQ("A\0b\0c\0"sv, s);
+}
+
+
+namespace {
+
+    /// Checks transcodeInPlace against copy, with events
+    template <class Enc2, class Ch1>
+    void checkInPlace(std::basic_string_view<Ch1> original)
+    {
+        using Ch2 = typename Enc2::Ch;
+        using Ev = std::pair<ptrdiff_t, mojibake::Event>;
+        std::vector<Ev> events, expectedEvents;
+        std::vector<Ev>* pEvents = &expectedEvents;
+        const Ch1* base = original.data();
+        auto onMojibake = [&pEvents, &base](const Ch1* place, mojibake::Event event) {
+            pEvents->emplace_back(place - base, event);
+            return U'?';
+        };
+        using Enc1 = typename mojibake::detail::UtfTraits<Ch1>::Enc;
+        std::basic_string<Ch2> expected;
+        mojibake::copy<Enc1, Enc2>(original.data(), original.data() + original.length(),
+                std::back_inserter(expected), onMojibake);
+
+        std::basic_string<Ch1> s { original };
+        pEvents = &events;
+        base = s.data();
+        auto n = mojibake::transcodeInPlace<Enc2>(s.data(), s.length(), onMojibake);
+        ASSERT_EQ(expected.length(), n);
+        std::basic_string<Ch2> actual(n, 0);
+        std::memcpy(actual.data(), s.data(), n * sizeof(Ch2));
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(expectedEvents, events);
+    }
+
+}   // anon namespace
+
+
+///
+/// Bad data: handler gets places in original data, in place and
+/// when source is copied away
+///
+TEST (TranscodeInPlace, Bad)
+{
+    using Cp1251 = mojibake::CodePage<mojibake::Cp::CP1251>;
+    // In place
+    checkInPlace<Cp1251>(u8"\xFF\x80 abc\xE2\x82 d \u0451\u0436\xC0"sv);
+    checkInPlace<mojibake::Utf8>(u"abcd\xDC00 \u0451\u0436\xD800"sv);
+    // Source copied away: surrogate may become 4 bytes
+    checkInPlace<mojibake::Utf8>(u"\xD800\u4E2D abcdefgh"sv);
+    checkInPlace<mojibake::Utf16>(U"\xD800\x110000 abc \U0001F600"sv);
+}
+
+
+///
+/// CESU-8 and Modified UTF-8: ASCII takes one byte, NUL of Modified UTF-8 two
+///
+TEST (TranscodeInPlace, Cesu8)
+{
+    char hello[] = "hello";
+    EXPECT_EQ(5u, mojibake::transcodeInPlace<mojibake::Mutf8>(hello, 5));
+    EXPECT_EQ("hello"sv, std::string_view(hello, 5));
+
+    std::string s("a\0b"sv);
+    EXPECT_EQ(4u, mojibake::transcodeInPlace<mojibake::Mutf8>(s));
+    EXPECT_EQ("a\xC0\x80" "b"sv, s);
+
+    char nul[] = { 'a', '\0', 'b' };
+    EXPECT_EQ(mojibake::INPLACE_NO_ROOM, mojibake::transcodeInPlace<mojibake::Mutf8>(nul, 3));
+
+    // 10 bytes → 9
+    std::u16string s16 = u"ab \U0001F600";
+    auto n = mojibake::transcodeInPlace<mojibake::Cesu8>(s16.data(), s16.length());
+    ASSERT_EQ(9u, n);
+    EXPECT_EQ("ab \xED\xA0\xBD\xED\xB8\x80"sv,
+              std::string_view(reinterpret_cast<const char*>(s16.data()), n));
+
+    // Grows: 4 bytes → 6
+    std::string s8 = "hello, world \U0001F600";
+    EXPECT_EQ(19u, mojibake::transcodeInPlace<mojibake::Cesu8>(s8));
+    EXPECT_EQ("hello, world \xED\xA0\xBD\xED\xB8\x80"sv, s8);
+}
+
+
+///// hashCps //////////////////////////////////////////////////////////////////
+
+
+///
+/// Same text in any encoding → same hash, ASCII blocks or not
+///
+TEST (HashCps, Encodings)
+{
+    std::string s8;
+    for (int len = 0; len < 100; ++len) {
+        auto s16 = mojibake::toM<std::u16string>(s8);
+        auto s32 = mojibake::toM<std::u32string>(s8);
+        auto h = mojibake::hashCps(s8);
+        EXPECT_EQ(h, mojibake::hashCps(s16)) << s8;
+        EXPECT_EQ(h, mojibake::hashCps(s32)) << s8;
+        EXPECT_EQ(h, mojibake::hashCps(std::forward_list<char>(s8.begin(), s8.end()))) << s8;
+        s8 += (len % 23 == 7) ? "\u0451" : (len % 37 == 20) ? "\U0001F600" : "a";
+    }
+    EXPECT_EQ(mojibake::hashCps(u8"Abc \u0451\u0436"), mojibake::hashCps(L"Abc \u0451\u0436"));
+}
+
+
+///
+/// Different texts, different hashes
+///
+TEST (HashCps, Different)
+{
+    std::set<uint64_t> hashes;
+    std::u32string s;
+    for (char32_t c : U"abcdefghijklmnopqrstuvwxyz0123456789") {
+        s += c;
+        hashes.insert(mojibake::hashCps(s));
+    }
+    hashes.insert(mojibake::hashCps(U"\0"sv));
+    hashes.insert(mojibake::hashCps(U"\0\0"sv));
+    hashes.insert(mojibake::hashCps(U""sv));
+    EXPECT_EQ(s.length() + 3, hashes.size());
+}
+
+
+///
+/// Bad data is U+FFFD by default
+///
+TEST (HashCps, Bad)
+{
+    EXPECT_EQ(mojibake::hashCps(u8"a\uFFFDb"), mojibake::hashCps("a\xFF" "b"));
+    EXPECT_EQ(mojibake::hashCps(u"a\uFFFDb"), mojibake::hashCps(u"a\xD800" "b"));
+    using Sk = mojibake::handler::Skip<const char*>;
+    EXPECT_EQ(mojibake::hashCps("ab"), mojibake::hashCps("a\xFF" "b", Sk{}));
+}
+
+
+///
+/// Hash is stable: SIMD and plain C++ give the same
+///
+TEST (HashCps, Stable)
+{
+    EXPECT_EQ(0x798e1d87bcc9fcc1u,
+              mojibake::hashCps("Hello, world! This is a test of hashing, \u0435\u0449\u0451."));
+}
+
+
+///// Cross-encoding compare ///////////////////////////////////////////////////
+
+namespace {
+
+    /// Checks compare/equal of all encoding pairs against UTF-32
+    void checkCompare(std::u32string_view a, std::u32string_view b)
+    {
+        auto expected = a <=> b;
+        auto a8 = mojibake::toM<std::string>(a), b8 = mojibake::toM<std::string>(b);
+        auto a16 = mojibake::toM<std::u16string>(a), b16 = mojibake::toM<std::u16string>(b);
+        EXPECT_EQ(expected, mojibake::compare(a8, b16));
+        EXPECT_EQ(expected, mojibake::compare(a16, b8));
+        EXPECT_EQ(expected, mojibake::compare(a8, b));
+        EXPECT_EQ(expected, mojibake::compare(a, b16));
+        EXPECT_EQ(expected, mojibake::compare(a16, b16));
+        EXPECT_EQ(expected, mojibake::compare(a8, std::forward_list<char16_t>(b16.begin(), b16.end())));
+        EXPECT_EQ(expected == 0, mojibake::equal(a8, b16));
+        EXPECT_EQ(expected == 0, mojibake::equal(a8.begin(), a8.end(), b.begin(), b.end()));
+    }
+
+}   // anon namespace
+
+
+///
+/// Code point order at different places, incl. surrogates and lengths
+///
+TEST (Compare, Simple)
+{
+    std::u32string base = U"The quick brown fox jumps over the lazy dog, \u0435\u0449\u0451";
+    for (size_t i = 0; i <= base.length(); ++i) {
+        for (char32_t c : { U'a', U'~', U'\u0451', U'\uFFFF', U'\U0001F600' }) {
+            auto other = base;
+            if (i < other.length())
+                other[i] = c;
+            else
+                other += c;
+            checkCompare(base, other);
+            checkCompare(other, base);
+            checkCompare(base.substr(0, i), base);
+        }
+    }
+    checkCompare(base, base);
+    checkCompare(U"", U"");
+    // UTF-16 units are in other order
+    checkCompare(U"\uFFFF", U"\U0001F600");
+}
+
+
+///
+/// Bad data is U+FFFD
+///
+TEST (Compare, Bad)
+{
+    EXPECT_TRUE(mojibake::equal("abc\xFF" "d"sv, u"abc\uFFFD" "d"sv));
+    EXPECT_TRUE(mojibake::equal(u"abc\xD800"sv, "abc\xEF\xBF\xBD"sv));
+    EXPECT_EQ(std::strong_ordering::less, mojibake::compare("abc\xFF"sv, U"abc\U0001F600"sv));
+}
+
+
+///// findCaseless /////////////////////////////////////////////////////////////
+
+
+///
+/// Found ranges in UTF-8 and UTF-16, incl. ones longer than needle
+///
+TEST (FindCaseless, Simple)
+{
+    std::string hay = "Some long log line, nothing here. ERROR: Disk is full, \u041E\u0428\u0418\u0411\u041A\u0410 \u0434\u0438\u0441\u043A\u0430";
+    auto r = mojibake::findCaseless(hay, "error"sv);
+    EXPECT_EQ(34, r.begin() - hay.begin());
+    EXPECT_EQ("ERROR", std::string_view(r.begin(), r.end()));
+
+    r = mojibake::findCaseless(hay, u"\u043E\u0448\u0438\u0431\u043A\u0430"sv);
+    EXPECT_EQ("\u041E\u0428\u0418\u0411\u041A\u0410", std::string_view(r.begin(), r.end()));
+
+    r = mojibake::findCaseless(hay, "errors"sv);
+    EXPECT_TRUE(r.empty());
+    EXPECT_EQ(hay.end(), r.begin());
+
+    r = mojibake::findCaseless(hay, ""sv);
+    EXPECT_EQ(hay.begin(), r.begin());
+
+    // K KELVIN SIGN folds to ASCII k, and is 3 bytes long
+    std::u8string hay8 = u8"Speed in \u212Am/s";
+    auto r8 = mojibake::findCaseless(hay8, "KM"sv);
+    EXPECT_EQ(9, r8.begin() - hay8.begin());
+    EXPECT_EQ(4, r8.end() - r8.begin());
+
+    std::u16string hay16 = u"Lorem ipsum dolor sit amet, \u0401\u0436\u0438\u043A \u0432 \u0442\u0443\u043C\u0430\u043D\u0435";
+    auto r16 = mojibake::findCaseless(hay16, "\u0451\u0416\u0418\u041A"sv);
+    EXPECT_EQ(u"\u0401\u0436\u0438\u043A", std::u16string_view(r16.begin(), r16.end()));
+}
+
+
+///
+/// Same as find in folded haystack, bad data skipped
+///
+TEST (FindCaseless, Fuzz)
+{
+    const std::string_view pieces[] { "a", "B", "k", "K", "\u212A", "\u0451", "\u0401", "\xFF", "z", "\U0001F600" };
+    unsigned seed = 42;
+    auto random = [&seed](size_t n) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % n;
+    };
+    for (int iter = 0; iter < 2000; ++iter) {
+        std::string hay, needle;
+        for (auto len = random(60); len != 0; --len)
+            hay += pieces[random(std::size(pieces))];
+        for (auto len = random(3) + 1; len != 0; --len)
+            needle += pieces[random(std::size(pieces))];
+        auto foldedNeedle = mojibake::simpleCaseFold<std::u32string>(needle);
+        if (foldedNeedle.empty())   // bad data only
+            continue;
+        auto expected = mojibake::simpleCaseFold<std::u32string>(hay).find(foldedNeedle);
+        auto r = mojibake::findCaseless(hay, needle);
+        EXPECT_EQ(expected != std::u32string::npos, !r.empty()) << hay << " / " << needle;
+        if (!r.empty()) {
+            std::string_view found(r.begin(), r.end());
+            EXPECT_EQ(foldedNeedle, mojibake::simpleCaseFold<std::u32string>(found));
+            auto prefix = mojibake::simpleCaseFold<std::u32string>(
+                        std::string_view(hay.begin(), r.begin()));
+            EXPECT_EQ(expected, prefix.length());
+        }
+    }
+}
+
+
+///// TranscodingStreambuf /////////////////////////////////////////////////////
+
+namespace {
+
+    /// Long text, code points cross every block boundary somewhere
+    std::string longText()
+    {
+        std::string r;
+        while (r.length() < mojibake::STREAM_BLOCK * 3)
+            r += "Abc \u0451\u0436 \u4E2D\u6587 \U0001F600 ";
+        return r;
+    }
+
+}   // anon namespace
+
+
+///
+/// Reading: UTF-8 → UTF-16LE and back, long text
+///
+TEST (TranscodingStreambuf, Read)
+{
+    auto text = longText();
+    auto text16 = encode<mojibake::Utf16LE>(text);
+
+    std::stringbuf src(text);
+    mojibake::TranscodingStreambuf<mojibake::Utf8, mojibake::Utf16LE> tb(&src);
+    std::istream in(&tb);
+    std::string actual { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+    EXPECT_EQ(text16, actual);
+
+    std::stringbuf src16(text16);
+    mojibake::TranscodingStreambuf<mojibake::Utf16LE, mojibake::Utf8> tb16(&src16);
+    std::istream in16(&tb16);
+    std::string actual8 { std::istreambuf_iterator<char>(in16), std::istreambuf_iterator<char>() };
+    EXPECT_EQ(text, actual8);
+}
+
+
+///
+/// Writing by odd pieces, flush in the middle of code point
+///
+TEST (TranscodingStreambuf, Write)
+{
+    auto text = longText();
+    std::stringbuf dest;
+    {
+        mojibake::TranscodingStreambuf<mojibake::Utf8, mojibake::Utf32BE> tb(&dest);
+        std::ostream out(&tb);
+        for (size_t i = 0; i < text.length(); i += 7) {
+            out.write(text.data() + i, std::min<size_t>(7, text.length() - i));
+            if (i % 1001 == 0)
+                out.flush();
+        }
+    }
+    EXPECT_EQ(encode<mojibake::Utf32BE>(text), dest.str());
+}
+
+
+///
+/// Incomplete code point at the end is bad data
+///
+TEST (TranscodingStreambuf, Bad)
+{
+    std::stringbuf src("a\xFF" "b\xE2\x82");
+    mojibake::TranscodingStreambuf<mojibake::Utf8, mojibake::Utf8> tb(&src);
+    std::istream in(&tb);
+    std::string actual { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+    EXPECT_EQ("a\uFFFDb\uFFFD", actual);
+
+    std::stringbuf dest;
+    mojibake::TranscodingStreambuf<mojibake::Utf8, mojibake::CodePage<mojibake::Cp::CP1251>> tbw(&dest);
+    std::ostream out(&tbw);
+    out << "\u0401\u0436\xD0";
+    out.flush();
+    EXPECT_EQ("\xA8\xE6", dest.str());
+    EXPECT_TRUE(tbw.finish());
+    EXPECT_EQ("\xA8\xE6?", dest.str());
+}
+
+
+///// FdReader, FdWriter ///////////////////////////////////////////////////////
+
+#ifdef MJ_POSIX
+
+///
+/// Writing by odd pieces to file, reading back in another encoding
+///
+TEST (FdIo, File)
+{
+    auto text = longText();
+    FILE* f = std::tmpfile();
+    ASSERT_NE(nullptr, f);
+    int fd = fileno(f);
+    {
+        mojibake::FdWriter<mojibake::Utf8, mojibake::Utf16BE> writer(fd);
+        for (size_t i = 0; i < text.length(); i += 1001) {
+            ASSERT_TRUE(writer.write(std::string_view(text).substr(i, 1001)));
+            if (i % 7 == 0) {
+                ASSERT_TRUE(writer.flush());
+            }
+        }
+        ASSERT_TRUE(writer.finish());
+    }
+    ASSERT_EQ(0, lseek(fd, 0, SEEK_SET));
+    mojibake::FdReader<mojibake::Utf16BE, mojibake::Utf8> reader(fd);
+    std::string actual;
+    for (std::string_view piece; !(piece = reader.next()).empty(); )
+        actual += piece;
+    EXPECT_TRUE(reader.isEof());
+    EXPECT_EQ(text, actual);
+    std::fclose(f);
+}
+
+
+///
+/// Pipe gives code point by pieces
+///
+TEST (FdIo, Pipe)
+{
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    mojibake::FdReader<mojibake::Utf8, mojibake::Utf32LE> reader(fds[0]);
+    {
+        mojibake::FdWriter<mojibake::Utf8, mojibake::Utf8> writer(fds[1]);
+        writer.write("ab\xE2");
+        writer.flush();
+        EXPECT_EQ(encode<mojibake::Utf32LE>("ab"), reader.next());
+        writer.write("\x82\xAC" "c\xF0\x9F");
+    }   // destructor writes incomplete code point as bad data
+    close(fds[1]);
+    EXPECT_EQ(encode<mojibake::Utf32LE>("\u20ACc\uFFFD"), reader.next());
+    EXPECT_TRUE(reader.next().empty());
+    EXPECT_TRUE(reader.isEof());
+    close(fds[0]);
+}
+
+
+///
+/// Bulk mode: blocks of any size and any # of threads give the same
+///
+TEST (FdIo, Bulk)
+{
+    std::string text = longText();
+    text += "\xFF\x80\x80\x80\x80\x80 end";     // long bad data
+    auto text16 = encode<mojibake::Utf16LE>(text);
+    text16.push_back('x');                      // incomplete unit
+    FILE* fIn = std::tmpfile();
+    ASSERT_NE(nullptr, fIn);
+    ASSERT_EQ(text16.length(), std::fwrite(text16.data(), 1, text16.length(), fIn));
+    std::fflush(fIn);
+    const auto expected = encode<mojibake::Utf8>(text) + "\xEF\xBF\xBD";
+
+    for (size_t blockSize : { 4, 12, 1000, 65536, 1 << 20 }) {
+        for (unsigned nThreads : { 1, 3 }) {
+            FILE* fOut = std::tmpfile();
+            ASSERT_NE(nullptr, fOut);
+            using Mjh = mojibake::handler::Moji<const char*>;
+            EXPECT_TRUE((mojibake::detail::transcodeFile<mojibake::Utf16LE, mojibake::Utf8, Mjh>(
+                    fileno(fIn), fileno(fOut), nThreads, blockSize, Mjh{})));
+            std::string actual(expected.length() + 10, 0);
+            actual.resize(pread(fileno(fOut), actual.data(), actual.size(), 0));
+            EXPECT_EQ(expected, actual) << blockSize << " " << nThreads;
+            std::fclose(fOut);
+        }
+    }
+
+    // And back, with UTF-8 bad data at block ends
+    auto text8 = longText() + "\xE2\x82" "a\xC0 end";
+    FILE* f8 = std::tmpfile();
+    ASSERT_NE(nullptr, f8);
+    ASSERT_EQ(text8.length(), std::fwrite(text8.data(), 1, text8.length(), f8));
+    std::fflush(f8);
+    const auto expected16 = encode<mojibake::Utf16LE>(text8);
+    for (size_t blockSize : { 4, 16, 1000 }) {
+        FILE* fOut = std::tmpfile();
+        ASSERT_NE(nullptr, fOut);
+        using Mjh = mojibake::handler::Moji<const char*>;
+        EXPECT_TRUE((mojibake::detail::transcodeFile<mojibake::Utf8, mojibake::Utf16LE, Mjh>(
+                fileno(f8), fileno(fOut), 4, blockSize, Mjh{})));
+        std::string actual(expected16.length() + 10, 0);
+        actual.resize(pread(fileno(fOut), actual.data(), actual.size(), 0));
+        EXPECT_EQ(expected16, actual) << blockSize;
+        std::fclose(fOut);
+    }
+    std::fclose(f8);
+    std::fclose(fIn);
+}
+
+
+///
+/// Bulk mode reads pipe serially
+///
+TEST (FdIo, BulkPipe)
+{
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    std::string_view text = "Abc \xD1\x91\xD0\xB6 \xE2\x82";
+    ASSERT_EQ(static_cast<ssize_t>(text.length()), write(fds[1], text.data(), text.length()));
+    close(fds[1]);
+    FILE* fOut = std::tmpfile();
+    ASSERT_NE(nullptr, fOut);
+    EXPECT_TRUE((mojibake::transcodeFile<mojibake::Utf8, mojibake::Utf16BE>(fds[0], fileno(fOut))));
+    std::string actual(100, 0);
+    actual.resize(pread(fileno(fOut), actual.data(), actual.size(), 0));
+    EXPECT_EQ(encode<mojibake::Utf16BE>(text), actual);
+    std::fclose(fOut);
+    close(fds[0]);
+}
+
+#endif
+
+
+///// StreamDecoder, decodeAsync ///////////////////////////////////////////////
+
+
+///
+/// Pieces of any size give the same as the whole
+///
+TEST (StreamDecoder, Pieces)
+{
+    std::string text = "Abc \u0451\u0436 \u4E2D\u6587 \U0001F600 \xE2\x82" "a\xFF\xF0\x9F\x98";
+    auto expected = mojibake::toM<std::u32string>(text);
+    for (size_t size = 1; size <= 9; ++size) {
+        mojibake::StreamDecoder<mojibake::Utf8> decoder;
+        std::u32string actual;
+        for (size_t i = 0; i < text.length(); i += size)
+            actual += decoder.feed(std::string_view(text).substr(i, size));
+        actual += decoder.feed({}, true);
+        EXPECT_EQ(expected, actual) << size;
+    }
+
+    auto text16 = encode<mojibake::Utf16BE>("Abc \u0451\u0436 \U0001F600");
+    text16 += "\xD8";
+    for (size_t size = 1; size <= 5; ++size) {
+        mojibake::StreamDecoder<mojibake::Utf16BE, mojibake::Utf8> decoder;
+        std::string actual;
+        for (size_t i = 0; i < text16.length(); i += size)
+            actual += decoder.feed(std::string_view(text16).substr(i, size));
+        actual += decoder.feed({}, true);
+        EXPECT_EQ("Abc \u0451\u0436 \U0001F600\uFFFD", actual) << size;
+    }
+}
+
+namespace {
+
+    /// Checks that random pieces give the same as the whole
+    template <class Enc1, class Enc2>
+    void checkStreamChunks(std::string_view text, unsigned& seed)
+    {
+        auto random = [&seed](size_t n) {
+            seed = seed * 1103515245 + 12345;
+            return (seed >> 16) % n;
+        };
+        using Ch2 = typename Enc2::Ch;
+        mojibake::StreamDecoder<Enc1, Enc2> whole;
+        std::basic_string<Ch2> expected(whole.feed(text, true));
+        mojibake::StreamDecoder<Enc1, Enc2> decoder;
+        std::basic_string<Ch2> actual;
+        for (size_t i = 0; i < text.length(); ) {
+            auto size = random(9);
+            actual += decoder.feed(text.substr(i, size));
+            i += size;
+        }
+        actual += decoder.feed({}, true);
+        EXPECT_EQ(expected, actual);
+    }
+
+}   // anon namespace
+
+
+///
+/// Random pieces of bad data give the same as the whole,
+/// incl. long runs of stray continuation bytes
+///
+TEST (StreamDecoder, Chunks)
+{
+    unsigned seed = 42;
+    auto random = [&seed](size_t n) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % n;
+    };
+    static constexpr std::string_view PIECES[] {
+        "a", "\x80", "\x80\x80\x80\x9F\x80", "\xBF\xBF\xBF\xBF\xBF\xBF", "\xFF", "\xF8\x80\x80",
+        "\xC2", "\xC2\xA9", "\xE2\x82", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xC0\x80",
+        "\xED\xA0\xBD", "\xED\xB8\x80", "\xED\xA0\xBD\xED\xB8\x80" };
+    using Cp1251 = mojibake::CodePage<mojibake::Cp::CP1251>;
+    for (int iter = 0; iter < 2000; ++iter) {
+        std::string text;
+        for (size_t n = random(12); n > 0; --n)
+            text += PIECES[random(std::size(PIECES))];
+        checkStreamChunks<mojibake::Utf8, mojibake::Utf16LE>(text, seed);
+        checkStreamChunks<mojibake::Utf8, mojibake::Utf8>(text, seed);
+        checkStreamChunks<mojibake::Utf8, Cp1251>(text, seed);
+        checkStreamChunks<mojibake::Cesu8, mojibake::Utf16>(text, seed);
+        checkStreamChunks<mojibake::Mutf8, mojibake::Utf16LE>(text, seed);
+    }
+
+    // Carry stays short
+    mojibake::StreamDecoder<mojibake::Utf8, mojibake::Utf16LE> decoder;
+    std::string run(1000, '\x80');
+    std::string out;
+    for (int i = 0; i < 10; ++i)
+        out += decoder.feed(run);
+    out += decoder.feed("a", true);
+    EXPECT_EQ("\xFD\xFF" "a\0"sv, out);
+}
+
+namespace {
+
+    /// Async source: suspends until test gives it a piece
+    struct ManualSource {
+        std::coroutine_handle<> waiter;
+        std::string_view piece;
+
+        struct Awaiter {
+            ManualSource& source;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> h) noexcept { source.waiter = h; }
+            std::string_view await_resume() const noexcept { return source.piece; }
+        };
+
+        Awaiter next() { return { *this }; }
+
+        void give(std::string_view x)
+        {
+            piece = x;
+            std::exchange(waiter, nullptr).resume();
+        }
+    };
+
+    /// Coroutine that starts at once, nobody awaits it
+    struct DetachedTask {
+        struct promise_type {
+            DetachedTask get_return_object() const noexcept { return {}; }
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend() const noexcept { return {}; }
+            void return_void() const noexcept {}
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+    };
+
+    DetachedTask consume(ManualSource& source, std::u32string& result, bool& isDone)
+    {
+        auto chunks = mojibake::decodeAsync<mojibake::Utf8>(source);
+        while (auto chunk = co_await chunks.next())
+            result += *chunk;
+        isDone = true;
+    }
+
+}   // anon namespace
+
+
+///
+/// Sequence cut between pieces survives suspension
+///
+TEST (StreamDecoder, Async)
+{
+    ManualSource source;
+    std::u32string result;
+    bool isDone = false;
+    consume(source, result, isDone);
+    EXPECT_TRUE(result.empty());
+    source.give("ab\xE2");
+    EXPECT_EQ(U"ab", result);
+    source.give("\x82");
+    EXPECT_EQ(U"ab", result);
+    source.give("\xAC" "c\xF0");
+    EXPECT_EQ(U"ab\u20ACc", result);
+    EXPECT_FALSE(isDone);
+    source.give({});
+    EXPECT_EQ(U"ab\u20ACc\uFFFD", result);
+    EXPECT_TRUE(isDone);
+}
+
+
+///// Surrogate escape, WTF-8 //////////////////////////////////////////////////
+
+namespace {
+
+    using EscIt = std::string::const_iterator;
+    using Lone16 = mojibake::handler::Lone<std::u16string::const_iterator>;
+    using Lone32 = mojibake::handler::Lone<std::u32string::const_iterator>;
+
+    std::u16string escToU16(const std::string& x)
+    {
+        return mojibake::to<std::u16string, std::string, mojibake::handler::Skip<EscIt>,
+                            mojibake::Utf16, mojibake::Utf8Esc>(x);
+    }
+
+    std::string u16ToEsc(const std::u16string& x)
+        { return mojibake::to<std::string, std::u16string, Lone16, mojibake::Utf8Esc>(x); }
+
+}   // anon namespace
+
+
+///
+/// Good data is the same as UTF-8
+///
+TEST (Utf8Esc, Good)
+{
+    std::string text = "Abc \u0451\u0436 \u4E2D\u6587 \U0001F600";
+    EXPECT_EQ(u"Abc \u0451\u0436 \u4E2D\u6587 \U0001F600", escToU16(text));
+    EXPECT_EQ(text, u16ToEsc(u"Abc \u0451\u0436 \u4E2D\u6587 \U0001F600"));
+    // Cut \u0436 is an escaped byte
+    EXPECT_EQ(6u, (mojibake::countCps<EscIt, mojibake::Utf8Esc>(text.cbegin(), text.cbegin() + 7)));
+}
+
+
+///
+/// Every byte of bad data is escaped, even of a long bad sequence
+///
+TEST (Utf8Esc, Bad)
+{
+    std::string text = "a\xFF" "b\xE2\x82" "c\xED\xA0\x80" "d\xC0\x80\xE2\x82\xAC\xF0";
+    std::u16string expected { u'a', 0xDCFF, u'b', 0xDCE2, 0xDC82, u'c', 0xDCED, 0xDCA0, 0xDC80,
+                              u'd', 0xDCC0, 0xDC80, u'\u20AC', 0xDCF0 };
+    EXPECT_EQ(expected, escToU16(text));
+    EXPECT_EQ(text, u16ToEsc(expected));
+    EXPECT_EQ(14u, (mojibake::countCps<EscIt, mojibake::Utf8Esc>(text.cbegin(), text.cend())));
+
+    // Forward iterators go by get()
+    std::forward_list<char> list(text.begin(), text.end());
+    std::u16string r;
+    mojibake::copy<mojibake::Utf8Esc, mojibake::Utf16>(
+            list.begin(), list.end(), std::back_inserter(r),
+            mojibake::handler::Skip<std::forward_list<char>::iterator>{});
+    EXPECT_EQ(expected, r);
+}
+
+
+///
+/// Any byte string survives round trip through UTF-16 and UTF-32
+///
+TEST (Utf8Esc, Fuzz)
+{
+    unsigned seed = 46;
+    auto random = [&seed](size_t n) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % n;
+    };
+    static constexpr std::string_view PIECES[] {
+        "a", "\x80", "\xBF", "\xC3", "\xA9", "\xE2", "\x82", "\xAC", "\xED", "\xA0",
+        "\xF0", "\x9F", "\x98", "\x80", "\xFF", "\xC0", "\u0436", "\U0001F600" };
+    for (int iter = 0; iter < 1000; ++iter) {
+        std::string text;
+        for (size_t n = random(20); n > 0; --n)
+            text += PIECES[random(std::size(PIECES))];
+        auto u16 = escToU16(text);
+        EXPECT_EQ(text, u16ToEsc(u16));
+        auto u32 = mojibake::to<std::u32string, std::string, mojibake::handler::Skip<EscIt>,
+                                mojibake::Utf32, mojibake::Utf8Esc>(text);
+        EXPECT_EQ(text, (mojibake::to<std::string, std::u32string, Lone32, mojibake::Utf8Esc>(u32)));
+    }
+}
+
+
+///
+/// Lone surrogates of UTF-16 make WTF-8, and come back
+///
+TEST (Lone, Wtf8)
+{
+    std::u16string text { u'a', 0xD800, u'b', 0xDFFF, 0xDBFF, 0xD83D, 0xDE00, 0xDC00 };
+    std::string expected = "a\xED\xA0\x80" "b\xED\xBF\xBF\xED\xAF\xBF\U0001F600\xED\xB0\x80";
+    auto wtf8 = mojibake::to<std::string, std::u16string, Lone16>(text);
+    EXPECT_EQ(expected, wtf8);
+    EXPECT_EQ(text, (mojibake::to<std::u16string, std::string,
+                                  mojibake::handler::Lone<EscIt>>(wtf8)));
+
+    std::u32string text32 { U'a', 0xD800, U'b', 0xDFFF };
+    EXPECT_EQ(text.substr(0, 4), (mojibake::to<std::u16string, std::u32string, Lone32>(text32)));
+
+    // Other bad data is still mojibake
+    EXPECT_EQ(u"a\uFFFD\uFFFDb", (mojibake::to<std::u16string, std::string,
+                                  mojibake::handler::Lone<EscIt>>(std::string("a\xED\x9F\xC0\x80" "b"))));
+}
+
+
+///// CESU-8, Modified UTF-8 ///////////////////////////////////////////////////
+
+
+///
+/// Supplementary code points are surrogate pairs, NUL in Modified UTF-8 is C0 80
+///
+TEST (Cesu8, Simple)
+{
+    std::u32string text(U"a\0\u0436\u4E2D\U0001F600"sv);
+    std::string cesu("a\0\xD0\xB6\xE4\xB8\xAD\xED\xA0\xBD\xED\xB8\x80"sv);
+    std::string mutf("a\xC0\x80\xD0\xB6\xE4\xB8\xAD\xED\xA0\xBD\xED\xB8\x80"sv);
+    EXPECT_EQ(cesu, (mojibake::to<std::string, std::u32string,
+                                  mojibake::handler::Moji<std::u32string::const_iterator>,
+                                  mojibake::Cesu8>(text)));
+    EXPECT_EQ(mutf, (mojibake::to<std::string, std::u32string,
+                                  mojibake::handler::Moji<std::u32string::const_iterator>,
+                                  mojibake::Mutf8>(text)));
+    using Mh = mojibake::handler::Moji<std::string::const_iterator>;
+    EXPECT_EQ(text, (mojibake::to<std::u32string, std::string, Mh, mojibake::Utf32, mojibake::Cesu8>(cesu)));
+    EXPECT_EQ(text, (mojibake::to<std::u32string, std::string, Mh, mojibake::Utf32, mojibake::Mutf8>(mutf)));
+    EXPECT_EQ("a\0\u0436\u4E2D\U0001F600"sv,
+              (mojibake::to<std::string, std::string, Mh, mojibake::Utf8, mojibake::Mutf8>(mutf)));
+    EXPECT_EQ(mutf, (mojibake::to<std::string, std::string, Mh, mojibake::Mutf8, mojibake::Cesu8>(cesu)));
+    EXPECT_EQ(5u, (mojibake::countCps<std::string::const_iterator, mojibake::Cesu8>(cesu.cbegin(), cesu.cend())));
+    EXPECT_TRUE((mojibake::isValid<std::string, mojibake::Mutf8>(mutf)));
+
+    // Lenient: 4-byte UTF-8 and raw NUL are read too
+    EXPECT_EQ(U"\0\U0001F600"sv, (mojibake::to<std::u32string, std::string, Mh, mojibake::Utf32, mojibake::Mutf8>(
+                            std::string("\0\U0001F600"sv))));
+}
+
+
+///
+/// Unpaired surrogates and UTF-8 bad data are mojibake
+///
+TEST (Cesu8, Bad)
+{
+    using Mh = mojibake::handler::Moji<std::string::const_iterator>;
+    auto decode = [](const std::string& x) {
+        return mojibake::to<std::u32string, std::string, Mh, mojibake::Utf32, mojibake::Cesu8>(x);
+    };
+    EXPECT_EQ(U"a\uFFFDb", decode("a\xED\xA0\xBD" "b"));             // leading, then ASCII
+    EXPECT_EQ(U"a\uFFFD", decode("a\xED\xA0\xBD"));                  // leading at end
+    EXPECT_EQ(U"a\uFFFD\uFFFD", decode("a\xED\xA0\xBD\xED\xA0\xBD")); // two leading
+    EXPECT_EQ(U"a\uFFFDb", decode("a\xED\xB8\x80" "b"));             // trailing
+    EXPECT_EQ(U"a\uFFFDb", decode("a\xC0\x80" "b"));                 // C0 80 is Modified UTF-8 only
+    EXPECT_EQ(U"a\uFFFDb\uFFFD", decode("a\xE4\xB8" "b\xFF"));       // bad UTF-8
+    EXPECT_EQ(U"ab", (mojibake::to<std::u32string, std::string,
+                                  mojibake::handler::Skip<std::string::const_iterator>,
+                                  mojibake::Utf32, mojibake::Cesu8>(std::string("a\xED\xA0\xBD" "b"))));
+}
+
+
+///
+/// Fast paths from UTF-16 and code pages write the same as code point by code point
+///
+TEST (Cesu8, FastPaths)
+{
+    auto text = longText();
+    auto cesu = mojibake::to<std::string, std::string,
+                        mojibake::handler::Moji<std::string::const_iterator>,
+                        mojibake::Cesu8>(text);
+    auto le = encode<mojibake::Utf16LE>(text);
+    std::string r;
+    mojibake::copy<mojibake::Utf16LE, mojibake::Cesu8>(
+            le.cbegin(), le.cend(), std::back_inserter(r),
+            mojibake::handler::Moji<std::string::const_iterator>{});
+    EXPECT_EQ(cesu, r);
+
+    std::string cp1251 = "Hello, world! \xCF\xF0\xE8\xE2\xE5\xF2, \xEC\xE8\xF0!";
+    r.clear();
+    mojibake::copy<mojibake::Cp1251, mojibake::Cesu8>(
+            cp1251.cbegin(), cp1251.cend(), std::back_inserter(r),
+            mojibake::handler::Moji<std::string::const_iterator>{});
+    EXPECT_EQ("Hello, world! \u041F\u0440\u0438\u0432\u0435\u0442, \u043C\u0438\u0440!", r);
+}
+
+
+///
+/// Stream keeps leading surrogate until its pair comes
+///
+TEST (Cesu8, Stream)
+{
+    std::string text = "Abc \u0436 \U0001F600\U0001F600 \u4E2D";
+    auto cesu = mojibake::to<std::string, std::string,
+                        mojibake::handler::Moji<std::string::const_iterator>,
+                        mojibake::Cesu8>(text);
+    for (size_t size = 1; size <= 7; ++size) {
+        mojibake::StreamDecoder<mojibake::Cesu8, mojibake::Utf8> decoder;
+        std::string actual;
+        for (size_t i = 0; i < cesu.length(); i += size)
+            actual += decoder.feed(std::string_view(cesu).substr(i, size));
+        actual += decoder.feed({}, true);
+        EXPECT_EQ(text, actual) << size;
+    }
+}
+
+
+#ifdef MJ_POSIX
+
+///
+/// Bulk mode does not cut surrogate pairs between blocks
+///
+TEST (Cesu8, Bulk)
+{
+    std::string text = "Abc \u0436 \U0001F600\U0001F600 \u4E2D \U0001F600";
+    auto cesu = mojibake::to<std::string, std::string,
+                        mojibake::handler::Moji<std::string::const_iterator>,
+                        mojibake::Cesu8>(text);
+    FILE* fIn = std::tmpfile();
+    ASSERT_NE(nullptr, fIn);
+    ASSERT_EQ(cesu.length(), std::fwrite(cesu.data(), 1, cesu.length(), fIn));
+    std::fflush(fIn);
+    for (size_t blockSize : { 4, 8, 12, 16 }) {
+        FILE* fOut = std::tmpfile();
+        ASSERT_NE(nullptr, fOut);
+        using Mjh = mojibake::handler::Moji<const char*>;
+        EXPECT_TRUE((mojibake::detail::transcodeFile<mojibake::Cesu8, mojibake::Utf8, Mjh>(
+                fileno(fIn), fileno(fOut), 2, blockSize, Mjh{})));
+        std::string actual(text.length() + 10, 0);
+        actual.resize(pread(fileno(fOut), actual.data(), actual.size(), 0));
+        EXPECT_EQ(text, actual) << blockSize;
+        std::fclose(fOut);
+    }
+    std::fclose(fIn);
+}
+
+#endif
+
+
+///// Latin-1 //////////////////////////////////////////////////////////////////
+
+namespace {
+
+    /// All Latin-1 bytes several times, to get into SIMD blocks
+    std::string allLatin1()
+    {
+        std::string r;
+        for (int i = 0; i < 3; ++i) {
+            for (int c = 1; c < 256; ++c)
+                r += static_cast<char>(c);
+            r += "Hello, world!";
+        }
+        return r;
+    }
+
+}   // anon namespace
+
+
+///
+/// Widening to UTF-16/32 is zero extension
+///
+TEST (Latin1, Widen)
+{
+    auto latin = allLatin1();
+    std::u16string expected16(latin.begin(), latin.end());
+    for (auto& c : expected16)
+        c = static_cast<unsigned char>(c);
+    std::u32string expected32(expected16.begin(), expected16.end());
+
+    using Mh = mojibake::handler::Moji<std::string::const_iterator>;
+    EXPECT_EQ(expected16, (mojibake::to<std::u16string, std::string, Mh,
+                                        mojibake::Utf16, mojibake::Latin1>(latin)));
+    EXPECT_EQ(expected32, (mojibake::to<std::u32string, std::string, Mh,
+                                        mojibake::Utf32, mojibake::Latin1>(latin)));
+    EXPECT_EQ(mojibake::toM<std::string>(expected32),
+              (mojibake::to<std::string, std::string, Mh, mojibake::Utf8, mojibake::Latin1>(latin)));
+
+    // Tail shorter than a block, forward iterators
+    std::forward_list<char> list { 'a', '\xE9' };
+    std::u16string r;
+    mojibake::copy<mojibake::Latin1, mojibake::Utf16>(
+            list.begin(), list.end(), std::back_inserter(r),
+            mojibake::handler::Moji<std::forward_list<char>::iterator>{});
+    EXPECT_EQ(u"a\u00E9", r);
+}
+
+
+///
+/// Narrowing gives the same for any source; what does not fit is mojibake
+///
+TEST (Latin1, Narrow)
+{
+    auto latin = allLatin1();
+    auto u16 = mojibake::to<std::u16string, std::string,
+                            mojibake::handler::Moji<std::string::const_iterator>,
+                            mojibake::Utf16, mojibake::Latin1>(latin);
+    auto u32 = mojibake::toM<std::u32string>(u16);
+    auto u8 = mojibake::toM<std::string>(u16);
+
+    auto narrow = [](const auto& x) {
+        using It = decltype(std::begin(x));
+        std::string r;
+        mojibake::copy<mojibake::Latin1>(std::begin(x), std::end(x), std::back_inserter(r),
+                                         mojibake::handler::Skip<It>{});
+        return r;
+    };
+    EXPECT_EQ(latin, narrow(u16));
+    EXPECT_EQ(latin, narrow(u32));
+    EXPECT_EQ(latin, narrow(u8));
+
+    // Non-Latin-1 in every position of block
+    for (size_t i = 0; i < 20; ++i) {
+        std::u16string text = u"Hello, world! Hello, world!";
+        text.insert(i, u"\u0436\U0001F600");
+        std::string expected = "Hello, world! Hello, world!";
+        EXPECT_EQ(expected, narrow(text)) << i;
+        EXPECT_EQ(expected, narrow(mojibake::toM<std::u32string>(text))) << i;
+        EXPECT_EQ(expected, narrow(mojibake::toM<std::string>(text))) << i;
+    }
+
+    std::string r;
+    auto text = u"caf\u00E9 \u20AC5"sv;
+    mojibake::copy<mojibake::Latin1>(text.begin(), text.end(), std::back_inserter(r),
+            mojibake::handler::Moji<decltype(text.begin())>{});
+    EXPECT_EQ("caf\xE9 ?5", r);
+}
+
+
+///
+/// fitsLatin1 for all widths
+///
+TEST (Latin1, Fits)
+{
+    auto latin = allLatin1();
+    auto u16 = mojibake::to<std::u16string, std::string,
+                            mojibake::handler::Moji<std::string::const_iterator>,
+                            mojibake::Utf16, mojibake::Latin1>(latin);
+    EXPECT_TRUE(mojibake::fitsLatin1(u16));
+    EXPECT_TRUE(mojibake::fitsLatin1(mojibake::toM<std::u32string>(u16)));
+    EXPECT_TRUE(mojibake::fitsLatin1(mojibake::toM<std::string>(u16)));
+    EXPECT_TRUE(mojibake::fitsLatin1(""));
+    EXPECT_TRUE(mojibake::fitsLatin1(u"caf\u00E9"));
+
+    for (size_t i = 0; i < 20; ++i) {
+        auto text = u16;
+        text[i * 7] = u'\u0436';
+        EXPECT_FALSE(mojibake::fitsLatin1(text)) << i;
+        EXPECT_FALSE(mojibake::fitsLatin1(mojibake::toM<std::u32string>(text))) << i;
+        EXPECT_FALSE(mojibake::fitsLatin1(mojibake::toM<std::string>(text))) << i;
+    }
+    EXPECT_FALSE(mojibake::fitsLatin1(std::string("caf\xE9")));     // bad UTF-8
+    EXPECT_FALSE(mojibake::fitsLatin1(U"\U0001F600"));
+}
+
+
+///// isAscii, firstNonAscii ///////////////////////////////////////////////////
+
+namespace {
+
+    template <class Ch>
+    void checkFirstNonAscii()
+    {
+        for (size_t len : { 0, 1, 15, 16, 17, 40 }) {
+            std::basic_string<Ch> s(len, Ch('a'));
+            EXPECT_EQ(len, mojibake::firstNonAscii(s)) << len;
+            EXPECT_TRUE(mojibake::isAscii(s)) << len;
+            for (size_t i = 0; i < len; ++i) {
+                auto t = s;
+                t[i] = static_cast<Ch>(0x80 + i);
+                EXPECT_EQ(i, mojibake::firstNonAscii(t)) << len << " " << i;
+                EXPECT_EQ(i, mojibake::firstNonAscii(t.c_str())) << len << " " << i;
+                EXPECT_FALSE(mojibake::isAscii(t)) << len << " " << i;
+            }
+        }
+    }
+
+}   // anon namespace
+
+
+///
+/// Every unit width, non-ASCII in every position
+///
+TEST (IsAscii, Widths)
+{
+    checkFirstNonAscii<char>();
+    checkFirstNonAscii<char16_t>();
+    checkFirstNonAscii<char32_t>();
+    checkFirstNonAscii<wchar_t>();
+    EXPECT_TRUE(mojibake::isAscii("Hello, world!"));
+    EXPECT_FALSE(mojibake::isAscii(u"Hello, \u043C\u0438\u0440!"));
+    EXPECT_EQ(7u, mojibake::firstNonAscii(U"Hello, \u043C\u0438\u0440!"));
+
+    std::forward_list<char> list { 'a', 'b', '\xC0', 'c' };
+    EXPECT_EQ(2u, mojibake::firstNonAscii(list.begin(), list.end()));
+    EXPECT_FALSE(mojibake::isAscii(list.begin(), list.end()));
+}
+
+
+///
+/// Conversions copy ASCII prefix as is, and give the same
+///
+TEST (IsAscii, Conversions)
+{
+    std::string text = "Hello, world! Hello, world! \xD0\xB6 \xFF end";
+    EXPECT_EQ(u"Hello, world! Hello, world! \u0436 \uFFFD end", mojibake::toM<std::u16string>(text));
+    EXPECT_EQ(u"Hello, world! Hello, world! \u0436  end", mojibake::toS<std::u16string>(text));
+    EXPECT_EQ(U"Hello, world! Hello, world! \u0436 \uFFFD end", mojibake::toQ<std::u32string>(text));
+    EXPECT_EQ(text, mojibake::toQ<std::string>(text));
+    EXPECT_EQ("Hello, world!", mojibake::toQ<std::string>(u"Hello, world!"sv));
+
+    std::vector<char16_t> v = mojibake::toM<std::vector<char16_t>>("Hello, world! \u0436"sv);
+    EXPECT_EQ(u"Hello, world! \u0436"sv, std::u16string_view(v.data(), v.size()));
+
+    mojibake::ConvString<char16_t, char> conv("Hello, world! Hello, world!");
+    EXPECT_EQ(u"Hello, world! Hello, world!"sv, static_cast<std::u16string_view>(conv));
+
+    // Modified UTF-8 writes NUL differently
+    std::u16string withNul(u"Hello, world!\0 Hello, world!"sv);
+    EXPECT_EQ("Hello, world!\xC0\x80 Hello, world!"sv,
+              (mojibake::to<std::string, std::u16string,
+                            mojibake::handler::Moji<std::u16string::const_iterator>,
+                            mojibake::Mutf8>(withNul)));
+}
+
+
+#ifdef MJ_PROFILE
+
+/////
+/////  Profile /////////////////////////////////////////////////////////////////
+/////
+
+namespace {
+
+    /// @return  stats of call site in this file, or nullptr
+    const mojibake::profile::Stats* findSite(
+            const std::vector<mojibake::profile::Entry>& entries,
+            std::string_view op, unsigned line)
+    {
+        for (auto& x : entries) {
+            if (x.site.op == op && x.site.line == line
+                    && std::string_view(x.site.file).ends_with("test_Mojibake.cpp"))
+                return &x.stats;
+        }
+        return nullptr;
+    }
+
+}   // anon namespace
+
+
+///
+/// Every public function records to its call site, nested ones do not
+///
+TEST (Profile, Sites)
+{
+    mojibake::profile::reset();
+    std::string text = "abc\xD0\xB6\xFF";
+    unsigned lineTo = __LINE__ + 2;
+    for (int i = 0; i < 3; ++i)
+        EXPECT_EQ(u"abc\u0436\uFFFD", mojibake::toM<std::u16string>(text));
+    unsigned lineCount = __LINE__ + 1;
+    EXPECT_EQ(4u, mojibake::countCps(text));
+    unsigned lineValid = __LINE__ + 1;
+    EXPECT_FALSE(mojibake::isValid(text));
+    char16_t buf[10];
+    unsigned lineCopy = __LINE__ + 1;
+    auto end = mojibake::copyS(text.begin(), text.end(), buf);
+    EXPECT_EQ(u"abc\u0436"sv, std::u16string_view(buf, end - buf));
+    unsigned lineFold = __LINE__ + 1;
+    EXPECT_EQ(u"\u0436z", mojibake::simpleCaseFold<std::u16string>(u"\u0416Z"sv));
+
+    auto entries = mojibake::profile::snapshot();
+    EXPECT_EQ(5u, entries.size());
+    auto to = findSite(entries, "to", lineTo);
+    ASSERT_NE(nullptr, to);
+    EXPECT_EQ(3u, to->nCalls);
+    EXPECT_EQ(18u, to->bytesIn);
+    EXPECT_EQ(30u, to->bytesOut);
+    EXPECT_EQ(12u, to->nCps);
+    EXPECT_EQ(3u, to->nMojibake);
+
+    auto count = findSite(entries, "countCps", lineCount);
+    ASSERT_NE(nullptr, count);
+    EXPECT_EQ(1u, count->nCalls);
+    EXPECT_EQ(6u, count->bytesIn);
+    EXPECT_EQ(4u, count->nCps);
+
+    auto valid = findSite(entries, "isValid", lineValid);
+    ASSERT_NE(nullptr, valid);
+    EXPECT_EQ(4u, valid->nCps);
+
+    auto copy = findSite(entries, "copy", lineCopy);
+    ASSERT_NE(nullptr, copy);
+    EXPECT_EQ(8u, copy->bytesOut);
+    EXPECT_EQ(1u, copy->nMojibake);
+
+    auto fold = findSite(entries, "simpleCaseFold", lineFold);
+    ASSERT_NE(nullptr, fold);
+    EXPECT_EQ(4u, fold->bytesIn);
+    EXPECT_EQ(2u, fold->nCps);
+
+    mojibake::profile::reset();
+    EXPECT_TRUE(mojibake::profile::snapshot().empty());
+}
+
+
+///
+/// Sink gets stats periodically, and what it calls is not recorded
+///
+TEST (Profile, Sink)
+{
+    mojibake::profile::reset();
+    size_t nDumps = 0, nSites = 0;
+    mojibake::profile::setSink(
+        [&](const std::vector<mojibake::profile::Entry>& entries) {
+            ++nDumps;
+            nSites = entries.size();
+            mojibake::toM<std::string>(u"not recorded"sv);
+        }, std::chrono::steady_clock::duration::zero());
+    for (int i = 0; i < 3; ++i)
+        mojibake::toM<std::string>(u"abc"sv);
+    mojibake::profile::setSink({}, std::chrono::seconds(1));
+    mojibake::toM<std::string>(u"abc"sv);
+
+    EXPECT_EQ(3u, nDumps);
+    EXPECT_EQ(1u, nSites);
+    EXPECT_EQ(2u, mojibake::profile::snapshot().size());
+
+    std::FILE* f = std::tmpfile();
+    ASSERT_NE(nullptr, f);
+    mojibake::profile::dump(f);
+    std::rewind(f);
+    char line[100];
+    ASSERT_NE(nullptr, std::fgets(line, sizeof(line), f));
+    EXPECT_NE(nullptr, std::strstr(line, "ticks"));
+    std::fclose(f);
+    mojibake::profile::reset();
+}
+
+#endif
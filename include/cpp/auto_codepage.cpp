@@ -0,0 +1,545 @@
+// This file is autogenerated!
+#include "../internal/auto.hpp"
+constinit const char16_t mojibake::detail::cpToUnicode[9][128] = {
+ {8364,0,8218,0,8222,8230,8224,8225,0,8240,352,8249,346,356,381,377,
+  0,8216,8217,8220,8221,8226,8211,8212,0,8482,353,8250,347,357,382,378,
+  160,711,728,321,164,260,166,167,168,169,350,171,172,173,174,379,
+  176,177,731,322,180,181,182,183,184,261,351,187,317,733,318,380,
+  340,193,194,258,196,313,262,199,268,201,280,203,282,205,206,270,
+  272,323,327,211,212,336,214,215,344,366,218,368,220,221,354,223,
+  341,225,226,259,228,314,263,231,269,233,281,235,283,237,238,271,
+  273,324,328,243,244,337,246,247,345,367,250,369,252,253,355,729, },
+ {1026,1027,8218,1107,8222,8230,8224,8225,8364,8240,1033,8249,1034,1036,1035,1039,
+  1106,8216,8217,8220,8221,8226,8211,8212,0,8482,1113,8250,1114,1116,1115,1119,
+  160,1038,1118,1032,164,1168,166,167,1025,169,1028,171,172,173,174,1031,
+  176,177,1030,1110,1169,181,182,183,1105,8470,1108,187,1112,1029,1109,1111,
+  1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,1050,1051,1052,1053,1054,1055,
+  1056,1057,1058,1059,1060,1061,1062,1063,1064,1065,1066,1067,1068,1069,1070,1071,
+  1072,1073,1074,1075,1076,1077,1078,1079,1080,1081,1082,1083,1084,1085,1086,1087,
+  1088,1089,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,1100,1101,1102,1103, },
+ {8364,0,8218,402,8222,8230,8224,8225,710,8240,352,8249,338,0,381,0,
+  0,8216,8217,8220,8221,8226,8211,8212,732,8482,353,8250,339,0,382,376,
+  160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,
+  176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,
+  192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,
+  208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,
+  224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,
+  240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255, },
+ {9472,9474,9484,9488,9492,9496,9500,9508,9516,9524,9532,9600,9604,9608,9612,9616,
+  9617,9618,9619,8992,9632,8729,8730,8776,8804,8805,160,8993,176,178,183,247,
+  9552,9553,9554,1105,9555,9556,9557,9558,9559,9560,9561,9562,9563,9564,9565,9566,
+  9567,9568,9569,1025,9570,9571,9572,9573,9574,9575,9576,9577,9578,9579,9580,169,
+  1102,1072,1073,1094,1076,1077,1092,1075,1093,1080,1081,1082,1083,1084,1085,1086,
+  1087,1103,1088,1089,1090,1091,1078,1074,1100,1099,1079,1096,1101,1097,1095,1098,
+  1070,1040,1041,1062,1044,1045,1060,1043,1061,1048,1049,1050,1051,1052,1053,1054,
+  1055,1071,1056,1057,1058,1059,1046,1042,1068,1067,1047,1064,1069,1065,1063,1066, },
+ {9472,9474,9484,9488,9492,9496,9500,9508,9516,9524,9532,9600,9604,9608,9612,9616,
+  9617,9618,9619,8992,9632,8729,8730,8776,8804,8805,160,8993,176,178,183,247,
+  9552,9553,9554,1105,1108,9556,1110,1111,9559,9560,9561,9562,9563,1169,9565,9566,
+  9567,9568,9569,1025,1028,9571,1030,1031,9574,9575,9576,9577,9578,1168,9580,169,
+  1102,1072,1073,1094,1076,1077,1092,1075,1093,1080,1081,1082,1083,1084,1085,1086,
+  1087,1103,1088,1089,1090,1091,1078,1074,1100,1099,1079,1096,1101,1097,1095,1098,
+  1070,1040,1041,1062,1044,1045,1060,1043,1061,1048,1049,1050,1051,1052,1053,1054,
+  1055,1071,1056,1057,1058,1059,1046,1042,1068,1067,1047,1064,1069,1065,1063,1066, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+  144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,
+  176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,
+  192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,
+  208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,
+  224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,
+  240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+  144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,260,728,321,164,317,346,167,168,352,350,356,377,173,381,379,
+  176,261,731,322,180,318,347,711,184,353,351,357,378,733,382,380,
+  340,193,194,258,196,313,262,199,268,201,280,203,282,205,206,270,
+  272,323,327,211,212,336,214,215,344,366,218,368,220,221,354,223,
+  341,225,226,259,228,314,263,231,269,233,281,235,283,237,238,271,
+  273,324,328,243,244,337,246,247,345,367,250,369,252,253,355,729, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+  144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,1025,1026,1027,1028,1029,1030,1031,1032,1033,1034,1035,1036,173,1038,1039,
+  1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,1050,1051,1052,1053,1054,1055,
+  1056,1057,1058,1059,1060,1061,1062,1063,1064,1065,1066,1067,1068,1069,1070,1071,
+  1072,1073,1074,1075,1076,1077,1078,1079,1080,1081,1082,1083,1084,1085,1086,1087,
+  1088,1089,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,1100,1101,1102,1103,
+  8470,1105,1106,1107,1108,1109,1110,1111,1112,1113,1114,1115,1116,167,1118,1119, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+  144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,161,162,163,8364,165,352,167,353,169,170,171,172,173,174,175,
+  176,177,178,179,381,181,182,183,382,185,186,187,338,339,376,191,
+  192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,
+  208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,
+  224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,
+  240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255, },
+};
+constinit const unsigned mojibake::detail::cpToUtf8[9][256] = {
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x3ac82e2,0x0,0x39a80e2,0x0,0x39e80e2,0x3a680e2,0x3a080e2,0x3a180e2,
+  0x0,0x3b080e2,0x200a0c5,0x3b980e2,0x2009ac5,0x200a4c5,0x200bdc5,0x200b9c5,
+  0x0,0x39880e2,0x39980e2,0x39c80e2,0x39d80e2,0x3a280e2,0x39380e2,0x39480e2,
+  0x0,0x3a284e2,0x200a1c5,0x3ba80e2,0x2009bc5,0x200a5c5,0x200bec5,0x200bac5,
+  0x200a0c2,0x20087cb,0x20098cb,0x20081c5,0x200a4c2,0x20084c4,0x200a6c2,0x200a7c2,
+  0x200a8c2,0x200a9c2,0x2009ec5,0x200abc2,0x200acc2,0x200adc2,0x200aec2,0x200bbc5,
+  0x200b0c2,0x200b1c2,0x2009bcb,0x20082c5,0x200b4c2,0x200b5c2,0x200b6c2,0x200b7c2,
+  0x200b8c2,0x20085c4,0x2009fc5,0x200bbc2,0x200bdc4,0x2009dcb,0x200bec4,0x200bcc5,
+  0x20094c5,0x20081c3,0x20082c3,0x20082c4,0x20084c3,0x200b9c4,0x20086c4,0x20087c3,
+  0x2008cc4,0x20089c3,0x20098c4,0x2008bc3,0x2009ac4,0x2008dc3,0x2008ec3,0x2008ec4,
+  0x20090c4,0x20083c5,0x20087c5,0x20093c3,0x20094c3,0x20090c5,0x20096c3,0x20097c3,
+  0x20098c5,0x200aec5,0x2009ac3,0x200b0c5,0x2009cc3,0x2009dc3,0x200a2c5,0x2009fc3,
+  0x20095c5,0x200a1c3,0x200a2c3,0x20083c4,0x200a4c3,0x200bac4,0x20087c4,0x200a7c3,
+  0x2008dc4,0x200a9c3,0x20099c4,0x200abc3,0x2009bc4,0x200adc3,0x200aec3,0x2008fc4,
+  0x20091c4,0x20084c5,0x20088c5,0x200b3c3,0x200b4c3,0x20091c5,0x200b6c3,0x200b7c3,
+  0x20099c5,0x200afc5,0x200bac3,0x200b1c5,0x200bcc3,0x200bdc3,0x200a3c5,0x20099cb, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x20082d0,0x20083d0,0x39a80e2,0x20093d1,0x39e80e2,0x3a680e2,0x3a080e2,0x3a180e2,
+  0x3ac82e2,0x3b080e2,0x20089d0,0x3b980e2,0x2008ad0,0x2008cd0,0x2008bd0,0x2008fd0,
+  0x20092d1,0x39880e2,0x39980e2,0x39c80e2,0x39d80e2,0x3a280e2,0x39380e2,0x39480e2,
+  0x0,0x3a284e2,0x20099d1,0x3ba80e2,0x2009ad1,0x2009cd1,0x2009bd1,0x2009fd1,
+  0x200a0c2,0x2008ed0,0x2009ed1,0x20088d0,0x200a4c2,0x20090d2,0x200a6c2,0x200a7c2,
+  0x20081d0,0x200a9c2,0x20084d0,0x200abc2,0x200acc2,0x200adc2,0x200aec2,0x20087d0,
+  0x200b0c2,0x200b1c2,0x20086d0,0x20096d1,0x20091d2,0x200b5c2,0x200b6c2,0x200b7c2,
+  0x20091d1,0x39684e2,0x20094d1,0x200bbc2,0x20098d1,0x20085d0,0x20095d1,0x20097d1,
+  0x20090d0,0x20091d0,0x20092d0,0x20093d0,0x20094d0,0x20095d0,0x20096d0,0x20097d0,
+  0x20098d0,0x20099d0,0x2009ad0,0x2009bd0,0x2009cd0,0x2009dd0,0x2009ed0,0x2009fd0,
+  0x200a0d0,0x200a1d0,0x200a2d0,0x200a3d0,0x200a4d0,0x200a5d0,0x200a6d0,0x200a7d0,
+  0x200a8d0,0x200a9d0,0x200aad0,0x200abd0,0x200acd0,0x200add0,0x200aed0,0x200afd0,
+  0x200b0d0,0x200b1d0,0x200b2d0,0x200b3d0,0x200b4d0,0x200b5d0,0x200b6d0,0x200b7d0,
+  0x200b8d0,0x200b9d0,0x200bad0,0x200bbd0,0x200bcd0,0x200bdd0,0x200bed0,0x200bfd0,
+  0x20080d1,0x20081d1,0x20082d1,0x20083d1,0x20084d1,0x20085d1,0x20086d1,0x20087d1,
+  0x20088d1,0x20089d1,0x2008ad1,0x2008bd1,0x2008cd1,0x2008dd1,0x2008ed1,0x2008fd1, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x3ac82e2,0x0,0x39a80e2,0x20092c6,0x39e80e2,0x3a680e2,0x3a080e2,0x3a180e2,
+  0x20086cb,0x3b080e2,0x200a0c5,0x3b980e2,0x20092c5,0x0,0x200bdc5,0x0,
+  0x0,0x39880e2,0x39980e2,0x39c80e2,0x39d80e2,0x3a280e2,0x39380e2,0x39480e2,
+  0x2009ccb,0x3a284e2,0x200a1c5,0x3ba80e2,0x20093c5,0x0,0x200bec5,0x200b8c5,
+  0x200a0c2,0x200a1c2,0x200a2c2,0x200a3c2,0x200a4c2,0x200a5c2,0x200a6c2,0x200a7c2,
+  0x200a8c2,0x200a9c2,0x200aac2,0x200abc2,0x200acc2,0x200adc2,0x200aec2,0x200afc2,
+  0x200b0c2,0x200b1c2,0x200b2c2,0x200b3c2,0x200b4c2,0x200b5c2,0x200b6c2,0x200b7c2,
+  0x200b8c2,0x200b9c2,0x200bac2,0x200bbc2,0x200bcc2,0x200bdc2,0x200bec2,0x200bfc2,
+  0x20080c3,0x20081c3,0x20082c3,0x20083c3,0x20084c3,0x20085c3,0x20086c3,0x20087c3,
+  0x20088c3,0x20089c3,0x2008ac3,0x2008bc3,0x2008cc3,0x2008dc3,0x2008ec3,0x2008fc3,
+  0x20090c3,0x20091c3,0x20092c3,0x20093c3,0x20094c3,0x20095c3,0x20096c3,0x20097c3,
+  0x20098c3,0x20099c3,0x2009ac3,0x2009bc3,0x2009cc3,0x2009dc3,0x2009ec3,0x2009fc3,
+  0x200a0c3,0x200a1c3,0x200a2c3,0x200a3c3,0x200a4c3,0x200a5c3,0x200a6c3,0x200a7c3,
+  0x200a8c3,0x200a9c3,0x200aac3,0x200abc3,0x200acc3,0x200adc3,0x200aec3,0x200afc3,
+  0x200b0c3,0x200b1c3,0x200b2c3,0x200b3c3,0x200b4c3,0x200b5c3,0x200b6c3,0x200b7c3,
+  0x200b8c3,0x200b9c3,0x200bac3,0x200bbc3,0x200bcc3,0x200bdc3,0x200bec3,0x200bfc3, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x38094e2,0x38294e2,0x38c94e2,0x39094e2,0x39494e2,0x39894e2,0x39c94e2,0x3a494e2,
+  0x3ac94e2,0x3b494e2,0x3bc94e2,0x38096e2,0x38496e2,0x38896e2,0x38c96e2,0x39096e2,
+  0x39196e2,0x39296e2,0x39396e2,0x3a08ce2,0x3a096e2,0x39988e2,0x39a88e2,0x38889e2,
+  0x3a489e2,0x3a589e2,0x200a0c2,0x3a18ce2,0x200b0c2,0x200b2c2,0x200b7c2,0x200b7c3,
+  0x39095e2,0x39195e2,0x39295e2,0x20091d1,0x39395e2,0x39495e2,0x39595e2,0x39695e2,
+  0x39795e2,0x39895e2,0x39995e2,0x39a95e2,0x39b95e2,0x39c95e2,0x39d95e2,0x39e95e2,
+  0x39f95e2,0x3a095e2,0x3a195e2,0x20081d0,0x3a295e2,0x3a395e2,0x3a495e2,0x3a595e2,
+  0x3a695e2,0x3a795e2,0x3a895e2,0x3a995e2,0x3aa95e2,0x3ab95e2,0x3ac95e2,0x200a9c2,
+  0x2008ed1,0x200b0d0,0x200b1d0,0x20086d1,0x200b4d0,0x200b5d0,0x20084d1,0x200b3d0,
+  0x20085d1,0x200b8d0,0x200b9d0,0x200bad0,0x200bbd0,0x200bcd0,0x200bdd0,0x200bed0,
+  0x200bfd0,0x2008fd1,0x20080d1,0x20081d1,0x20082d1,0x20083d1,0x200b6d0,0x200b2d0,
+  0x2008cd1,0x2008bd1,0x200b7d0,0x20088d1,0x2008dd1,0x20089d1,0x20087d1,0x2008ad1,
+  0x200aed0,0x20090d0,0x20091d0,0x200a6d0,0x20094d0,0x20095d0,0x200a4d0,0x20093d0,
+  0x200a5d0,0x20098d0,0x20099d0,0x2009ad0,0x2009bd0,0x2009cd0,0x2009dd0,0x2009ed0,
+  0x2009fd0,0x200afd0,0x200a0d0,0x200a1d0,0x200a2d0,0x200a3d0,0x20096d0,0x20092d0,
+  0x200acd0,0x200abd0,0x20097d0,0x200a8d0,0x200add0,0x200a9d0,0x200a7d0,0x200aad0, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x38094e2,0x38294e2,0x38c94e2,0x39094e2,0x39494e2,0x39894e2,0x39c94e2,0x3a494e2,
+  0x3ac94e2,0x3b494e2,0x3bc94e2,0x38096e2,0x38496e2,0x38896e2,0x38c96e2,0x39096e2,
+  0x39196e2,0x39296e2,0x39396e2,0x3a08ce2,0x3a096e2,0x39988e2,0x39a88e2,0x38889e2,
+  0x3a489e2,0x3a589e2,0x200a0c2,0x3a18ce2,0x200b0c2,0x200b2c2,0x200b7c2,0x200b7c3,
+  0x39095e2,0x39195e2,0x39295e2,0x20091d1,0x20094d1,0x39495e2,0x20096d1,0x20097d1,
+  0x39795e2,0x39895e2,0x39995e2,0x39a95e2,0x39b95e2,0x20091d2,0x39d95e2,0x39e95e2,
+  0x39f95e2,0x3a095e2,0x3a195e2,0x20081d0,0x20084d0,0x3a395e2,0x20086d0,0x20087d0,
+  0x3a695e2,0x3a795e2,0x3a895e2,0x3a995e2,0x3aa95e2,0x20090d2,0x3ac95e2,0x200a9c2,
+  0x2008ed1,0x200b0d0,0x200b1d0,0x20086d1,0x200b4d0,0x200b5d0,0x20084d1,0x200b3d0,
+  0x20085d1,0x200b8d0,0x200b9d0,0x200bad0,0x200bbd0,0x200bcd0,0x200bdd0,0x200bed0,
+  0x200bfd0,0x2008fd1,0x20080d1,0x20081d1,0x20082d1,0x20083d1,0x200b6d0,0x200b2d0,
+  0x2008cd1,0x2008bd1,0x200b7d0,0x20088d1,0x2008dd1,0x20089d1,0x20087d1,0x2008ad1,
+  0x200aed0,0x20090d0,0x20091d0,0x200a6d0,0x20094d0,0x20095d0,0x200a4d0,0x20093d0,
+  0x200a5d0,0x20098d0,0x20099d0,0x2009ad0,0x2009bd0,0x2009cd0,0x2009dd0,0x2009ed0,
+  0x2009fd0,0x200afd0,0x200a0d0,0x200a1d0,0x200a2d0,0x200a3d0,0x20096d0,0x20092d0,
+  0x200acd0,0x200abd0,0x20097d0,0x200a8d0,0x200add0,0x200a9d0,0x200a7d0,0x200aad0, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x20080c2,0x20081c2,0x20082c2,0x20083c2,0x20084c2,0x20085c2,0x20086c2,0x20087c2,
+  0x20088c2,0x20089c2,0x2008ac2,0x2008bc2,0x2008cc2,0x2008dc2,0x2008ec2,0x2008fc2,
+  0x20090c2,0x20091c2,0x20092c2,0x20093c2,0x20094c2,0x20095c2,0x20096c2,0x20097c2,
+  0x20098c2,0x20099c2,0x2009ac2,0x2009bc2,0x2009cc2,0x2009dc2,0x2009ec2,0x2009fc2,
+  0x200a0c2,0x200a1c2,0x200a2c2,0x200a3c2,0x200a4c2,0x200a5c2,0x200a6c2,0x200a7c2,
+  0x200a8c2,0x200a9c2,0x200aac2,0x200abc2,0x200acc2,0x200adc2,0x200aec2,0x200afc2,
+  0x200b0c2,0x200b1c2,0x200b2c2,0x200b3c2,0x200b4c2,0x200b5c2,0x200b6c2,0x200b7c2,
+  0x200b8c2,0x200b9c2,0x200bac2,0x200bbc2,0x200bcc2,0x200bdc2,0x200bec2,0x200bfc2,
+  0x20080c3,0x20081c3,0x20082c3,0x20083c3,0x20084c3,0x20085c3,0x20086c3,0x20087c3,
+  0x20088c3,0x20089c3,0x2008ac3,0x2008bc3,0x2008cc3,0x2008dc3,0x2008ec3,0x2008fc3,
+  0x20090c3,0x20091c3,0x20092c3,0x20093c3,0x20094c3,0x20095c3,0x20096c3,0x20097c3,
+  0x20098c3,0x20099c3,0x2009ac3,0x2009bc3,0x2009cc3,0x2009dc3,0x2009ec3,0x2009fc3,
+  0x200a0c3,0x200a1c3,0x200a2c3,0x200a3c3,0x200a4c3,0x200a5c3,0x200a6c3,0x200a7c3,
+  0x200a8c3,0x200a9c3,0x200aac3,0x200abc3,0x200acc3,0x200adc3,0x200aec3,0x200afc3,
+  0x200b0c3,0x200b1c3,0x200b2c3,0x200b3c3,0x200b4c3,0x200b5c3,0x200b6c3,0x200b7c3,
+  0x200b8c3,0x200b9c3,0x200bac3,0x200bbc3,0x200bcc3,0x200bdc3,0x200bec3,0x200bfc3, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x20080c2,0x20081c2,0x20082c2,0x20083c2,0x20084c2,0x20085c2,0x20086c2,0x20087c2,
+  0x20088c2,0x20089c2,0x2008ac2,0x2008bc2,0x2008cc2,0x2008dc2,0x2008ec2,0x2008fc2,
+  0x20090c2,0x20091c2,0x20092c2,0x20093c2,0x20094c2,0x20095c2,0x20096c2,0x20097c2,
+  0x20098c2,0x20099c2,0x2009ac2,0x2009bc2,0x2009cc2,0x2009dc2,0x2009ec2,0x2009fc2,
+  0x200a0c2,0x20084c4,0x20098cb,0x20081c5,0x200a4c2,0x200bdc4,0x2009ac5,0x200a7c2,
+  0x200a8c2,0x200a0c5,0x2009ec5,0x200a4c5,0x200b9c5,0x200adc2,0x200bdc5,0x200bbc5,
+  0x200b0c2,0x20085c4,0x2009bcb,0x20082c5,0x200b4c2,0x200bec4,0x2009bc5,0x20087cb,
+  0x200b8c2,0x200a1c5,0x2009fc5,0x200a5c5,0x200bac5,0x2009dcb,0x200bec5,0x200bcc5,
+  0x20094c5,0x20081c3,0x20082c3,0x20082c4,0x20084c3,0x200b9c4,0x20086c4,0x20087c3,
+  0x2008cc4,0x20089c3,0x20098c4,0x2008bc3,0x2009ac4,0x2008dc3,0x2008ec3,0x2008ec4,
+  0x20090c4,0x20083c5,0x20087c5,0x20093c3,0x20094c3,0x20090c5,0x20096c3,0x20097c3,
+  0x20098c5,0x200aec5,0x2009ac3,0x200b0c5,0x2009cc3,0x2009dc3,0x200a2c5,0x2009fc3,
+  0x20095c5,0x200a1c3,0x200a2c3,0x20083c4,0x200a4c3,0x200bac4,0x20087c4,0x200a7c3,
+  0x2008dc4,0x200a9c3,0x20099c4,0x200abc3,0x2009bc4,0x200adc3,0x200aec3,0x2008fc4,
+  0x20091c4,0x20084c5,0x20088c5,0x200b3c3,0x200b4c3,0x20091c5,0x200b6c3,0x200b7c3,
+  0x20099c5,0x200afc5,0x200bac3,0x200b1c5,0x200bcc3,0x200bdc3,0x200a3c5,0x20099cb, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x20080c2,0x20081c2,0x20082c2,0x20083c2,0x20084c2,0x20085c2,0x20086c2,0x20087c2,
+  0x20088c2,0x20089c2,0x2008ac2,0x2008bc2,0x2008cc2,0x2008dc2,0x2008ec2,0x2008fc2,
+  0x20090c2,0x20091c2,0x20092c2,0x20093c2,0x20094c2,0x20095c2,0x20096c2,0x20097c2,
+  0x20098c2,0x20099c2,0x2009ac2,0x2009bc2,0x2009cc2,0x2009dc2,0x2009ec2,0x2009fc2,
+  0x200a0c2,0x20081d0,0x20082d0,0x20083d0,0x20084d0,0x20085d0,0x20086d0,0x20087d0,
+  0x20088d0,0x20089d0,0x2008ad0,0x2008bd0,0x2008cd0,0x200adc2,0x2008ed0,0x2008fd0,
+  0x20090d0,0x20091d0,0x20092d0,0x20093d0,0x20094d0,0x20095d0,0x20096d0,0x20097d0,
+  0x20098d0,0x20099d0,0x2009ad0,0x2009bd0,0x2009cd0,0x2009dd0,0x2009ed0,0x2009fd0,
+  0x200a0d0,0x200a1d0,0x200a2d0,0x200a3d0,0x200a4d0,0x200a5d0,0x200a6d0,0x200a7d0,
+  0x200a8d0,0x200a9d0,0x200aad0,0x200abd0,0x200acd0,0x200add0,0x200aed0,0x200afd0,
+  0x200b0d0,0x200b1d0,0x200b2d0,0x200b3d0,0x200b4d0,0x200b5d0,0x200b6d0,0x200b7d0,
+  0x200b8d0,0x200b9d0,0x200bad0,0x200bbd0,0x200bcd0,0x200bdd0,0x200bed0,0x200bfd0,
+  0x20080d1,0x20081d1,0x20082d1,0x20083d1,0x20084d1,0x20085d1,0x20086d1,0x20087d1,
+  0x20088d1,0x20089d1,0x2008ad1,0x2008bd1,0x2008cd1,0x2008dd1,0x2008ed1,0x2008fd1,
+  0x39684e2,0x20091d1,0x20092d1,0x20093d1,0x20094d1,0x20095d1,0x20096d1,0x20097d1,
+  0x20098d1,0x20099d1,0x2009ad1,0x2009bd1,0x2009cd1,0x200a7c2,0x2009ed1,0x2009fd1, },
+ {0x1000000,0x1000001,0x1000002,0x1000003,0x1000004,0x1000005,0x1000006,0x1000007,
+  0x1000008,0x1000009,0x100000a,0x100000b,0x100000c,0x100000d,0x100000e,0x100000f,
+  0x1000010,0x1000011,0x1000012,0x1000013,0x1000014,0x1000015,0x1000016,0x1000017,
+  0x1000018,0x1000019,0x100001a,0x100001b,0x100001c,0x100001d,0x100001e,0x100001f,
+  0x1000020,0x1000021,0x1000022,0x1000023,0x1000024,0x1000025,0x1000026,0x1000027,
+  0x1000028,0x1000029,0x100002a,0x100002b,0x100002c,0x100002d,0x100002e,0x100002f,
+  0x1000030,0x1000031,0x1000032,0x1000033,0x1000034,0x1000035,0x1000036,0x1000037,
+  0x1000038,0x1000039,0x100003a,0x100003b,0x100003c,0x100003d,0x100003e,0x100003f,
+  0x1000040,0x1000041,0x1000042,0x1000043,0x1000044,0x1000045,0x1000046,0x1000047,
+  0x1000048,0x1000049,0x100004a,0x100004b,0x100004c,0x100004d,0x100004e,0x100004f,
+  0x1000050,0x1000051,0x1000052,0x1000053,0x1000054,0x1000055,0x1000056,0x1000057,
+  0x1000058,0x1000059,0x100005a,0x100005b,0x100005c,0x100005d,0x100005e,0x100005f,
+  0x1000060,0x1000061,0x1000062,0x1000063,0x1000064,0x1000065,0x1000066,0x1000067,
+  0x1000068,0x1000069,0x100006a,0x100006b,0x100006c,0x100006d,0x100006e,0x100006f,
+  0x1000070,0x1000071,0x1000072,0x1000073,0x1000074,0x1000075,0x1000076,0x1000077,
+  0x1000078,0x1000079,0x100007a,0x100007b,0x100007c,0x100007d,0x100007e,0x100007f,
+  0x20080c2,0x20081c2,0x20082c2,0x20083c2,0x20084c2,0x20085c2,0x20086c2,0x20087c2,
+  0x20088c2,0x20089c2,0x2008ac2,0x2008bc2,0x2008cc2,0x2008dc2,0x2008ec2,0x2008fc2,
+  0x20090c2,0x20091c2,0x20092c2,0x20093c2,0x20094c2,0x20095c2,0x20096c2,0x20097c2,
+  0x20098c2,0x20099c2,0x2009ac2,0x2009bc2,0x2009cc2,0x2009dc2,0x2009ec2,0x2009fc2,
+  0x200a0c2,0x200a1c2,0x200a2c2,0x200a3c2,0x3ac82e2,0x200a5c2,0x200a0c5,0x200a7c2,
+  0x200a1c5,0x200a9c2,0x200aac2,0x200abc2,0x200acc2,0x200adc2,0x200aec2,0x200afc2,
+  0x200b0c2,0x200b1c2,0x200b2c2,0x200b3c2,0x200bdc5,0x200b5c2,0x200b6c2,0x200b7c2,
+  0x200bec5,0x200b9c2,0x200bac2,0x200bbc2,0x20092c5,0x20093c5,0x200b8c5,0x200bfc2,
+  0x20080c3,0x20081c3,0x20082c3,0x20083c3,0x20084c3,0x20085c3,0x20086c3,0x20087c3,
+  0x20088c3,0x20089c3,0x2008ac3,0x2008bc3,0x2008cc3,0x2008dc3,0x2008ec3,0x2008fc3,
+  0x20090c3,0x20091c3,0x20092c3,0x20093c3,0x20094c3,0x20095c3,0x20096c3,0x20097c3,
+  0x20098c3,0x20099c3,0x2009ac3,0x2009bc3,0x2009cc3,0x2009dc3,0x2009ec3,0x2009fc3,
+  0x200a0c3,0x200a1c3,0x200a2c3,0x200a3c3,0x200a4c3,0x200a5c3,0x200a6c3,0x200a7c3,
+  0x200a8c3,0x200a9c3,0x200aac3,0x200abc3,0x200acc3,0x200adc3,0x200aec3,0x200afc3,
+  0x200b0c3,0x200b1c3,0x200b2c3,0x200b3c3,0x200b4c3,0x200b5c3,0x200b6c3,0x200b7c3,
+  0x200b8c3,0x200b9c3,0x200bac3,0x200bbc3,0x200bcc3,0x200bdc3,0x200bec3,0x200bfc3, },
+};
+constinit const unsigned char mojibake::detail::cpFromUnicodeBlocks[46][64] = {
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  160,0,0,0,164,0,166,167,168,169,0,171,172,173,174,0,176,177,0,0,180,181,182,183,184,0,0,187,0,0,0,0, },
+ {0,193,194,0,196,0,0,199,0,201,0,203,0,205,206,0,0,0,0,211,212,0,214,215,0,0,218,0,220,221,0,223,
+  0,225,226,0,228,0,0,231,0,233,0,235,0,237,238,0,0,0,0,243,244,0,246,247,0,0,250,0,252,253,0,0, },
+ {0,0,195,227,165,185,198,230,0,0,0,0,200,232,207,239,208,240,0,0,0,0,0,0,202,234,204,236,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,197,229,0,0,188,190,0, },
+ {0,163,179,209,241,0,0,210,242,0,0,0,0,0,0,0,213,245,0,0,192,224,0,0,216,248,140,156,0,0,170,186,
+  138,154,222,254,141,157,0,0,0,0,0,0,0,0,217,249,219,251,0,0,0,0,0,0,0,143,159,175,191,142,158,0, },
+ {0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,255,0,178,0,189,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,151,0,0,0,145,146,130,0,147,148,132,0,
+  134,135,149,0,0,0,133,0,0,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,0,139,155,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  160,0,0,0,164,0,166,167,0,169,0,171,172,173,174,0,176,177,0,0,0,181,182,183,0,0,0,187,0,0,0,0, },
+ {0,168,128,129,170,189,178,175,163,138,140,142,141,0,161,143,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,
+  208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239, },
+ {240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,0,184,144,131,186,190,179,191,188,154,156,158,157,0,162,159,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,185,0,0,0,0,0,0,0,0,0,
+  0,0,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191, },
+ {192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,
+  224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,156,0,0,0,0,0,0,0,0,0,0,0,0,
+  138,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,0,0,0,0,142,158,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  154,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,156,0,157,0,0,0,0,158,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,0,0,0,0,0,0,0,0, },
+ {0,179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,226,247,231,228,229,246,250,233,234,235,236,237,238,239,240,
+  242,243,244,245,230,232,227,254,251,253,255,249,248,252,224,241,193,194,215,199,196,197,214,218,201,202,203,204,205,206,207,208, },
+ {210,211,212,213,198,200,195,222,219,221,223,217,216,220,192,209,0,163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,150,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,152,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  147,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {128,0,129,0,0,0,0,0,0,0,0,0,130,0,0,0,131,0,0,0,132,0,0,0,133,0,0,0,134,0,0,0,
+  0,0,0,0,135,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,138,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,161,162,164,165,166,167,168,169,170,171,172,173,174,175,176,
+  177,178,180,181,182,183,184,185,186,187,188,189,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {139,0,0,0,140,0,0,0,141,0,0,0,142,0,0,0,143,144,145,146,0,0,0,0,0,0,0,0,0,0,0,0,
+  148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,179,0,0,180,0,182,183,0,0,0,0,0,0,0,0,225,226,247,231,228,229,246,250,233,234,235,236,237,238,239,240,
+  242,243,244,245,230,232,227,254,251,253,255,249,248,252,224,241,193,194,215,199,196,197,214,218,201,202,203,204,205,206,207,208, },
+ {210,211,212,213,198,200,195,222,219,221,223,217,216,220,192,209,0,163,0,0,164,0,166,167,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,189,173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,161,162,0,165,0,0,168,169,170,171,172,0,174,175,176,
+  177,178,0,181,0,0,184,185,186,187,188,0,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,0,0,0,164,0,0,167,168,0,0,0,0,173,0,0,176,0,0,0,180,0,0,0,184,0,0,0,0,0,0,0, },
+ {0,0,195,227,161,177,198,230,0,0,0,0,200,232,207,239,208,240,0,0,0,0,0,0,202,234,204,236,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,197,229,0,0,165,181,0, },
+ {0,163,179,209,241,0,0,210,242,0,0,0,0,0,0,0,213,245,0,0,192,224,0,0,216,248,166,182,0,0,170,186,
+  169,185,222,254,171,187,0,0,0,0,0,0,0,0,217,249,219,251,0,0,0,0,0,0,0,172,188,175,191,174,190,0, },
+ {0,0,0,0,0,0,0,183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,255,0,178,0,189,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,0,0,0,0,0,0,253,0,0,0,0,0,173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,161,162,163,164,165,166,167,168,169,170,171,172,0,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,
+  192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223, },
+ {224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,0,241,242,243,244,245,246,247,248,249,250,251,252,0,254,255,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+  160,161,162,163,0,165,0,167,0,169,170,171,172,173,174,175,176,177,178,179,0,181,182,183,0,185,186,187,0,0,0,191, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,189,0,0,0,0,0,0,0,0,0,0,0,0,
+  166,168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,0,0,0,0,180,184,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+};
+constinit const unsigned char mojibake::detail::cpFromUnicodeLookup[9][151] = {
+ {0,0,1,2,3,4,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  6,0,7,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,10,11,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  6,0,13,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,15,16,0,17,18,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  6,0,7,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,20,21,0,0,0,0,0,0,0,0,0,0,0,0,22,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,24,25,0,0,26,0,0,0,0,0,0,0,27,28,29, },
+ {0,0,20,21,0,0,0,0,0,0,0,0,0,0,0,0,30,31,32,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,24,25,0,0,26,0,0,0,0,0,0,0,27,33,29, },
+ {0,0,34,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,35,2,36,37,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,40,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,43,16,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+};
+constinit const signed char mojibake::detail::cpDetectWeights[9][128] = {
+ {0,-100,0,-100,0,0,0,0,-100,0,1,0,1,1,1,1,-100,0,0,0,0,0,0,0,-100,0,4,0,4,2,4,2,
+  0,0,0,1,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,4,0,2,0,0,0,4,4,0,1,0,2,4,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,2,
+  2,4,2,2,2,2,4,2,4,4,4,2,4,4,2,2,2,4,2,4,4,4,4,0,4,4,4,4,4,4,4,0, },
+ {1,1,0,2,0,0,0,0,0,0,1,0,1,1,1,1,2,0,0,0,0,0,0,0,-100,0,2,0,2,2,2,2,
+  0,1,2,1,0,1,0,0,1,0,1,0,0,0,0,1,0,0,1,4,2,2,0,0,2,0,4,0,2,1,2,4,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  4,2,4,2,4,4,2,2,4,2,4,4,4,4,4,4,4,4,4,4,2,2,2,2,2,2,2,4,2,2,2,4, },
+ {0,-100,0,2,0,0,0,0,0,0,1,0,1,-100,1,-100,-100,0,0,0,0,0,0,0,0,0,2,0,4,-100,2,1,
+  0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,4,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,4,
+  4,4,4,4,4,2,2,4,4,4,4,2,2,4,2,2,2,4,2,4,4,4,4,0,2,4,4,2,4,2,2,2, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+  2,4,2,2,4,4,2,2,2,4,2,4,4,4,4,4,4,4,4,4,4,4,2,4,2,4,2,2,2,2,2,2,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,2,4,0,4,4,0,0,0,0,0,2,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,1,0,0,
+  2,4,2,2,4,4,2,2,2,4,2,4,4,4,4,4,4,4,4,4,4,4,2,4,2,4,2,2,2,2,2,2,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, },
+ {-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,
+  0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,4,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,4,
+  4,4,4,4,4,2,2,4,4,4,4,2,2,4,2,2,2,4,2,4,4,4,4,0,2,4,4,2,4,2,2,2, },
+ {-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,
+  0,1,0,1,0,1,1,0,0,1,1,1,1,0,1,1,0,4,0,4,0,2,4,0,0,4,4,2,2,0,4,4,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,2,
+  2,4,2,2,2,2,4,2,4,4,4,2,4,4,2,2,2,4,2,4,4,4,4,0,4,4,4,4,4,4,4,0, },
+ {-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,
+  0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,2,4,2,4,4,2,2,4,2,4,4,4,4,4,4,
+  4,4,4,4,2,2,2,2,2,2,2,4,2,2,2,4,0,2,2,2,4,2,4,4,2,2,2,2,2,0,2,2, },
+ {-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,-50,
+  0,4,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,1,2,0,0,2,0,0,0,1,4,1,4,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,4,
+  4,4,4,4,4,2,2,4,4,4,4,2,2,4,2,2,2,4,2,4,4,4,4,0,2,4,4,2,4,2,2,2, },
+};
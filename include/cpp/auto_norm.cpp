@@ -0,0 +1,2622 @@
+// This file is autogenerated!
+#include "../internal/auto.hpp"
+constinit const unsigned char mojibake::detail::cccBlocks[128][32] = {
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,232,220,220,220,220,232,216,220,220,220,220, },
+ {220,202,202,220,220,220,220,202,202,220,220,220,220,220,220,220,220,220,220,220,1,1,1,1,1,220,220,220,220,230,230,230, },
+ {230,230,230,230,230,240,230,220,220,220,230,230,230,220,220,0,230,230,230,220,220,220,220,230,232,220,220,230,233,234,234,233, },
+ {234,234,233,230,230,230,230,230,230,230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,230,230,230,230,220,230,230,230,222,220,230,230,230,230, },
+ {230,230,220,220,220,220,220,220,230,230,220,230,230,222,228,230,10,11,12,13,14,15,16,17,18,19,19,20,21,22,0,23, },
+ {0,24,25,0,230,220,0,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,230,230,230,30,31,32,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,27,28,29,30,31,32,33,34,230,230,220,220,230,230,230,230,230,220,230,230,220, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,230, },
+ {230,230,230,220,230,0,0,230,230,0,220,230,230,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,220,230,230,220,230,230,220,220,220,230,220,220,230,220,230, },
+ {230,230,220,230,220,230,220,230,220,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,230,230,220,230,0,0,0,0,0,0,0,0,0,220,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,0,230,230,230,230,230, },
+ {230,230,230,230,0,230,230,230,0,230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,220,220,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,220,220,220,230,230,230,230, },
+ {0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,220,220,220,220,220,230,230,230,230,230,230,230,230,230,230,230,230, },
+ {230,230,0,220,230,230,220,230,230,220,230,230,230,220,220,220,27,28,29,230,230,230,220,230,230,220,220,230,230,230,230,230, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,230,220,230,230,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,84,91,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,103,9,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,107,107,107,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,118,9,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,122,122,122,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,220,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,220,0,216,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,130,0,132,0,0,0,0,0,130,130,130,130,0,0, },
+ {130,0,230,230,9,0,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,9,9,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,230,0,0, },
+ {0,0,0,0,0,0,0,0,0,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,222,230,220,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,220,0,0,0,0,0,0,0, },
+ {9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,230,230,230,0,0,220, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,220,220,220,220,220,220,230,230,220,0,220, },
+ {220,230,230,220,220,230,230,230,230,230,220,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,230,220,230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,0,1,220,220,220,220,220,230,230,220,220,220,220, },
+ {230,0,1,1,1,1,1,1,1,0,0,0,0,220,0,0,0,0,0,0,230,0,0,0,230,230,0,0,0,0,0,0, },
+ {230,230,220,230,230,230,230,230,230,230,220,230,230,234,214,220,202,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230, },
+ {230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,232,228,228,220,218,230,233,220,230,220, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,1,1,230,230,230,230,1,1,1,230,230,0,0,0, },
+ {0,230,0,0,0,1,1,230,220,230,1,1,220,220,220,220,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9, },
+ {230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230, },
+ {0,0,0,0,0,0,0,0,0,0,218,228,232,222,224,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,8,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,0,0,0,230,230,230,230,230,230,230,230,230,230,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,220,220,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,230,230,220,0,0,230,230,0,0,0,0,0,230,230, },
+ {0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0, },
+ {230,230,230,230,230,230,230,220,220,220,220,220,220,220,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0, },
+ {220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,1,220,0,0,0,0,9, },
+ {0,0,0,0,0,230,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,220,220,230,230,230,220,230,220,220,220,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,230,220,230,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,7,0,0,0,0,0, },
+ {230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0, },
+ {9,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,7,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,0,0,0, },
+ {0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,0,230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,9,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0, },
+ {0,0,9,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,7,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,0, },
+ {0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0, },
+ {0,0,7,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0, },
+ {0,0,0,0,0,216,216,1,1,1,0,0,0,226,216,216,216,216,216,0,0,0,0,0,0,0,0,220,220,220,220,220, },
+ {220,220,220,0,0,230,230,230,230,230,220,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {230,230,230,230,230,230,230,0,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,0,0,230,230,230,230,230, },
+ {230,230,0,230,230,0,230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,220,220,220,220,220,220,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,230,230,230,230,230,230,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+};
+constinit const unsigned char mojibake::detail::cccLookup[3915] {
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,1,2,3,4,0,0,0,0,
+ 0,0,0,0,5,0,0,0,0,0,0,0,6,7,8,0,
+ 9,0,10,11,0,0,12,13,14,15,16,0,0,0,0,17,
+ 18,19,20,0,21,0,22,23,0,24,25,0,0,24,26,27,
+ 0,24,26,0,0,24,26,0,0,24,26,0,0,0,26,0,
+ 0,24,28,0,0,24,26,0,0,29,26,0,0,0,30,0,
+ 0,31,32,0,0,33,34,0,35,36,0,37,38,0,39,0,
+ 0,40,0,0,41,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,43,44,0,0,0,0,45,0,
+ 0,0,0,0,0,46,0,0,0,47,0,0,0,0,0,0,
+ 48,0,0,49,0,50,51,0,0,52,53,54,0,55,0,56,
+ 0,57,0,0,0,0,58,59,0,0,0,0,0,0,60,61,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,62,63,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,64,0,0,0,65,0,0,0,66,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,67,0,0,68,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,69,70,0,0,71,0,0,0,0,0,0,0,0,
+ 72,73,0,0,0,0,53,74,0,75,76,0,0,77,78,0,
+ 0,0,0,0,0,79,80,81,0,0,0,0,0,0,0,26,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,
+ 0,0,0,0,0,0,0,85,0,0,0,86,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 87,88,0,0,0,0,0,89,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,
+ 0,0,0,0,0,91,0,0,0,0,92,0,93,0,0,0,
+ 0,0,72,94,0,95,0,0,96,97,0,77,0,0,98,0,
+ 0,99,0,0,0,0,0,100,0,101,26,102,0,0,0,0,
+ 0,0,103,0,0,0,104,0,0,0,0,0,0,65,105,0,
+ 0,65,0,0,0,106,0,0,0,107,0,0,0,0,0,0,
+ 0,95,0,0,0,0,0,0,0,108,109,0,0,0,0,78,
+ 0,44,110,0,111,0,0,0,0,0,0,0,0,0,0,0,
+ 0,65,0,0,0,0,0,0,0,0,112,0,113,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,114,0,115,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,117,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,118,119,120,0,0,
+ 0,0,121,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 122,123,0,0,0,0,0,0,0,115,0,0,0,0,0,0,
+ 0,0,0,0,0,124,0,125,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,126,0,0,0,127,
+};
+constinit const unsigned char mojibake::detail::normFlagsBlocks[133][64] = {
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  40,0,0,0,0,0,0,0,40,0,40,0,0,0,0,40,0,0,40,40,40,40,0,0,40,40,40,0,40,40,40,0, },
+ {48,48,48,48,48,48,0,48,48,48,48,48,48,48,48,48,0,48,48,48,48,48,48,0,0,48,48,48,48,48,0,0,
+  48,48,48,48,48,48,0,48,48,48,48,48,48,48,48,48,0,48,48,48,48,48,48,0,0,48,48,48,48,48,0,48, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,48,48,48,0,0,48,48,48,48,48,48,48,48,48,0,40,40,48,48,48,48,0,48,48,48,48,48,48,40, },
+ {40,0,0,48,48,48,48,48,48,40,0,0,48,48,48,48,48,48,0,0,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,48,48,48,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,40, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,40,40,40,40,40,40,40,40,40,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,48,
+  48,48,48,48,0,0,48,48,48,48,48,48,48,48,48,48,48,40,40,40,48,48,0,0,48,48,48,48,48,48,48,48, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,48,48,
+  0,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,0,0,
+  40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {5,5,5,5,5,0,5,5,5,5,5,5,5,0,0,5,0,5,0,5,5,0,0,0,0,0,0,5,0,0,0,0,
+  0,0,0,5,5,5,5,5,5,0,0,0,0,5,5,0,5,5,0,0,0,0,0,0,5,0,0,0,0,0,0,0, },
+ {58,58,5,58,58,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,40,0,0,0,58,0, },
+ {0,0,0,0,40,56,48,58,48,48,48,0,48,0,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,48,48,48,48,48,0,40,40,40,56,56,40,40,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,0,40,40,0,0,0,40,0,0,0,0,0,0, },
+ {48,48,0,48,0,0,0,48,0,0,0,0,48,48,48,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,48,0,48,0,0,0,48,0,0,0,0,48,48,48,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0, },
+ {0,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,48,48,48,48,0,0,48,48,0,0,48,48,48,48,48,48,
+  0,0,48,48,48,48,48,48,0,0,48,48,48,48,48,48,48,48,48,48,48,48,0,0,48,48,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,48,48,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,0,0,0,0,0,0,0, },
+ {48,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,48,0,0,48,0,0,0,0,0,0,0,5,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,58,58,58,58,58,58,58,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,58,58,0,58,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,58,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,58,58,0,0,58,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,48,0,0,48,48,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,58,58,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0, },
+ {0,0,0,0,0,0,0,0,0,0,48,48,48,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {48,0,5,0,0,0,0,48,48,0,48,48,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,48,0,48,48,48,5,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,58,0,0,0,0,0,0,0,0,0,58,0,0,0,0,58,0,0,0,0,58,0,0,0,0,58,0,0,0,
+  0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,58,0,58,58,40,58,40,0,0,0,0,0,0, },
+ {0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,58,0,0,
+  0,0,58,0,0,0,0,58,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,48,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, },
+ {5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,48,0,48,0,48,0,48,0,48,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,48,0,48,0,0, },
+ {48,48,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,40,56,0,0,0,0,
+  48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,0,0,0,0, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,48,48,48,48,48,48,0,0,
+  48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48, },
+ {48,48,48,48,48,48,0,0,48,48,48,48,48,48,0,0,48,48,48,48,48,48,48,48,0,48,0,48,0,48,0,48,
+  48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,58,48,58,48,58,48,58,48,58,48,58,48,58,0,0, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,48,48,48,48,58,48,40,58,40, },
+ {40,56,48,48,48,0,48,48,48,58,48,58,48,56,56,56,48,48,48,58,0,0,48,48,48,48,48,58,0,56,56,56,
+  48,48,48,58,48,48,48,48,48,48,48,58,48,56,58,58,0,0,48,48,48,0,48,48,48,58,48,58,48,58,40,0, },
+ {58,58,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,40,0,0,0,0,0,40,0,0,0,0,0,0,0,0,
+  0,0,0,0,40,40,40,0,0,0,0,0,0,0,0,40,0,0,0,40,40,0,40,40,0,0,0,0,40,0,40,0, },
+ {0,0,0,0,0,0,0,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,40,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,0,0,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,
+  0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {40,40,40,40,0,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,0,40,40,0,0,40,40,40,40,40,0,0,
+  40,40,40,0,40,0,58,0,40,0,58,58,40,40,0,40,40,40,0,40,40,40,40,40,40,40,0,40,40,40,40,40, },
+ {40,0,0,0,0,40,40,40,40,40,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,48,0,0,0,0,48,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,48,0,48,0,0,0,0,0,40,40,0,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,48,0,0,48,0,0,48,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  48,0,48,0,0,0,0,0,0,0,0,0,0,48,48,48,48,48,0,0,48,48,0,0,48,48,0,0,0,0,0,0, },
+ {48,48,0,0,48,48,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,48,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  48,48,48,48,0,0,0,0,0,0,48,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,58,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,40,40,40,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0,
+  48,0,48,0,0,48,0,48,0,48,0,0,0,0,0,0,48,48,0,48,48,0,48,48,0,48,48,0,48,48,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,5,5,40,40,0,48,40,
+  0,0,0,0,0,0,0,0,0,0,0,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0,48,0, },
+ {48,0,48,0,0,48,0,48,0,48,0,0,0,0,0,0,48,48,0,48,48,0,48,48,0,48,48,0,48,48,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,48,48,48,48,0,0,0,48,40, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,0,0,0,40,40,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,
+  0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+  58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58, },
+ {58,58,58,58,58,58,58,58,58,58,58,58,58,58,0,0,58,0,58,0,0,58,58,58,58,58,58,58,58,58,58,0,
+  58,0,58,0,0,58,58,0,0,0,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58, },
+ {58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+  58,58,58,58,58,58,58,58,58,58,58,58,58,58,0,0,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58, },
+ {58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,0,0,0,0,0,58,0,58,
+  40,40,40,40,40,40,40,40,40,40,58,58,58,58,58,58,58,58,58,58,58,58,58,0,58,58,58,58,58,0,58,0, },
+ {58,58,0,58,58,0,58,58,58,58,58,58,58,58,58,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,0,0,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,0,40,40,40,40,0,0,0,0,40,40,40,0,40,0,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0, },
+ {0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0, },
+ {0,0,40,40,40,40,40,40,0,0,40,40,40,40,40,40,0,0,40,40,40,40,40,40,0,0,40,40,40,0,0,0,
+  40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,48,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,5,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,5,48,48,5,48,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,58,
+  58,58,58,58,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,58,58,58,58, },
+ {58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,
+  0,0,40,0,0,40,40,0,0,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,0,40,0,40,40,40, },
+ {40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,0,40,40,40,40,0,0,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,0,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,0, },
+ {40,40,40,40,40,0,40,0,0,0,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  0,40,40,0,40,0,0,40,0,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,0,40,0,40,0,0,0,0, },
+ {0,0,40,0,0,0,0,40,0,40,0,40,0,40,40,40,0,40,40,0,40,0,0,40,0,40,0,40,0,40,0,40,
+  0,40,40,0,40,0,0,40,40,40,40,0,40,40,40,40,40,40,40,0,40,40,40,40,0,40,40,40,40,0,40,0, },
+ {40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,0,
+  0,40,40,40,0,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,0, },
+ {40,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, },
+ {40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+  40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,0, },
+ {40,40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,40,40,40,40,40,40,40,40,40,0,0,0,0,0,0, },
+ {58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+};
+constinit const unsigned char mojibake::detail::normFlagsLookup[3049] {
+ 0,0,1,2,3,4,5,6,7,0,8,9,10,11,12,13,
+ 14,15,0,16,0,0,17,0,18,19,0,20,0,0,0,0,
+ 0,0,0,0,21,22,23,24,25,26,0,0,23,27,28,29,
+ 0,30,0,31,23,29,0,32,33,0,33,34,35,36,37,0,
+ 38,0,0,39,0,40,41,42,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,43,44,0,0,
+ 0,0,0,0,45,46,47,0,48,48,49,50,51,52,53,54,
+ 55,56,57,0,58,59,60,61,62,63,64,65,66,0,0,0,
+ 0,67,68,69,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,35,70,0,71,0,0,0,0,
+ 0,72,0,0,0,73,0,0,0,0,74,33,68,68,68,75,
+ 76,77,78,79,80,68,81,0,82,83,68,68,68,68,68,68,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,34,0,0,84,0,85,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,87,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,88,88,88,88,89,90,88,91,92,93,94,95,
+ 68,68,68,68,96,97,98,99,100,101,68,102,103,68,104,105,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,107,0,108,0,0,0,0,0,0,0,23,109,0,0,
+ 0,0,110,0,0,0,111,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,112,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,113,114,115,0,0,0,0,0,0,0,0,
+ 68,116,117,118,119,120,68,68,68,68,121,68,68,68,68,122,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,123,124,125,0,0,0,0,0,
+ 0,0,0,0,126,127,128,0,129,130,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 88,88,88,88,88,88,88,88,132,
+};
+constinit const unsigned short mojibake::detail::canonDecompBlocks[81][64] = {
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {39,42,45,48,51,54,0,57,60,63,66,69,72,75,78,81,0,84,87,90,93,96,99,0,0,102,105,108,111,114,0,0,
+  117,120,123,126,129,132,0,135,138,141,144,147,150,153,156,159,0,162,165,168,171,174,177,0,0,180,183,186,189,192,0,195, },
+ {198,201,204,207,210,213,216,219,222,225,228,231,234,237,240,243,0,0,246,249,252,255,258,261,264,267,270,273,276,279,282,285,
+  288,291,294,297,300,303,0,0,306,309,312,315,318,321,324,327,330,0,0,0,339,342,345,348,0,351,354,357,360,363,366,0, },
+ {0,0,0,375,378,381,384,387,390,0,0,0,396,399,402,405,408,411,0,0,414,417,420,423,426,429,432,435,438,441,444,447,
+  450,453,456,459,462,465,0,0,468,471,474,477,480,483,486,489,492,495,498,501,504,507,510,513,516,519,522,525,528,531,534,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  539,542,0,0,0,0,0,0,0,0,0,0,0,0,0,545,548,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,581,584,587,590,593,596,599,602,605,609,613,617,621,625,629,633,0,637,641,
+  645,649,653,656,0,0,659,662,665,668,671,674,677,681,685,688,691,0,0,0,703,706,0,0,709,712,715,719,723,726,729,732, },
+ {735,738,741,744,747,750,753,756,759,762,765,768,771,774,777,780,783,786,789,792,795,798,801,804,807,810,813,816,0,0,819,822,
+  0,0,0,0,0,0,825,828,831,834,837,841,845,849,853,856,859,863,867,870,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {917,919,0,921,923,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,926,0,0,0,0,0,0,0,0,0,931,0, },
+ {0,0,0,0,0,933,940,943,945,948,951,0,954,0,957,960,963,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,967,970,973,976,979,982,985,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,989,992,995,998,1001,0,0,0,0,1010,1013,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {1032,1035,0,1038,0,0,0,1041,0,0,0,0,1044,1047,1050,0,0,0,0,0,0,0,0,0,0,1053,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1056,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1059,1062,0,1065,0,0,0,1068,0,0,0,0,1071,1074,1077,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1080,1083,0,0,0,0,0,0,0,0, },
+ {0,1086,1089,0,0,0,0,0,0,0,0,0,0,0,0,0,1092,1095,1098,1101,0,0,1104,1107,0,0,1110,1113,1116,1119,1122,1125,
+  0,0,1128,1131,1134,1137,1140,1143,0,0,1146,1149,1152,1155,1158,1161,1164,1167,1170,1173,1176,1179,0,0,1182,1185,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,1191,1194,1197,1200,1203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {1218,0,1221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1224,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,1227,0,0,0,0,0,0,0,1230,0,0,1233,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1236,1239,1242,1245,1248,1251,1254,1257,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,1260,1263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1266,1269,0,1272,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1275,0,0,1278,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1281,1284,1287,0,0,1290,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,1293,0,0,1296,1299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1302,1305,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1308,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,1311,1314,1317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,1320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {1323,0,0,0,0,0,0,1326,1329,0,1332,1335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,1339,1342,1345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1348,0,1351,1354,1358,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,1375,0,0,0,0,0,0,0,0,0,1378,0,0,0,0,1381,0,0,0,0,1384,0,0,0,0,1387,0,0,0,
+  0,0,0,0,0,0,0,0,0,1390,0,0,0,0,0,0,0,0,0,1393,0,1396,1399,0,1406,0,0,0,0,0,0,0, },
+ {0,1413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1416,0,0,0,0,0,0,0,0,0,1419,0,0,
+  0,0,1422,0,0,0,0,1425,0,0,0,0,1428,0,0,0,0,0,0,0,0,0,0,0,0,1431,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,1434,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,1439,0,1442,0,1445,0,1448,0,1451,0,0,0,1454,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1457,0,1460,0,0, },
+ {1463,1466,0,1469,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {1640,1643,1646,1649,1652,1655,1658,1661,1664,1668,1672,1675,1678,1681,1684,1687,1690,1693,1696,1699,1702,1706,1710,1714,1718,1721,1724,1727,1730,1734,1738,1741,
+  1744,1747,1750,1753,1756,1759,1762,1765,1768,1771,1774,1777,1780,1783,1786,1790,1794,1797,1800,1803,1806,1809,1812,1815,1818,1822,1826,1829,1832,1835,1838,1841, },
+ {1844,1847,1850,1853,1856,1859,1862,1865,1868,1871,1874,1877,1880,1884,1888,1892,1896,1900,1904,1908,1912,1915,1918,1921,1924,1927,1930,1933,1936,1940,1944,1947,
+  1950,1953,1956,1959,1962,1966,1970,1974,1978,1982,1986,1989,1992,1995,1998,2001,2004,2007,2010,2013,2016,2019,2022,2025,2028,2032,2036,2040,2044,2047,2050,2053, },
+ {2056,2059,2062,2065,2068,2071,2074,2077,2080,2083,2086,2089,2092,2095,2098,2101,2104,2107,2110,2113,2116,2119,2122,2125,2128,2131,0,2137,0,0,0,0,
+  2140,2143,2146,2149,2152,2156,2160,2164,2168,2172,2176,2180,2184,2188,2192,2196,2200,2204,2208,2212,2216,2220,2224,2228,2232,2235,2238,2241,2244,2247,2250,2254, },
+ {2258,2262,2266,2270,2274,2278,2282,2286,2290,2293,2296,2299,2302,2305,2308,2311,2314,2318,2322,2326,2330,2334,2338,2342,2346,2350,2354,2358,2362,2366,2370,2374,
+  2378,2382,2386,2390,2394,2397,2400,2403,2406,2410,2414,2418,2422,2426,2430,2434,2438,2442,2446,2449,2452,2455,2458,2461,2464,2467,0,0,0,0,0,0, },
+ {2470,2473,2476,2480,2484,2488,2492,2496,2500,2503,2506,2510,2514,2518,2522,2526,2530,2533,2536,2540,2544,2548,0,0,2552,2555,2558,2562,2566,2570,0,0,
+  2574,2577,2580,2584,2588,2592,2596,2600,2604,2607,2610,2614,2618,2622,2626,2630,2634,2637,2640,2644,2648,2652,2656,2660,2664,2667,2670,2674,2678,2682,2686,2690, },
+ {2694,2697,2700,2704,2708,2712,0,0,2716,2719,2722,2726,2730,2734,0,0,2738,2741,2744,2748,2752,2756,2760,2764,0,2768,0,2771,0,2775,0,2779,
+  2783,2786,2789,2793,2797,2801,2805,2809,2813,2816,2819,2823,2827,2831,2835,2839,2843,973,2846,976,2849,979,2852,982,2855,995,2858,998,2861,1001,0,0, },
+ {2864,2868,2872,2877,2882,2887,2892,2897,2902,2906,2910,2915,2920,2925,2930,2935,2940,2944,2948,2953,2958,2963,2968,2973,2978,2982,2986,2991,2996,3001,3006,3011,
+  3016,3020,3024,3029,3034,3039,3044,3049,3054,3058,3062,3067,3072,3077,3082,3087,3092,3095,3098,3102,3105,0,3109,3112,3116,3119,3122,940,3125,0,3131,0, },
+ {0,3136,3143,3147,3150,0,3154,3157,3161,945,3164,948,3167,3170,3177,3184,3191,3194,3197,963,0,0,3201,3204,3208,3211,3214,951,0,3217,3224,3231,
+  3238,3241,3244,985,3248,3251,3254,3257,3261,3264,3267,957,3270,3273,933,3280,0,0,3282,3286,3289,0,3293,3296,3300,954,3303,960,3306,3309,0,0, },
+ {3314,3316,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,3440,0,0,0,1492,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3598,3601,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,3604,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,3607,3610,3613,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,3616,0,0,0,0,3619,0,0,3622,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,3625,0,3628,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,3645,0,0,3648,0,0,3651,0,3654,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3657,0,3660,0,0,0,0,0,0,0,0,0,0,3663,3666,3669,3672,3675,0,0,3678,3681,0,0,3684,3687,0,0,0,0,0,0, },
+ {3690,3693,0,0,3696,3699,0,0,3702,3705,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,3708,3711,3714,3717,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3720,3723,3726,3729,0,0,0,0,0,0,3732,3735,3738,3741,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,3744,3746,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4069,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,4512,0,4515,0,4518,0,4521,0,4524,0,4527,0,4530,0,4533,0,4536,0,4539,0,
+  4542,0,4545,0,0,4548,0,4551,0,4554,0,0,0,0,0,0,4557,4560,0,4563,4566,0,4569,4572,0,4575,4578,0,4581,4584,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4587,0,0,0,0,0,0,0,0,0,4596,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,4602,0,4605,0,4608,0,4611,0,4614,0,4617,0,4620,0,4623,0,4626,0,4629,0, },
+ {4632,0,4635,0,0,4638,0,4641,0,4644,0,0,0,0,0,0,4647,4650,0,4653,4656,0,4659,4662,0,4665,4668,0,4671,4674,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4677,0,0,4680,4683,4686,4689,0,0,0,4692,0, },
+ {6610,6612,4394,6614,6616,6618,6620,4502,4502,6622,4410,6624,6626,6628,6630,6632,6634,6636,6638,6640,6642,6644,6646,6648,6650,6652,6654,6656,6658,6660,6662,6664,
+  6666,6668,6670,6672,6674,6676,6678,6680,6682,6684,6686,6688,6690,6692,6694,6696,6698,6700,6702,6704,4326,6706,6708,6710,6712,6714,6716,6718,6720,6722,6724,6726, },
+ {4472,6728,6730,6732,6734,6736,6738,6740,6742,6744,6746,6748,6750,6752,6754,6756,6758,6760,6762,6764,6766,6768,6770,6772,6774,6776,6778,6780,6642,6782,6784,6786,
+  6788,6790,6792,6794,6796,6798,6800,6802,6804,6806,6808,6810,6812,6814,6816,6818,6820,4398,6822,6824,6826,6828,6830,6832,6834,6836,6838,6840,6842,6844,6846,6848, },
+ {6850,4152,6852,6854,6856,6858,6860,6862,6864,6866,4114,6868,6870,6872,6874,6876,6878,6880,6882,6884,6886,6888,6890,6892,6894,6896,6898,6900,6902,6904,6906,6908,
+  6910,6818,6912,6914,6916,6918,6920,6922,6924,6926,6786,6928,6930,6932,6934,6936,6938,6940,6942,6944,6946,6948,6950,6952,6954,6956,6958,6960,6962,6964,6966,6642, },
+ {6968,6970,6972,6974,4500,6976,6978,6980,6982,6984,6986,6988,6990,6992,6994,6996,6998,5309,7000,7002,7004,7006,7008,7010,7012,7014,7016,6790,7018,7020,7022,7024,
+  7026,7028,7030,7032,7034,7036,7038,7040,7042,4408,7044,7046,7048,7050,7052,7054,7056,7058,7060,7062,7064,7066,7068,4310,7070,7072,7074,7076,7078,7080,7082,7084, },
+ {7086,7088,7090,7092,7094,7096,7098,7100,4364,7102,4370,7104,7106,7108,0,0,7110,0,7112,0,0,7114,7116,7118,7120,7122,7124,7126,7128,7130,4324,0,
+  7132,0,7134,0,0,7136,7138,0,0,0,7140,7142,7144,7146,7148,7150,7152,7154,7156,7158,7160,7162,7164,7166,7168,7170,7172,7174,4166,7176,7178,7180, },
+ {7182,7184,7186,7188,7190,7192,7194,7196,7198,7200,7202,7204,5319,7206,7208,7210,7212,5327,7214,7216,7218,7220,7222,6890,7224,7226,7228,7230,7232,7234,7234,7236,
+  7238,7240,7242,7244,7246,7248,7250,7136,7252,7254,7256,7258,7260,7262,0,0,7264,7266,7268,7270,7272,7274,7276,7278,7164,7280,7282,7284,7110,7286,7288,7290, },
+ {7292,7294,7296,7298,7300,7302,7304,7306,7308,7180,7310,7182,7312,7314,7316,7318,7320,7112,6684,7322,7324,4232,6820,6986,7326,7328,7196,7330,7198,7332,7334,7336,
+  7116,7338,7340,7342,7344,7346,7118,7348,7350,7352,7354,7356,7358,7222,7360,7362,6890,7364,7230,7366,7368,7370,7372,7374,7240,7376,7134,7378,7242,6782,7380,7244, },
+ {7382,7248,7384,7386,7388,7390,7392,7252,7128,7394,7254,7396,7256,7398,4502,7400,7402,7404,7406,7408,7410,7412,7414,7416,7418,7420,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7457,0,7460,
+  0,0,0,0,0,0,0,0,0,0,7477,7480,7483,7487,7491,7494,7497,7500,7503,7506,7509,7512,7515,0,7518,7521,7524,7527,7530,0,7533,0, },
+ {7536,7539,0,7542,7545,0,7548,7551,7554,7557,7560,7563,7566,7569,7572,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9011,0,9014,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,9017,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,9020,9023,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,9026,9029,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9032,9035,0,9038,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9041,9044,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9047,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9050,9053,
+  9056,9060,9064,9068,9072,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9076,9079,9082,9086,9090, },
+ {9094,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {9457,9459,9461,9463,9465,7152,9467,9469,9471,9473,7154,9475,9477,9479,7156,9481,9483,9485,9487,9489,9491,9375,9493,9495,9497,9499,9501,7266,9503,4110,9505,9507,
+  9509,9511,9411,9513,9515,7276,7158,7160,7278,9517,9519,6794,9521,7162,9523,9525,9527,9529,9529,9529,9531,9533,9535,9537,9539,9541,9543,9545,9547,9549,9551,9553, },
+ {9555,9557,9559,9561,9563,9565,9565,7282,9567,9569,9571,9573,7166,9575,9577,9579,7086,9581,9583,9585,9587,9589,9591,9593,9595,9597,9599,9601,9603,9361,9605,9607,
+  9609,9611,9613,9615,9617,9619,9621,9623,9625,9627,9629,9629,9631,9633,9635,6786,9637,9639,9641,9643,9645,4162,9647,9649,4166,9651,9653,9655,9657,9659,9661,9663, },
+ {9665,9667,9669,9671,9673,9675,9677,9679,9681,9683,9685,9687,9689,9691,6682,9693,4186,9695,9695,9697,9699,9699,9701,9703,9705,9707,9709,9711,9713,9715,9717,9719,
+  9721,9723,9725,7176,9727,9729,9731,9733,7306,9733,9735,7180,9737,9739,9741,9743,7182,6628,9745,9747,9749,9751,9753,9755,9757,9759,9761,9763,9765,9767,9769,9771, },
+ {9773,9775,9777,9779,9781,9783,9785,9787,7184,9789,9791,9793,9795,9797,9799,7188,9801,9803,9805,9807,9809,9811,9813,9815,6684,7322,9817,9819,9821,9823,9825,9827,
+  9829,9831,7190,9833,9835,9837,9839,7406,9841,9843,9845,9847,9849,9851,9853,9855,9857,9859,9861,9863,9865,6820,9867,9869,9871,9873,9875,9877,9879,9881,9883,9885, },
+ {9887,7192,6986,9889,9891,9893,9895,9897,9899,9901,9903,7328,9905,9907,9909,9911,9913,9915,9917,9919,7330,9921,9923,9925,9927,9929,9931,9933,9935,9937,9939,9941,
+  9943,7334,9945,9947,9949,9951,9953,9955,9957,9959,9961,9963,9965,9965,9967,9969,7338,9971,9973,9975,9977,9979,9981,9983,6792,9985,9987,9989,9991,9993,9995,9997, },
+ {7350,9999,10001,10003,10005,10007,10009,10009,7352,7410,10011,10013,10015,10017,10019,6718,7356,10021,10023,7212,10025,10027,7126,10029,10031,7218,10033,10035,10037,10039,10039,10041,
+  10043,10045,10047,10049,10051,10053,10055,10057,10059,10061,10063,10065,10067,10069,10071,10073,10075,10077,10079,10081,10083,10085,10087,10089,10091,10093,7230,10095,10097,10099,10101,10103, },
+ {10105,10107,10109,10111,10113,10115,10117,10119,10121,10123,10125,9697,10127,10129,10131,10133,10135,10137,10139,10141,10143,10145,10147,10149,6826,10151,10153,10155,10157,10159,10161,7236,
+  10163,10165,10167,10169,10171,10173,10175,10177,10179,10181,10183,10185,10187,10189,10191,10193,10195,10197,10199,10201,6708,10203,10205,10207,10209,10211,10213,7370,10215,10217,10219,10221, },
+ {10223,10225,10227,10229,4366,10231,10233,10235,10237,10239,10241,10243,10245,10247,10249,10251,7380,7382,4380,10253,10255,10257,10259,10261,10263,10265,10267,10269,10271,10273,10275,7384,
+  10277,10279,10281,10283,10285,10287,10289,10291,10293,10295,10297,10299,10301,10303,10305,10307,10309,10311,10313,10315,10317,10319,10321,10323,10325,10327,10329,10331,10333,10335,7396,7396, },
+ {10337,10339,10341,10343,10345,10347,10349,10351,10353,10355,7398,10357,10359,10361,10363,10365,10367,10369,10371,10373,10375,4476,10377,4484,10379,10381,10383,10385,4494,10387,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+};
+constinit const unsigned char mojibake::detail::canonDecompLookup[3049] {
+ 0,0,0,1,2,3,4,5,6,0,0,0,0,7,8,9,
+ 10,11,0,12,0,0,0,0,13,0,0,14,0,0,0,0,
+ 0,0,0,0,15,16,0,17,18,19,0,0,0,20,21,22,
+ 0,23,0,24,0,25,0,26,0,0,0,0,0,27,28,0,
+ 29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,30,31,0,0,
+ 0,0,0,0,0,0,0,0,32,33,34,35,36,37,38,39,
+ 40,0,0,0,41,0,42,43,44,45,46,47,48,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,53,54,55,56,57,58,59,60,61,62,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,63,0,64,0,0,0,0,0,0,0,0,65,0,0,
+ 0,0,66,0,0,0,67,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,69,70,71,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 72,73,74,75,76,77,78,79,80,
+};
+constinit const unsigned short mojibake::detail::compatDecompBlocks[170][64] = {
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,0,0,0,0,0,0,0,3,0,6,0,0,0,0,8,0,0,11,13,15,18,0,0,20,23,25,0,27,31,35,0, },
+ {39,42,45,48,51,54,0,57,60,63,66,69,72,75,78,81,0,84,87,90,93,96,99,0,0,102,105,108,111,114,0,0,
+  117,120,123,126,129,132,0,135,138,141,144,147,150,153,156,159,0,162,165,168,171,174,177,0,0,180,183,186,189,192,0,195, },
+ {198,201,204,207,210,213,216,219,222,225,228,231,234,237,240,243,0,0,246,249,252,255,258,261,264,267,270,273,276,279,282,285,
+  288,291,294,297,300,303,0,0,306,309,312,315,318,321,324,327,330,0,333,336,339,342,345,348,0,351,354,357,360,363,366,369, },
+ {372,0,0,375,378,381,384,387,390,393,0,0,396,399,402,405,408,411,0,0,414,417,420,423,426,429,432,435,438,441,444,447,
+  450,453,456,459,462,465,0,0,468,471,474,477,480,483,486,489,492,495,498,501,504,507,510,513,516,519,522,525,528,531,534,537, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  539,542,0,0,0,0,0,0,0,0,0,0,0,0,0,545,548,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,551,555,559,563,566,569,572,575,578,581,584,587,590,593,596,599,602,605,609,613,617,621,625,629,633,0,637,641,
+  645,649,653,656,0,0,659,662,665,668,671,674,677,681,685,688,691,694,697,700,703,706,0,0,709,712,715,719,723,726,729,732, },
+ {735,738,741,744,747,750,753,756,759,762,765,768,771,774,777,780,783,786,789,792,795,798,801,804,807,810,813,816,0,0,819,822,
+  0,0,0,0,0,0,825,828,831,834,837,841,845,849,853,856,859,863,867,870,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,873,875,877,879,881,883,885,887,889,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,891,894,897,900,903,906,0,0,
+  909,911,537,913,915,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {917,919,0,921,923,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,926,0,0,0,0,0,928,0,0,0,931,0, },
+ {0,0,0,0,15,936,940,943,945,948,951,0,954,0,957,960,963,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,967,970,973,976,979,982,985,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,989,992,995,998,1001,0,1004,1006,1008,957,970,1016,1018,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1020,1022,1024,0,1026,1028,0,0,0,1030,0,0,0,0,0,0, },
+ {1032,1035,0,1038,0,0,0,1041,0,0,0,0,1044,1047,1050,0,0,0,0,0,0,0,0,0,0,1053,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1056,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1059,1062,0,1065,0,0,0,1068,0,0,0,0,1071,1074,1077,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1080,1083,0,0,0,0,0,0,0,0, },
+ {0,1086,1089,0,0,0,0,0,0,0,0,0,0,0,0,0,1092,1095,1098,1101,0,0,1104,1107,0,0,1110,1113,1116,1119,1122,1125,
+  0,0,1128,1131,1134,1137,1140,1143,0,0,1146,1149,1152,1155,1158,1161,1164,1167,1170,1173,1176,1179,0,0,1182,1185,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,1188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,1191,1194,1197,1200,1203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1206,1209,1212,1215,0,0,0,0,0,0,0, },
+ {1218,0,1221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1224,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,1227,0,0,0,0,0,0,0,1230,0,0,1233,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1236,1239,1242,1245,1248,1251,1254,1257,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,1260,1263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1266,1269,0,1272,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1275,0,0,1278,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1281,1284,1287,0,0,1290,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,1293,0,0,1296,1299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1302,1305,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1308,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,1311,1314,1317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,1320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {1323,0,0,0,0,0,0,1326,1329,0,1332,1335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,1339,1342,1345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1348,0,1351,1354,1358,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1361,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1364,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1367,1370,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,1373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,1375,0,0,0,0,0,0,0,0,0,1378,0,0,0,0,1381,0,0,0,0,1384,0,0,0,0,1387,0,0,0,
+  0,0,0,0,0,0,0,0,0,1390,0,0,0,0,0,0,0,0,0,1393,0,1396,1399,1402,1406,1409,0,0,0,0,0,0, },
+ {0,1413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1416,0,0,0,0,0,0,0,0,0,1419,0,0,
+  0,0,1422,0,0,0,0,1425,0,0,0,0,1428,0,0,0,0,0,0,0,0,0,0,0,0,1431,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,1434,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1437,0,0,0, },
+ {0,0,0,0,0,0,1439,0,1442,0,1445,0,1448,0,1451,0,0,0,1454,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1457,0,1460,0,0, },
+ {1463,1466,0,1469,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,1472,1474,1476,0,1478,1480,1482,1484,1486,1488,1490,1492,1494,1496,1498,0,1500,1502,1504,1506, },
+ {1508,1510,1512,6,1514,1516,1518,1520,1522,1524,1526,1528,1530,1532,0,1534,1536,1538,25,1540,1542,1544,1546,1548,1550,1552,1554,1556,1558,1004,1560,1562,
+  1016,1564,1566,879,1550,1556,1004,1560,1022,1016,1564,0,0,0,0,0,0,0,0,0,0,0,0,0,1568,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1570,1572,1574,1576,1530,
+  1578,1580,1582,1584,1586,1588,1590,1592,1594,1596,1598,1600,1602,1604,1606,1608,1610,1612,1614,1616,1618,1620,1622,1624,1626,1628,1630,1632,1634,1636,1638,1006, },
+ {1640,1643,1646,1649,1652,1655,1658,1661,1664,1668,1672,1675,1678,1681,1684,1687,1690,1693,1696,1699,1702,1706,1710,1714,1718,1721,1724,1727,1730,1734,1738,1741,
+  1744,1747,1750,1753,1756,1759,1762,1765,1768,1771,1774,1777,1780,1783,1786,1790,1794,1797,1800,1803,1806,1809,1812,1815,1818,1822,1826,1829,1832,1835,1838,1841, },
+ {1844,1847,1850,1853,1856,1859,1862,1865,1868,1871,1874,1877,1880,1884,1888,1892,1896,1900,1904,1908,1912,1915,1918,1921,1924,1927,1930,1933,1936,1940,1944,1947,
+  1950,1953,1956,1959,1962,1966,1970,1974,1978,1982,1986,1989,1992,1995,1998,2001,2004,2007,2010,2013,2016,2019,2022,2025,2028,2032,2036,2040,2044,2047,2050,2053, },
+ {2056,2059,2062,2065,2068,2071,2074,2077,2080,2083,2086,2089,2092,2095,2098,2101,2104,2107,2110,2113,2116,2119,2122,2125,2128,2131,2134,1953,0,0,0,0,
+  2140,2143,2146,2149,2152,2156,2160,2164,2168,2172,2176,2180,2184,2188,2192,2196,2200,2204,2208,2212,2216,2220,2224,2228,2232,2235,2238,2241,2244,2247,2250,2254, },
+ {2258,2262,2266,2270,2274,2278,2282,2286,2290,2293,2296,2299,2302,2305,2308,2311,2314,2318,2322,2326,2330,2334,2338,2342,2346,2350,2354,2358,2362,2366,2370,2374,
+  2378,2382,2386,2390,2394,2397,2400,2403,2406,2410,2414,2418,2422,2426,2430,2434,2438,2442,2446,2449,2452,2455,2458,2461,2464,2467,0,0,0,0,0,0, },
+ {2470,2473,2476,2480,2484,2488,2492,2496,2500,2503,2506,2510,2514,2518,2522,2526,2530,2533,2536,2540,2544,2548,0,0,2552,2555,2558,2562,2566,2570,0,0,
+  2574,2577,2580,2584,2588,2592,2596,2600,2604,2607,2610,2614,2618,2622,2626,2630,2634,2637,2640,2644,2648,2652,2656,2660,2664,2667,2670,2674,2678,2682,2686,2690, },
+ {2694,2697,2700,2704,2708,2712,0,0,2716,2719,2722,2726,2730,2734,0,0,2738,2741,2744,2748,2752,2756,2760,2764,0,2768,0,2771,0,2775,0,2779,
+  2783,2786,2789,2793,2797,2801,2805,2809,2813,2816,2819,2823,2827,2831,2835,2839,2843,973,2846,976,2849,979,2852,982,2855,995,2858,998,2861,1001,0,0, },
+ {2864,2868,2872,2877,2882,2887,2892,2897,2902,2906,2910,2915,2920,2925,2930,2935,2940,2944,2948,2953,2958,2963,2968,2973,2978,2982,2986,2991,2996,3001,3006,3011,
+  3016,3020,3024,3029,3034,3039,3044,3049,3054,3058,3062,3067,3072,3077,3082,3087,3092,3095,3098,3102,3105,0,3109,3112,3116,3119,3122,940,3125,3128,3131,3128, },
+ {3133,3139,3143,3147,3150,0,3154,3157,3161,945,3164,948,3167,3173,3180,3187,3191,3194,3197,963,0,0,3201,3204,3208,3211,3214,951,0,3220,3227,3234,
+  3238,3241,3244,985,3248,3251,3254,3257,3261,3264,3267,957,3270,3276,936,3280,0,0,3282,3286,3289,0,3293,3296,3300,954,3303,960,3306,15,3311,0, },
+ {1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,3318,0,0,0,0,0,3320,0,0,0,0,0,0,0,0,
+  0,0,0,0,3323,3325,3328,0,0,0,0,0,0,0,0,1,0,0,0,3332,3335,0,3339,3342,0,0,0,0,3346,0,3349,0, },
+ {0,0,0,0,0,0,0,3352,3355,3358,0,0,0,0,0,0,0,0,0,0,0,0,0,3361,0,0,0,0,0,0,0,1,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3366,1566,0,0,3368,3370,3372,3374,3376,3378,3380,3382,3384,3386,3388,3390, },
+ {3366,23,11,13,3368,3370,3372,3374,3376,3378,3380,3382,3384,3386,3388,0,6,1524,25,913,1526,873,1534,911,1536,3390,1546,537,1548,0,0,0,
+  0,0,0,0,0,0,0,0,3392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {3395,3399,3403,3405,0,3408,3412,3416,0,3418,1532,1486,1486,1486,873,3421,1488,1488,1494,911,0,1498,3423,0,0,1504,3426,1506,1506,1506,0,0,
+  3428,3431,3435,0,3438,0,3440,0,3438,0,1492,54,1476,3403,0,1524,1480,3442,0,1496,25,3444,3446,3448,3450,1566,0,3452,1018,1560,3456,3458, },
+ {3460,0,0,0,0,1478,1522,1524,1566,877,0,0,0,0,0,0,3462,3466,3470,3475,3479,3483,3487,3491,3495,3499,3503,3507,3511,3515,3519,3523,
+  1488,3526,3529,3533,3536,3538,3541,3545,3550,3553,3555,3558,1494,3403,1478,1496,1566,3562,3565,3569,1556,3572,3575,3579,3584,913,3587,3590,911,1572,1522,1536, },
+ {0,0,0,0,0,0,0,0,0,3594,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3598,3601,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,3604,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,3607,3610,3613,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,3616,0,0,0,0,3619,0,0,3622,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,3625,0,3628,0,0,0,0,0,3631,3634,0,3638,3641,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,3645,0,0,3648,0,0,3651,0,3654,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3657,0,3660,0,0,0,0,0,0,0,0,0,0,3663,3666,3669,3672,3675,0,0,3678,3681,0,0,3684,3687,0,0,0,0,0,0, },
+ {3690,3693,0,0,3696,3699,0,0,3702,3705,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,3708,3711,3714,3717,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3720,3723,3726,3729,0,0,0,0,0,0,3732,3735,3738,3741,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,3744,3746,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  23,11,13,3368,3370,3372,3374,3376,3378,3748,3751,3754,3757,3760,3763,3766,3769,3772,3775,3778,3781,3785,3789,3793,3797,3801,3805,3809,3813,3817,3822,3827, },
+ {3832,3837,3842,3847,3852,3857,3862,3867,3872,3875,3878,3881,3884,3887,3890,3893,3896,3899,3903,3907,3911,3915,3919,3923,3927,3931,3935,3939,3943,3947,3951,3955,
+  3959,3963,3967,3971,3975,3979,3983,3987,3991,3995,3999,4003,4007,4011,4015,4019,4023,4027,4031,4035,4039,4043,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490, },
+ {1492,1494,1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,
+  4051,879,537,1548,1550,1556,887,913,889,1632,3366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,4053,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4058,4062,4065,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4069,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,877,3536,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4072,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4074,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4076,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {4078,4080,4082,4084,4086,4088,4090,4092,4094,4096,4098,4100,4102,4104,4106,4108,4110,4112,4114,4116,4118,4120,4122,4124,4126,4128,4130,4132,4134,4136,4138,4140,
+  4142,4144,4146,4148,4150,4152,4154,4156,4158,4160,4162,4164,4166,4168,4170,4172,4174,4176,4178,4180,4182,4184,4186,4188,4190,4192,4194,4196,4198,4200,4202,4204, },
+ {4206,4208,4210,4212,4214,4216,4218,4220,4222,4224,4226,4228,4230,4232,4234,4236,4238,4240,4242,4244,4246,4248,4250,4252,4254,4256,4258,4260,4262,4264,4266,4268,
+  4270,4272,4274,4276,4278,4280,4282,4284,4286,4288,4290,4292,4294,4296,4298,4300,4302,4304,4306,4308,4310,4312,4314,4316,4318,4320,4322,4324,4326,4328,4330,4332, },
+ {4334,4336,4338,4340,4342,4344,4346,4348,4350,4352,4354,4356,4358,4360,4362,4364,4366,4368,4370,4372,4374,4376,4378,4380,4382,4384,4386,4388,4390,4392,4394,4396,
+  4398,4400,4402,4404,4406,4408,4410,4412,4414,4416,4418,4420,4422,4424,4426,4428,4430,4432,4434,4436,4438,4440,4442,4444,4446,4448,4450,4452,4454,4456,4458,4460, },
+ {4462,4464,4466,4468,4470,4472,4474,4476,4478,4480,4482,4484,4486,4488,4490,4492,4494,4496,4498,4500,4502,4504,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4506,0,4124,4508,4510,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,4512,0,4515,0,4518,0,4521,0,4524,0,4527,0,4530,0,4533,0,4536,0,4539,0,
+  4542,0,4545,0,0,4548,0,4551,0,4554,0,0,0,0,0,0,4557,4560,0,4563,4566,0,4569,4572,0,4575,4578,0,4581,4584,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4587,0,0,0,0,0,0,4590,4593,0,4596,4599,
+  0,0,0,0,0,0,0,0,0,0,0,0,4602,0,4605,0,4608,0,4611,0,4614,0,4617,0,4620,0,4623,0,4626,0,4629,0, },
+ {4632,0,4635,0,0,4638,0,4641,0,4644,0,0,0,0,0,0,4647,4650,0,4653,4656,0,4659,4662,0,4665,4668,0,4671,4674,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4677,0,0,4680,4683,4686,4689,0,0,0,4692,4695, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4698,4700,4702,4704,4706,4708,4710,4712,4714,4716,4718,4720,4722,4724,4726, },
+ {4728,4730,4732,4734,4736,4738,4740,4742,4744,4746,4748,4750,4752,4754,4756,4758,4760,4762,4764,4766,4768,4770,4772,4774,4776,4778,4780,4782,4784,4786,4788,4790,
+  4792,4794,4796,4798,4800,4802,4804,4806,4808,4810,4812,4814,4816,4818,4820,4822,4824,4826,4828,4830,4832,4834,4836,4838,4840,4842,4844,4846,4848,4850,4852,4854, },
+ {4856,4858,4860,4862,4864,4866,4868,4870,4872,4874,4876,4878,4880,4882,4884,0,0,0,4078,4090,4886,4888,4890,4892,4894,4896,4086,4898,4900,4902,4904,4094,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {4906,4910,4914,4918,4922,4926,4930,4934,4938,4942,4946,4950,4954,4958,4962,4967,4972,4977,4982,4987,4992,4997,5002,5007,5012,5017,5022,5027,5032,5037,5045,0,
+  5052,5056,5060,5064,5068,5072,5076,5080,5084,5088,5092,5096,5100,5104,5108,5112,5116,5120,5124,5128,5132,5136,5140,5144,5148,5152,5156,5160,5164,5168,5172,5176, },
+ {5180,5184,5188,5192,5196,5198,4210,5200,0,0,0,0,0,0,0,0,5202,5206,5209,5212,5215,5218,5221,5224,5227,5230,5233,5236,5239,5242,5245,5248,
+  4698,4704,4710,4714,4730,4732,4738,4742,4744,4748,4750,4752,4754,4756,5251,5254,5257,5260,5263,5266,5269,5272,5275,5278,5281,5284,5287,5290,5293,5299,5304,0, },
+ {4078,4090,4886,4888,5307,5309,5311,4100,5313,4124,4224,4248,4246,4226,4410,4140,4220,5315,5317,5319,5321,5323,5325,5327,5329,5331,5333,4152,5335,5337,5339,5341,
+  5343,5345,5347,5349,4890,4892,4894,5351,5353,5355,5357,5359,5361,5363,5365,5367,5369,5371,5374,5377,5380,5383,5386,5389,5392,5395,5398,5401,5404,5407,5410,5413, },
+ {5416,5419,5422,5425,5428,5431,5434,5437,5440,5443,5447,5451,5455,5458,5462,5465,5469,5471,5473,5475,5477,5479,5481,5483,5485,5487,5489,5491,5493,5495,5497,5499,
+  5501,5503,5505,5507,5509,5511,5513,5515,5517,5519,5521,5523,5525,5527,5529,5531,5533,5535,5537,5539,5541,5543,5545,5547,5549,5551,5553,5555,5557,5559,5561,5563, },
+ {5566,5572,5577,5583,5587,5593,5597,5601,5608,5613,5617,5621,5625,5630,5635,5640,5645,5650,5655,5660,5667,5670,5677,5684,5690,5695,5702,5709,5714,5718,5722,5727,
+  5732,5738,5744,5748,5752,5757,5761,5765,5768,5771,5775,5779,5786,5791,5797,5804,5809,5813,5817,5824,5829,5836,5840,5846,5850,5855,5859,5864,5870,5875,5881,5886, },
+ {5889,5895,5899,5903,5908,5912,5916,5920,5926,5931,5934,5941,5945,5951,5956,5961,5965,5969,5974,5977,5982,5988,5991,5998,6002,6005,6008,6011,6014,6017,6020,6023,
+  6026,6029,6032,6036,6040,6044,6048,6052,6056,6060,6064,6068,6072,6076,6080,6084,6088,6092,6096,6099,6102,6106,6109,6112,6115,6119,6123,6126,6129,6132,6135,6138, },
+ {6143,6146,6149,6152,6155,6158,6161,6164,6167,6171,6176,6179,6182,6185,6188,6191,6194,6197,6201,6205,6209,6213,6216,6219,6222,6225,6228,6231,6234,6237,6240,6243,
+  6247,6251,6254,6258,6262,6266,6269,6273,6277,6282,6285,6289,6293,6297,6301,6307,6314,6317,6320,6323,6326,6329,6332,6335,6338,6341,6344,6347,6350,6353,6356,6359, },
+ {6362,6365,6368,6373,6376,6379,6382,6387,6391,6394,6397,6400,6403,6406,6409,6412,6415,6418,6421,6425,6428,6431,6435,6439,6442,6447,6451,6454,6457,6460,6463,6467,
+  6471,6474,6477,6480,6483,6486,6489,6492,6495,6498,6502,6506,6510,6514,6518,6522,6526,6530,6534,6538,6542,6546,6550,6554,6558,6562,6566,6570,6574,6578,6582,6586, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6590,6592,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6594,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3403,3442,3426,0,0,0,6596,6598,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6600,6602,6604,6606,
+  0,0,0,0,0,0,0,0,0,6608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {6610,6612,4394,6614,6616,6618,6620,4502,4502,6622,4410,6624,6626,6628,6630,6632,6634,6636,6638,6640,6642,6644,6646,6648,6650,6652,6654,6656,6658,6660,6662,6664,
+  6666,6668,6670,6672,6674,6676,6678,6680,6682,6684,6686,6688,6690,6692,6694,6696,6698,6700,6702,6704,4326,6706,6708,6710,6712,6714,6716,6718,6720,6722,6724,6726, },
+ {4472,6728,6730,6732,6734,6736,6738,6740,6742,6744,6746,6748,6750,6752,6754,6756,6758,6760,6762,6764,6766,6768,6770,6772,6774,6776,6778,6780,6642,6782,6784,6786,
+  6788,6790,6792,6794,6796,6798,6800,6802,6804,6806,6808,6810,6812,6814,6816,6818,6820,4398,6822,6824,6826,6828,6830,6832,6834,6836,6838,6840,6842,6844,6846,6848, },
+ {6850,4152,6852,6854,6856,6858,6860,6862,6864,6866,4114,6868,6870,6872,6874,6876,6878,6880,6882,6884,6886,6888,6890,6892,6894,6896,6898,6900,6902,6904,6906,6908,
+  6910,6818,6912,6914,6916,6918,6920,6922,6924,6926,6786,6928,6930,6932,6934,6936,6938,6940,6942,6944,6946,6948,6950,6952,6954,6956,6958,6960,6962,6964,6966,6642, },
+ {6968,6970,6972,6974,4500,6976,6978,6980,6982,6984,6986,6988,6990,6992,6994,6996,6998,5309,7000,7002,7004,7006,7008,7010,7012,7014,7016,6790,7018,7020,7022,7024,
+  7026,7028,7030,7032,7034,7036,7038,7040,7042,4408,7044,7046,7048,7050,7052,7054,7056,7058,7060,7062,7064,7066,7068,4310,7070,7072,7074,7076,7078,7080,7082,7084, },
+ {7086,7088,7090,7092,7094,7096,7098,7100,4364,7102,4370,7104,7106,7108,0,0,7110,0,7112,0,0,7114,7116,7118,7120,7122,7124,7126,7128,7130,4324,0,
+  7132,0,7134,0,0,7136,7138,0,0,0,7140,7142,7144,7146,7148,7150,7152,7154,7156,7158,7160,7162,7164,7166,7168,7170,7172,7174,4166,7176,7178,7180, },
+ {7182,7184,7186,7188,7190,7192,7194,7196,7198,7200,7202,7204,5319,7206,7208,7210,7212,5327,7214,7216,7218,7220,7222,6890,7224,7226,7228,7230,7232,7234,7234,7236,
+  7238,7240,7242,7244,7246,7248,7250,7136,7252,7254,7256,7258,7260,7262,0,0,7264,7266,7268,7270,7272,7274,7276,7278,7164,7280,7282,7284,7110,7286,7288,7290, },
+ {7292,7294,7296,7298,7300,7302,7304,7306,7308,7180,7310,7182,7312,7314,7316,7318,7320,7112,6684,7322,7324,4232,6820,6986,7326,7328,7196,7330,7198,7332,7334,7336,
+  7116,7338,7340,7342,7344,7346,7118,7348,7350,7352,7354,7356,7358,7222,7360,7362,6890,7364,7230,7366,7368,7370,7372,7374,7240,7376,7134,7378,7242,6782,7380,7244, },
+ {7382,7248,7384,7386,7388,7390,7392,7252,7128,7394,7254,7396,7256,7398,4502,7400,7402,7404,7406,7408,7410,7412,7414,7416,7418,7420,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {7422,7425,7428,7431,7435,7439,7439,0,0,0,0,0,0,0,0,0,0,0,0,7442,7445,7448,7451,7454,0,0,0,0,0,7457,0,7460,
+  7463,3444,3450,7465,7467,7469,7471,7473,7475,3380,7477,7480,7483,7487,7491,7494,7497,7500,7503,7506,7509,7512,7515,0,7518,7521,7524,7527,7530,0,7533,0, },
+ {7536,7539,0,7542,7545,0,7548,7551,7554,7557,7560,7563,7566,7569,7572,7575,7578,7578,7580,7580,7580,7580,7582,7582,7582,7582,7584,7584,7584,7584,7586,7586,
+  7586,7586,7588,7588,7588,7588,7590,7590,7590,7590,7592,7592,7592,7592,7594,7594,7594,7594,7596,7596,7596,7596,7598,7598,7598,7598,7600,7600,7600,7600,7602,7602, },
+ {7602,7602,7604,7604,7606,7606,7608,7608,7610,7610,7612,7612,7614,7614,7616,7616,7616,7616,7618,7618,7618,7618,7620,7620,7620,7620,7622,7622,7622,7622,7624,7624,
+  7626,7626,7626,7626,1218,1218,7628,7628,7628,7628,7630,7630,7630,7630,7632,7632,1224,1224,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7634,7634,7634,7634,7636,7636,7638,7638,7640,7640,1212,7642,7642,
+  7644,7644,7646,7646,7648,7648,7648,7648,7650,7650,7652,7652,7656,7656,7660,7660,7664,7664,7668,7668,7672,7672,7676,7676,7676,7680,7680,7680,7684,7684,7684,7684, },
+ {7686,7690,7694,7680,7698,7702,7705,7708,7711,7714,7717,7720,7723,7726,7729,7732,7735,7738,7741,7744,7747,7750,7753,7756,7759,7762,7765,7768,7771,7774,7777,7780,
+  7783,7786,7789,7792,7795,7798,7801,7804,7807,7810,7813,7816,7819,7822,7825,7828,7831,7834,7837,7840,7843,7846,7849,7852,7855,7858,7861,7864,7867,7870,7873,7876, },
+ {7879,7882,7885,7888,7891,7894,7897,7900,7903,7906,7909,7912,7915,7918,7921,7924,7927,7930,7933,7936,7939,7942,7945,7948,7951,7954,7957,7960,7963,7966,7969,7973,
+  7977,7981,7985,7989,7993,7997,7694,8001,7680,7698,8005,8008,7711,8011,7714,7717,8014,8017,7729,8020,7732,7735,8023,8026,7741,8029,7744,7747,7834,7837,7846,7849, },
+ {7852,7864,7867,7870,7873,7885,7888,7891,8032,7903,8035,8038,7921,8041,7924,7927,7966,8044,8047,7951,8050,7954,7957,7686,7690,8053,7694,8057,7702,7705,7708,7711,
+  8061,7720,7723,7726,7729,8064,7741,7750,7753,7756,7759,7762,7768,7771,7774,7777,7780,7783,8067,7786,7789,7792,7795,7798,7801,7807,7810,7813,7816,7819,7822,7825, },
+ {7828,7831,7840,7843,7855,7858,7861,7864,7867,7876,7879,7882,7885,8070,7894,7897,7900,7903,7912,7915,7918,7921,8073,7930,7933,8076,7942,7945,7948,7951,8079,7694,
+  8057,7711,8061,7729,8064,7741,8082,7780,8085,8088,8091,7864,7867,7885,7921,8073,7951,8079,8094,8098,8102,8106,8109,8112,8115,8118,8121,8124,8127,8130,8133,8136, },
+ {8139,8142,8145,8148,8151,8154,8157,8160,8163,8166,8169,8172,8088,8175,8178,8181,8184,8106,8109,8112,8115,8118,8121,8124,8127,8130,8133,8136,8139,8142,8145,8148,
+  8151,8154,8157,8160,8163,8166,8169,8172,8088,8175,8178,8181,8184,8166,8169,8172,8088,8085,8091,7804,7771,7774,7777,8166,8169,8172,7804,7807,8187,8187,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8190,8194,8194,8198,8202,8206,8210,8214,8218,8218,8222,8226,8230,8234,8238,8242,
+  8242,8246,8250,8250,8254,8254,8258,8262,8262,8266,8270,8270,8274,8274,8278,8282,8282,8286,8286,8290,8294,8298,8302,8302,8306,8310,8314,8318,8322,8322,8326,8330, },
+ {8334,8338,8342,8346,8346,8350,8350,8354,8354,8358,8362,8366,8370,8374,8378,8382,0,0,8386,8390,8394,8398,8402,8406,8406,8410,8414,8418,8422,8422,8426,8430,
+  8434,8438,8442,8446,8450,8454,8458,8462,8466,8470,8474,8478,8482,8486,8490,8494,8498,8502,8506,8510,8326,8334,8514,8518,8522,8526,8530,8534,8530,8522,8538,8542, },
+ {8546,8550,8554,8534,8298,8258,8558,8562,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8566,8570,8574,8579,8584,8589,8594,8599,8604,8609,8613,8632,8641,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8646,8648,8650,8652,931,8654,8656,8658,8660,3328,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3325,8662,8664,8666,8666,3386,3388,8668,8670,8672,8674,8676,8678,8680,8682,3744, },
+ {3746,8684,8686,8688,8690,0,0,8692,8694,3349,3349,3349,3349,8666,8666,8666,8646,8648,3323,0,931,8652,8656,8654,8662,3386,3388,8668,8670,8672,8674,8696,
+  8698,8700,3380,8702,8704,8706,3384,0,8708,8710,8712,8714,0,0,0,0,8716,8719,8722,0,8725,0,8728,8731,8734,8737,8740,8743,8746,8749,8752,8755, },
+ {8758,1191,1191,1194,1194,1197,1197,1200,1200,1203,1203,1203,1203,8760,8760,8762,8762,8762,8762,8764,8764,8766,8766,8766,8766,8768,8768,8768,8768,8770,8770,8770,
+  8770,8772,8772,8772,8772,8774,8774,8774,8774,8776,8776,8778,8778,8780,8780,8782,8782,8784,8784,8784,8784,8786,8786,8786,8786,8788,8788,8788,8788,8790,8790,8790, },
+ {8790,8792,8792,8792,8792,8794,8794,8794,8794,8796,8796,8796,8796,8798,8798,8798,8798,8800,8800,8800,8800,8802,8802,8802,8802,8804,8804,8804,8804,8806,8806,8806,
+  8806,8808,8808,8808,8808,8810,8810,8810,8810,8812,8812,8812,8812,8814,8814,7650,7650,8816,8816,8816,8816,8818,8818,8822,8822,8826,8826,8830,8830,0,0,0, },
+ {0,8654,8833,8696,8710,8712,8698,8835,3386,3388,8700,3380,8646,8702,3323,8837,3366,23,11,13,3368,3370,3372,3374,3376,3378,8652,931,8704,3384,8706,8656,
+  8714,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,8692,8708,8694,8839,8666, },
+ {3280,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,8668,8841,8670,8843,8845,
+  8847,8650,8684,8686,8648,8849,5561,8851,8853,8855,8857,8859,8861,8863,8865,8867,8869,5469,5471,5473,5475,5477,5479,5481,5483,5485,5487,5489,5491,5493,5495,5497, },
+ {5499,5501,5503,5505,5507,5509,5511,5513,5515,5517,5519,5521,5523,5525,5527,5529,5531,5533,5535,5537,5539,5541,5543,5545,5547,5549,5551,5553,5555,8871,8873,8875,
+  4800,4698,4700,4702,4704,4706,4708,4710,4712,4714,4716,4718,4720,4722,4724,4726,4728,4730,4732,4734,4736,4738,4740,4742,4744,4746,4748,4750,4752,4754,4756,0, },
+ {0,0,4758,4760,4762,4764,4766,4768,0,0,4770,4772,4774,4776,4778,4780,0,0,4782,4784,4786,4788,4790,4792,0,0,4794,4796,4798,0,0,0,
+  8877,8879,8881,8,8883,8885,8887,0,8889,8891,8893,8895,8897,8899,8901,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,8903,8905,8907,8909,8911,0,8913,8915,8917,8919,8921,8923,8925,8927,8929,8931,8933,8935,8937,8939,3421,8941,8943,8945,8947,8949,8951,8953,8955,8957,8959,
+  8961,8963,8965,8967,8969,4051,8971,8973,8975,8977,8979,8981,8983,8985,8987,8989,8991,0,8993,8995,8997,8999,9001,9003,9005,9007,9009,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9011,0,9014,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,9017,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,9020,9023,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,9026,9029,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9032,9035,0,9038,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9041,9044,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9047,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9050,9053,
+  9056,9060,9064,9068,9072,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9076,9079,9082,9086,9090, },
+ {9094,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,
+  1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494, },
+ {1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,1532,0,1566,877,1534,911,1536,3390,25,1546,4051,879,
+  537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553, },
+ {4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,0,3403,1478,
+  0,0,1484,0,0,1490,1492,0,0,1498,1500,1504,3426,0,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,0,1578,0,873,1566,877, },
+ {1534,911,1536,3390,0,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,
+  3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556, },
+ {887,913,889,1632,1472,1476,0,1478,1480,3442,1484,0,0,1490,1492,1494,1496,1498,1500,1504,3426,0,4047,1508,1510,3536,1512,3553,4049,0,6,1520,
+  1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,1476,0,1478,1480,3442,1484,0, },
+ {1488,1490,1492,1494,1496,0,1500,0,0,0,4047,1508,1510,3536,1512,3553,4049,0,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,
+  25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,3426,1506,4047,1508, },
+ {1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,
+  1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578, },
+ {1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,
+  1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879, },
+ {537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,
+  4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478, },
+ {1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504,3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,
+  1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,887,913,889,1632,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504, },
+ {3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,6,1520,1572,1522,1524,1578,1532,873,1566,877,1534,911,1536,3390,25,1546,4051,879,537,1548,1550,1556,
+  887,913,889,1632,9098,9100,0,0,9102,9104,3456,9106,9108,9110,9112,1026,9114,9116,9118,9120,9122,9124,9126,3458,9128,1026,1030,9130,1008,9132,9134,9136, },
+ {3440,9138,9140,1004,1560,1562,1028,9142,9144,1006,3131,1020,9146,18,9148,9150,9152,1018,1022,1024,9154,9156,9158,1016,1564,9160,9162,9164,1028,1006,1020,1016,
+  1022,1018,9102,9104,3456,9106,9108,9110,9112,1026,9114,9116,9118,9120,9122,9124,9126,3458,9128,1026,1030,9130,1008,9132,9134,9136,3440,9138,9140,1004,1560,1562, },
+ {1028,9142,9144,1006,3131,1020,9146,18,9148,9150,9152,1018,1022,1024,9154,9156,9158,1016,1564,9160,9162,9164,1028,1006,1020,1016,1022,1018,9102,9104,3456,9106,
+  9108,9110,9112,1026,9114,9116,9118,9120,9122,9124,9126,3458,9128,1026,1030,9130,1008,9132,9134,9136,3440,9138,9140,1004,1560,1562,1028,9142,9144,1006,3131,1020, },
+ {9146,18,9148,9150,9152,1018,1022,1024,9154,9156,9158,1016,1564,9160,9162,9164,1028,1006,1020,1016,1022,1018,9102,9104,3456,9106,9108,9110,9112,1026,9114,9116,
+  9118,9120,9122,9124,9126,3458,9128,1026,1030,9130,1008,9132,9134,9136,3440,9138,9140,1004,1560,1562,1028,9142,9144,1006,3131,1020,9146,18,9148,9150,9152,1018, },
+ {1022,1024,9154,9156,9158,1016,1564,9160,9162,9164,1028,1006,1020,1016,1022,1018,9102,9104,3456,9106,9108,9110,9112,1026,9114,9116,9118,9120,9122,9124,9126,3458,
+  9128,1026,1030,9130,1008,9132,9134,9136,3440,9138,9140,1004,1560,1562,1028,9142,9144,1006,3131,1020,9146,18,9148,9150,9152,1018,1022,1024,9154,9156,9158,1016, },
+ {1564,9160,9162,9164,1028,1006,1020,1016,1022,1018,9166,9168,0,0,3366,23,11,13,3368,3370,3372,3374,3376,3378,3366,23,11,13,3368,3370,3372,3374,
+  3376,3378,3366,23,11,13,3368,3370,3372,3374,3376,3378,3366,23,11,13,3368,3370,3372,3374,3376,3378,3366,23,11,13,3368,3370,3372,3374,3376,3378, },
+ {8760,8762,8770,8776,0,8814,8782,8772,8792,8816,8804,8806,8808,8810,8784,8796,8800,8788,8802,8780,8786,8766,8768,8774,8778,8790,8794,8798,9170,7624,9172,9174,
+  0,8762,8770,0,8812,0,0,8772,0,8816,8804,8806,8808,8810,8784,8796,8800,8788,8802,0,8786,8766,8768,8774,0,8790,0,8798,0,0,0,0, },
+ {0,0,8770,0,0,0,0,8772,0,8816,0,8806,0,8810,8784,8796,0,8788,8802,0,8786,0,0,8774,0,8790,0,8798,0,7624,0,9174,
+  0,8762,8770,0,8812,0,0,8772,8792,8816,8804,0,8808,8810,8784,8796,8800,8788,8802,0,8786,8766,8768,8774,0,8790,8794,8798,9170,0,9172,0, },
+ {8760,8762,8770,8776,8812,8814,8782,8772,8792,8816,0,8806,8808,8810,8784,8796,8800,8788,8802,8780,8786,8766,8768,8774,8778,8790,8794,8798,0,0,0,0,
+  0,8762,8770,8776,0,8814,8782,8772,8792,8816,0,8806,8808,8810,8784,8796,8800,8788,8802,8780,8786,8766,8768,8774,8778,8790,8794,8798,0,0,0,0, },
+ {9176,9179,9182,9185,9188,9191,9194,9197,9200,9203,9206,0,0,0,0,0,9209,9213,9217,9221,9225,9229,9233,9237,9241,9245,9249,9253,9257,9261,9265,9269,
+  9273,9277,9281,9285,9289,9293,9297,9301,9305,9309,9313,3403,1506,9317,9320,0,1472,1476,3403,1478,1480,3442,1484,1486,1488,1490,1492,1494,1496,1498,1500,1504, },
+ {3426,1506,4047,1508,1510,3536,1512,3553,4049,3438,9323,6341,9326,9329,9332,9336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,9339,9342,9345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {9351,9354,5489,0,0,0,0,0,0,0,0,0,0,0,0,0,4204,9357,9359,4641,4090,9361,9363,4902,9365,9367,9369,6966,9371,9373,9375,9377,
+  9379,9381,4276,9383,9385,9387,9389,9391,9393,4078,4886,9395,5351,4892,5353,9397,4388,9399,9401,9403,9405,9407,5317,4224,9409,9411,9413,9415,0,0,0,0, },
+ {9417,9421,9425,9429,9433,9437,9441,9445,9449,0,0,0,0,0,0,0,9453,9455,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3366,23,11,13,3368,3370,3372,3374,3376,3378,0,0,0,0,0,0, },
+ {9457,9459,9461,9463,9465,7152,9467,9469,9471,9473,7154,9475,9477,9479,7156,9481,9483,9485,9487,9489,9491,9375,9493,9495,9497,9499,9501,7266,9503,4110,9505,9507,
+  9509,9511,9411,9513,9515,7276,7158,7160,7278,9517,9519,6794,9521,7162,9523,9525,9527,9529,9529,9529,9531,9533,9535,9537,9539,9541,9543,9545,9547,9549,9551,9553, },
+ {9555,9557,9559,9561,9563,9565,9565,7282,9567,9569,9571,9573,7166,9575,9577,9579,7086,9581,9583,9585,9587,9589,9591,9593,9595,9597,9599,9601,9603,9361,9605,9607,
+  9609,9611,9613,9615,9617,9619,9621,9623,9625,9627,9629,9629,9631,9633,9635,6786,9637,9639,9641,9643,9645,4162,9647,9649,4166,9651,9653,9655,9657,9659,9661,9663, },
+ {9665,9667,9669,9671,9673,9675,9677,9679,9681,9683,9685,9687,9689,9691,6682,9693,4186,9695,9695,9697,9699,9699,9701,9703,9705,9707,9709,9711,9713,9715,9717,9719,
+  9721,9723,9725,7176,9727,9729,9731,9733,7306,9733,9735,7180,9737,9739,9741,9743,7182,6628,9745,9747,9749,9751,9753,9755,9757,9759,9761,9763,9765,9767,9769,9771, },
+ {9773,9775,9777,9779,9781,9783,9785,9787,7184,9789,9791,9793,9795,9797,9799,7188,9801,9803,9805,9807,9809,9811,9813,9815,6684,7322,9817,9819,9821,9823,9825,9827,
+  9829,9831,7190,9833,9835,9837,9839,7406,9841,9843,9845,9847,9849,9851,9853,9855,9857,9859,9861,9863,9865,6820,9867,9869,9871,9873,9875,9877,9879,9881,9883,9885, },
+ {9887,7192,6986,9889,9891,9893,9895,9897,9899,9901,9903,7328,9905,9907,9909,9911,9913,9915,9917,9919,7330,9921,9923,9925,9927,9929,9931,9933,9935,9937,9939,9941,
+  9943,7334,9945,9947,9949,9951,9953,9955,9957,9959,9961,9963,9965,9965,9967,9969,7338,9971,9973,9975,9977,9979,9981,9983,6792,9985,9987,9989,9991,9993,9995,9997, },
+ {7350,9999,10001,10003,10005,10007,10009,10009,7352,7410,10011,10013,10015,10017,10019,6718,7356,10021,10023,7212,10025,10027,7126,10029,10031,7218,10033,10035,10037,10039,10039,10041,
+  10043,10045,10047,10049,10051,10053,10055,10057,10059,10061,10063,10065,10067,10069,10071,10073,10075,10077,10079,10081,10083,10085,10087,10089,10091,10093,7230,10095,10097,10099,10101,10103, },
+ {10105,10107,10109,10111,10113,10115,10117,10119,10121,10123,10125,9697,10127,10129,10131,10133,10135,10137,10139,10141,10143,10145,10147,10149,6826,10151,10153,10155,10157,10159,10161,7236,
+  10163,10165,10167,10169,10171,10173,10175,10177,10179,10181,10183,10185,10187,10189,10191,10193,10195,10197,10199,10201,6708,10203,10205,10207,10209,10211,10213,7370,10215,10217,10219,10221, },
+ {10223,10225,10227,10229,4366,10231,10233,10235,10237,10239,10241,10243,10245,10247,10249,10251,7380,7382,4380,10253,10255,10257,10259,10261,10263,10265,10267,10269,10271,10273,10275,7384,
+  10277,10279,10281,10283,10285,10287,10289,10291,10293,10295,10297,10299,10301,10303,10305,10307,10309,10311,10313,10315,10317,10319,10321,10323,10325,10327,10329,10331,10333,10335,7396,7396, },
+ {10337,10339,10341,10343,10345,10347,10349,10351,10353,10355,7398,10357,10359,10361,10363,10365,10367,10369,10371,10373,10375,4476,10377,4484,10379,10381,10383,10385,4494,10387,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, },
+};
+constinit const unsigned char mojibake::detail::compatDecompLookup[3049] {
+ 0,0,1,2,3,4,5,6,7,0,8,9,0,10,11,12,
+ 13,14,0,15,0,0,16,0,17,18,0,19,0,0,0,0,
+ 0,0,0,0,20,21,0,22,23,24,0,0,0,25,26,27,
+ 0,28,0,29,0,30,0,31,32,0,33,34,35,36,37,0,
+ 38,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,40,41,0,0,
+ 0,0,0,0,42,43,44,0,45,46,47,48,49,50,51,52,
+ 53,54,55,0,56,57,58,59,60,61,62,63,64,0,0,0,
+ 0,65,66,67,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,68,69,0,70,0,0,0,0,
+ 0,71,0,0,0,72,0,0,0,0,73,74,75,76,77,78,
+ 79,80,81,82,83,84,85,0,86,87,88,89,90,91,92,93,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,94,0,0,95,0,96,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,97,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,98,99,100,101,102,103,104,105,106,107,108,109,
+ 110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,127,0,128,0,0,0,0,0,0,0,0,129,0,0,
+ 0,0,130,0,0,0,131,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,132,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,133,134,135,0,0,0,0,0,0,0,0,
+ 136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,152,153,154,0,0,0,0,0,
+ 0,0,0,0,155,156,157,0,158,159,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 161,162,163,164,165,166,167,168,169,
+};
+constinit const char32_t mojibake::detail::normPool[10389] {
+ 0,1,32,2,32,776,1,97,2,32,772,1,50,1,51,2,
+ 32,769,1,956,2,32,807,1,49,1,111,3,49,8260,52,3,
+ 49,8260,50,3,51,8260,52,2,65,768,2,65,769,2,65,770,
+ 2,65,771,2,65,776,2,65,778,2,67,807,2,69,768,2,
+ 69,769,2,69,770,2,69,776,2,73,768,2,73,769,2,73,
+ 770,2,73,776,2,78,771,2,79,768,2,79,769,2,79,770,
+ 2,79,771,2,79,776,2,85,768,2,85,769,2,85,770,2,
+ 85,776,2,89,769,2,97,768,2,97,769,2,97,770,2,97,
+ 771,2,97,776,2,97,778,2,99,807,2,101,768,2,101,769,
+ 2,101,770,2,101,776,2,105,768,2,105,769,2,105,770,2,
+ 105,776,2,110,771,2,111,768,2,111,769,2,111,770,2,111,
+ 771,2,111,776,2,117,768,2,117,769,2,117,770,2,117,776,
+ 2,121,769,2,121,776,2,65,772,2,97,772,2,65,774,2,
+ 97,774,2,65,808,2,97,808,2,67,769,2,99,769,2,67,
+ 770,2,99,770,2,67,775,2,99,775,2,67,780,2,99,780,
+ 2,68,780,2,100,780,2,69,772,2,101,772,2,69,774,2,
+ 101,774,2,69,775,2,101,775,2,69,808,2,101,808,2,69,
+ 780,2,101,780,2,71,770,2,103,770,2,71,774,2,103,774,
+ 2,71,775,2,103,775,2,71,807,2,103,807,2,72,770,2,
+ 104,770,2,73,771,2,105,771,2,73,772,2,105,772,2,73,
+ 774,2,105,774,2,73,808,2,105,808,2,73,775,2,73,74,
+ 2,105,106,2,74,770,2,106,770,2,75,807,2,107,807,2,
+ 76,769,2,108,769,2,76,807,2,108,807,2,76,780,2,108,
+ 780,2,76,183,2,108,183,2,78,769,2,110,769,2,78,807,
+ 2,110,807,2,78,780,2,110,780,2,700,110,2,79,772,2,
+ 111,772,2,79,774,2,111,774,2,79,779,2,111,779,2,82,
+ 769,2,114,769,2,82,807,2,114,807,2,82,780,2,114,780,
+ 2,83,769,2,115,769,2,83,770,2,115,770,2,83,807,2,
+ 115,807,2,83,780,2,115,780,2,84,807,2,116,807,2,84,
+ 780,2,116,780,2,85,771,2,117,771,2,85,772,2,117,772,
+ 2,85,774,2,117,774,2,85,778,2,117,778,2,85,779,2,
+ 117,779,2,85,808,2,117,808,2,87,770,2,119,770,2,89,
+ 770,2,121,770,2,89,776,2,90,769,2,122,769,2,90,775,
+ 2,122,775,2,90,780,2,122,780,1,115,2,79,795,2,111,
+ 795,2,85,795,2,117,795,3,68,90,780,3,68,122,780,3,
+ 100,122,780,2,76,74,2,76,106,2,108,106,2,78,74,2,
+ 78,106,2,110,106,2,65,780,2,97,780,2,73,780,2,105,
+ 780,2,79,780,2,111,780,2,85,780,2,117,780,3,85,776,
+ 772,3,117,776,772,3,85,776,769,3,117,776,769,3,85,776,
+ 780,3,117,776,780,3,85,776,768,3,117,776,768,3,65,776,
+ 772,3,97,776,772,3,65,775,772,3,97,775,772,2,198,772,
+ 2,230,772,2,71,780,2,103,780,2,75,780,2,107,780,2,
+ 79,808,2,111,808,3,79,808,772,3,111,808,772,2,439,780,
+ 2,658,780,2,106,780,2,68,90,2,68,122,2,100,122,2,
+ 71,769,2,103,769,2,78,768,2,110,768,3,65,778,769,3,
+ 97,778,769,2,198,769,2,230,769,2,216,769,2,248,769,2,
+ 65,783,2,97,783,2,65,785,2,97,785,2,69,783,2,101,
+ 783,2,69,785,2,101,785,2,73,783,2,105,783,2,73,785,
+ 2,105,785,2,79,783,2,111,783,2,79,785,2,111,785,2,
+ 82,783,2,114,783,2,82,785,2,114,785,2,85,783,2,117,
+ 783,2,85,785,2,117,785,2,83,806,2,115,806,2,84,806,
+ 2,116,806,2,72,780,2,104,780,2,65,775,2,97,775,2,
+ 69,807,2,101,807,3,79,776,772,3,111,776,772,3,79,771,
+ 772,3,111,771,772,2,79,775,2,111,775,3,79,775,772,3,
+ 111,775,772,2,89,772,2,121,772,1,104,1,614,1,106,1,
+ 114,1,633,1,635,1,641,1,119,1,121,2,32,774,2,32,
+ 775,2,32,778,2,32,808,2,32,771,2,32,779,1,611,1,
+ 108,1,120,1,661,1,768,1,769,1,787,2,776,769,1,697,
+ 2,32,837,1,59,2,168,769,3,32,776,769,2,913,769,1,
+ 183,2,917,769,2,919,769,2,921,769,2,927,769,2,933,769,
+ 2,937,769,3,953,776,769,2,921,776,2,933,776,2,945,769,
+ 2,949,769,2,951,769,2,953,769,3,965,776,769,2,953,776,
+ 2,965,776,2,959,769,2,965,769,2,969,769,1,946,1,952,
+ 1,933,2,978,769,2,978,776,1,966,1,960,1,954,1,961,
+ 1,962,1,920,1,949,1,931,2,1045,768,2,1045,776,2,1043,
+ 769,2,1030,776,2,1050,769,2,1048,768,2,1059,774,2,1048,774,
+ 2,1080,774,2,1077,768,2,1077,776,2,1075,769,2,1110,776,2,
+ 1082,769,2,1080,768,2,1091,774,2,1140,783,2,1141,783,2,1046,
+ 774,2,1078,774,2,1040,774,2,1072,774,2,1040,776,2,1072,776,
+ 2,1045,774,2,1077,774,2,1240,776,2,1241,776,2,1046,776,2,
+ 1078,776,2,1047,776,2,1079,776,2,1048,772,2,1080,772,2,1048,
+ 776,2,1080,776,2,1054,776,2,1086,776,2,1256,776,2,1257,776,
+ 2,1069,776,2,1101,776,2,1059,772,2,1091,772,2,1059,776,2,
+ 1091,776,2,1059,779,2,1091,779,2,1063,776,2,1095,776,2,1067,
+ 776,2,1099,776,2,1381,1410,2,1575,1619,2,1575,1620,2,1608,1620,
+ 2,1575,1621,2,1610,1620,2,1575,1652,2,1608,1652,2,1735,1652,2,
+ 1610,1652,2,1749,1620,2,1729,1620,2,1746,1620,2,2344,2364,2,2352,
+ 2364,2,2355,2364,2,2325,2364,2,2326,2364,2,2327,2364,2,2332,2364,
+ 2,2337,2364,2,2338,2364,2,2347,2364,2,2351,2364,2,2503,2494,2,
+ 2503,2519,2,2465,2492,2,2466,2492,2,2479,2492,2,2610,2620,2,2616,
+ 2620,2,2582,2620,2,2583,2620,2,2588,2620,2,2603,2620,2,2887,2902,
+ 2,2887,2878,2,2887,2903,2,2849,2876,2,2850,2876,2,2962,3031,2,
+ 3014,3006,2,3015,3006,2,3014,3031,2,3142,3158,2,3263,3285,2,3270,
+ 3285,2,3270,3286,2,3270,3266,3,3270,3266,3285,2,3398,3390,2,3399,
+ 3390,2,3398,3415,2,3545,3530,2,3545,3535,3,3545,3535,3530,2,3545,
+ 3551,2,3661,3634,2,3789,3762,2,3755,3737,2,3755,3745,1,3851,2,
+ 3906,4023,2,3916,4023,2,3921,4023,2,3926,4023,2,3931,4023,2,3904,
+ 4021,2,3953,3954,2,3953,3956,2,4018,3968,3,4018,3953,3968,2,4019,
+ 3968,3,4019,3953,3968,2,3953,3968,2,3986,4023,2,3996,4023,2,4001,
+ 4023,2,4006,4023,2,4011,4023,2,3984,4021,2,4133,4142,1,4316,2,
+ 6917,6965,2,6919,6965,2,6921,6965,2,6923,6965,2,6925,6965,2,6929,
+ 6965,2,6970,6965,2,6972,6965,2,6974,6965,2,6975,6965,2,6978,6965,
+ 1,65,1,198,1,66,1,68,1,69,1,398,1,71,1,72,
+ 1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,546,
+ 1,80,1,82,1,84,1,85,1,87,1,592,1,593,1,7426,
+ 1,98,1,100,1,101,1,601,1,603,1,604,1,103,1,107,
+ 1,109,1,331,1,596,1,7446,1,7447,1,112,1,116,1,117,
+ 1,7453,1,623,1,118,1,7461,1,947,1,948,1,967,1,105,
+ 1,1085,1,594,1,99,1,597,1,240,1,102,1,607,1,609,
+ 1,613,1,616,1,617,1,618,1,7547,1,669,1,621,1,7557,
+ 1,671,1,625,1,624,1,626,1,627,1,628,1,629,1,632,
+ 1,642,1,643,1,427,1,649,1,650,1,7452,1,651,1,652,
+ 1,122,1,656,1,657,1,658,2,65,805,2,97,805,2,66,
+ 775,2,98,775,2,66,803,2,98,803,2,66,817,2,98,817,
+ 3,67,807,769,3,99,807,769,2,68,775,2,100,775,2,68,
+ 803,2,100,803,2,68,817,2,100,817,2,68,807,2,100,807,
+ 2,68,813,2,100,813,3,69,772,768,3,101,772,768,3,69,
+ 772,769,3,101,772,769,2,69,813,2,101,813,2,69,816,2,
+ 101,816,3,69,807,774,3,101,807,774,2,70,775,2,102,775,
+ 2,71,772,2,103,772,2,72,775,2,104,775,2,72,803,2,
+ 104,803,2,72,776,2,104,776,2,72,807,2,104,807,2,72,
+ 814,2,104,814,2,73,816,2,105,816,3,73,776,769,3,105,
+ 776,769,2,75,769,2,107,769,2,75,803,2,107,803,2,75,
+ 817,2,107,817,2,76,803,2,108,803,3,76,803,772,3,108,
+ 803,772,2,76,817,2,108,817,2,76,813,2,108,813,2,77,
+ 769,2,109,769,2,77,775,2,109,775,2,77,803,2,109,803,
+ 2,78,775,2,110,775,2,78,803,2,110,803,2,78,817,2,
+ 110,817,2,78,813,2,110,813,3,79,771,769,3,111,771,769,
+ 3,79,771,776,3,111,771,776,3,79,772,768,3,111,772,768,
+ 3,79,772,769,3,111,772,769,2,80,769,2,112,769,2,80,
+ 775,2,112,775,2,82,775,2,114,775,2,82,803,2,114,803,
+ 3,82,803,772,3,114,803,772,2,82,817,2,114,817,2,83,
+ 775,2,115,775,2,83,803,2,115,803,3,83,769,775,3,115,
+ 769,775,3,83,780,775,3,115,780,775,3,83,803,775,3,115,
+ 803,775,2,84,775,2,116,775,2,84,803,2,116,803,2,84,
+ 817,2,116,817,2,84,813,2,116,813,2,85,804,2,117,804,
+ 2,85,816,2,117,816,2,85,813,2,117,813,3,85,771,769,
+ 3,117,771,769,3,85,772,776,3,117,772,776,2,86,771,2,
+ 118,771,2,86,803,2,118,803,2,87,768,2,119,768,2,87,
+ 769,2,119,769,2,87,776,2,119,776,2,87,775,2,119,775,
+ 2,87,803,2,119,803,2,88,775,2,120,775,2,88,776,2,
+ 120,776,2,89,775,2,121,775,2,90,770,2,122,770,2,90,
+ 803,2,122,803,2,90,817,2,122,817,2,104,817,2,116,776,
+ 2,119,778,2,121,778,2,97,702,2,383,775,2,65,803,2,
+ 97,803,2,65,777,2,97,777,3,65,770,769,3,97,770,769,
+ 3,65,770,768,3,97,770,768,3,65,770,777,3,97,770,777,
+ 3,65,770,771,3,97,770,771,3,65,803,770,3,97,803,770,
+ 3,65,774,769,3,97,774,769,3,65,774,768,3,97,774,768,
+ 3,65,774,777,3,97,774,777,3,65,774,771,3,97,774,771,
+ 3,65,803,774,3,97,803,774,2,69,803,2,101,803,2,69,
+ 777,2,101,777,2,69,771,2,101,771,3,69,770,769,3,101,
+ 770,769,3,69,770,768,3,101,770,768,3,69,770,777,3,101,
+ 770,777,3,69,770,771,3,101,770,771,3,69,803,770,3,101,
+ 803,770,2,73,777,2,105,777,2,73,803,2,105,803,2,79,
+ 803,2,111,803,2,79,777,2,111,777,3,79,770,769,3,111,
+ 770,769,3,79,770,768,3,111,770,768,3,79,770,777,3,111,
+ 770,777,3,79,770,771,3,111,770,771,3,79,803,770,3,111,
+ 803,770,3,79,795,769,3,111,795,769,3,79,795,768,3,111,
+ 795,768,3,79,795,777,3,111,795,777,3,79,795,771,3,111,
+ 795,771,3,79,795,803,3,111,795,803,2,85,803,2,117,803,
+ 2,85,777,2,117,777,3,85,795,769,3,117,795,769,3,85,
+ 795,768,3,117,795,768,3,85,795,777,3,117,795,777,3,85,
+ 795,771,3,117,795,771,3,85,795,803,3,117,795,803,2,89,
+ 768,2,121,768,2,89,803,2,121,803,2,89,777,2,121,777,
+ 2,89,771,2,121,771,2,945,787,2,945,788,3,945,787,768,
+ 3,945,788,768,3,945,787,769,3,945,788,769,3,945,787,834,
+ 3,945,788,834,2,913,787,2,913,788,3,913,787,768,3,913,
+ 788,768,3,913,787,769,3,913,788,769,3,913,787,834,3,913,
+ 788,834,2,949,787,2,949,788,3,949,787,768,3,949,788,768,
+ 3,949,787,769,3,949,788,769,2,917,787,2,917,788,3,917,
+ 787,768,3,917,788,768,3,917,787,769,3,917,788,769,2,951,
+ 787,2,951,788,3,951,787,768,3,951,788,768,3,951,787,769,
+ 3,951,788,769,3,951,787,834,3,951,788,834,2,919,787,2,
+ 919,788,3,919,787,768,3,919,788,768,3,919,787,769,3,919,
+ 788,769,3,919,787,834,3,919,788,834,2,953,787,2,953,788,
+ 3,953,787,768,3,953,788,768,3,953,787,769,3,953,788,769,
+ 3,953,787,834,3,953,788,834,2,921,787,2,921,788,3,921,
+ 787,768,3,921,788,768,3,921,787,769,3,921,788,769,3,921,
+ 787,834,3,921,788,834,2,959,787,2,959,788,3,959,787,768,
+ 3,959,788,768,3,959,787,769,3,959,788,769,2,927,787,2,
+ 927,788,3,927,787,768,3,927,788,768,3,927,787,769,3,927,
+ 788,769,2,965,787,2,965,788,3,965,787,768,3,965,788,768,
+ 3,965,787,769,3,965,788,769,3,965,787,834,3,965,788,834,
+ 2,933,788,3,933,788,768,3,933,788,769,3,933,788,834,2,
+ 969,787,2,969,788,3,969,787,768,3,969,788,768,3,969,787,
+ 769,3,969,788,769,3,969,787,834,3,969,788,834,2,937,787,
+ 2,937,788,3,937,787,768,3,937,788,768,3,937,787,769,3,
+ 937,788,769,3,937,787,834,3,937,788,834,2,945,768,2,949,
+ 768,2,951,768,2,953,768,2,959,768,2,965,768,2,969,768,
+ 3,945,787,837,3,945,788,837,4,945,787,768,837,4,945,788,
+ 768,837,4,945,787,769,837,4,945,788,769,837,4,945,787,834,
+ 837,4,945,788,834,837,3,913,787,837,3,913,788,837,4,913,
+ 787,768,837,4,913,788,768,837,4,913,787,769,837,4,913,788,
+ 769,837,4,913,787,834,837,4,913,788,834,837,3,951,787,837,
+ 3,951,788,837,4,951,787,768,837,4,951,788,768,837,4,951,
+ 787,769,837,4,951,788,769,837,4,951,787,834,837,4,951,788,
+ 834,837,3,919,787,837,3,919,788,837,4,919,787,768,837,4,
+ 919,788,768,837,4,919,787,769,837,4,919,788,769,837,4,919,
+ 787,834,837,4,919,788,834,837,3,969,787,837,3,969,788,837,
+ 4,969,787,768,837,4,969,788,768,837,4,969,787,769,837,4,
+ 969,788,769,837,4,969,787,834,837,4,969,788,834,837,3,937,
+ 787,837,3,937,788,837,4,937,787,768,837,4,937,788,768,837,
+ 4,937,787,769,837,4,937,788,769,837,4,937,787,834,837,4,
+ 937,788,834,837,2,945,774,2,945,772,3,945,768,837,2,945,
+ 837,3,945,769,837,2,945,834,3,945,834,837,2,913,774,2,
+ 913,772,2,913,768,2,913,837,2,32,787,1,953,2,32,834,
+ 2,168,834,3,32,776,834,3,951,768,837,2,951,837,3,951,
+ 769,837,2,951,834,3,951,834,837,2,917,768,2,919,768,2,
+ 919,837,2,8127,768,3,32,787,768,2,8127,769,3,32,787,769,
+ 2,8127,834,3,32,787,834,2,953,774,2,953,772,3,953,776,
+ 768,2,953,834,3,953,776,834,2,921,774,2,921,772,2,921,
+ 768,2,8190,768,3,32,788,768,2,8190,769,3,32,788,769,2,
+ 8190,834,3,32,788,834,2,965,774,2,965,772,3,965,776,768,
+ 2,961,787,2,961,788,2,965,834,3,965,776,834,2,933,774,
+ 2,933,772,2,933,768,2,929,788,2,168,768,3,32,776,768,
+ 1,96,3,969,768,837,2,969,837,3,969,769,837,2,969,834,
+ 3,969,834,837,2,927,768,2,937,768,2,937,837,1,180,2,
+ 32,788,1,8194,1,8195,1,8208,2,32,819,1,46,2,46,46,
+ 3,46,46,46,2,8242,8242,3,8242,8242,8242,2,8245,8245,3,8245,
+ 8245,8245,2,33,33,2,32,773,2,63,63,2,63,33,2,33,
+ 63,4,8242,8242,8242,8242,1,48,1,52,1,53,1,54,1,55,
+ 1,56,1,57,1,43,1,8722,1,61,1,40,1,41,1,110,
+ 2,82,115,3,97,47,99,3,97,47,115,1,67,2,176,67,
+ 3,99,47,111,3,99,47,117,1,400,2,176,70,1,295,2,
+ 78,111,1,81,2,83,77,3,84,69,76,2,84,77,1,90,
+ 1,937,1,70,1,1488,1,1489,1,1490,1,1491,3,70,65,88,
+ 1,915,1,928,1,8721,3,49,8260,55,3,49,8260,57,4,49,
+ 8260,49,48,3,49,8260,51,3,50,8260,51,3,49,8260,53,3,
+ 50,8260,53,3,51,8260,53,3,52,8260,53,3,49,8260,54,3,
+ 53,8260,54,3,49,8260,56,3,51,8260,56,3,53,8260,56,3,
+ 55,8260,56,2,49,8260,2,73,73,3,73,73,73,2,73,86,
+ 1,86,2,86,73,3,86,73,73,4,86,73,73,73,2,73,
+ 88,1,88,2,88,73,3,88,73,73,2,105,105,3,105,105,
+ 105,2,105,118,2,118,105,3,118,105,105,4,118,105,105,105,
+ 2,105,120,2,120,105,3,120,105,105,3,48,8260,51,2,8592,
+ 824,2,8594,824,2,8596,824,2,8656,824,2,8660,824,2,8658,824,
+ 2,8707,824,2,8712,824,2,8715,824,2,8739,824,2,8741,824,2,
+ 8747,8747,3,8747,8747,8747,2,8750,8750,3,8750,8750,8750,2,8764,824,
+ 2,8771,824,2,8773,824,2,8776,824,2,61,824,2,8801,824,2,
+ 8781,824,2,60,824,2,62,824,2,8804,824,2,8805,824,2,8818,
+ 824,2,8819,824,2,8822,824,2,8823,824,2,8826,824,2,8827,824,
+ 2,8834,824,2,8835,824,2,8838,824,2,8839,824,2,8866,824,2,
+ 8872,824,2,8873,824,2,8875,824,2,8828,824,2,8829,824,2,8849,
+ 824,2,8850,824,2,8882,824,2,8883,824,2,8884,824,2,8885,824,
+ 1,12296,1,12297,2,49,48,2,49,49,2,49,50,2,49,51,
+ 2,49,52,2,49,53,2,49,54,2,49,55,2,49,56,2,
+ 49,57,2,50,48,3,40,49,41,3,40,50,41,3,40,51,
+ 41,3,40,52,41,3,40,53,41,3,40,54,41,3,40,55,
+ 41,3,40,56,41,3,40,57,41,4,40,49,48,41,4,40,
+ 49,49,41,4,40,49,50,41,4,40,49,51,41,4,40,49,
+ 52,41,4,40,49,53,41,4,40,49,54,41,4,40,49,55,
+ 41,4,40,49,56,41,4,40,49,57,41,4,40,50,48,41,
+ 2,49,46,2,50,46,2,51,46,2,52,46,2,53,46,2,
+ 54,46,2,55,46,2,56,46,2,57,46,3,49,48,46,3,
+ 49,49,46,3,49,50,46,3,49,51,46,3,49,52,46,3,
+ 49,53,46,3,49,54,46,3,49,55,46,3,49,56,46,3,
+ 49,57,46,3,50,48,46,3,40,97,41,3,40,98,41,3,
+ 40,99,41,3,40,100,41,3,40,101,41,3,40,102,41,3,
+ 40,103,41,3,40,104,41,3,40,105,41,3,40,106,41,3,
+ 40,107,41,3,40,108,41,3,40,109,41,3,40,110,41,3,
+ 40,111,41,3,40,112,41,3,40,113,41,3,40,114,41,3,
+ 40,115,41,3,40,116,41,3,40,117,41,3,40,118,41,3,
+ 40,119,41,3,40,120,41,3,40,121,41,3,40,122,41,1,
+ 83,1,89,1,113,4,8747,8747,8747,8747,3,58,58,61,2,61,
+ 61,3,61,61,61,2,10973,824,1,11617,1,27597,1,40863,1,19968,
+ 1,20008,1,20022,1,20031,1,20057,1,20101,1,20108,1,20128,1,20154,
+ 1,20799,1,20837,1,20843,1,20866,1,20886,1,20907,1,20960,1,20981,
+ 1,20992,1,21147,1,21241,1,21269,1,21274,1,21304,1,21313,1,21340,
+ 1,21353,1,21378,1,21430,1,21448,1,21475,1,22231,1,22303,1,22763,
+ 1,22786,1,22794,1,22805,1,22823,1,22899,1,23376,1,23424,1,23544,
+ 1,23567,1,23586,1,23608,1,23662,1,23665,1,24027,1,24037,1,24049,
+ 1,24062,1,24178,1,24186,1,24191,1,24308,1,24318,1,24331,1,24339,
+ 1,24400,1,24417,1,24435,1,24515,1,25096,1,25142,1,25163,1,25903,
+ 1,25908,1,25991,1,26007,1,26020,1,26041,1,26080,1,26085,1,26352,
+ 1,26376,1,26408,1,27424,1,27490,1,27513,1,27571,1,27595,1,27604,
+ 1,27611,1,27663,1,27668,1,27700,1,28779,1,29226,1,29238,1,29243,
+ 1,29247,1,29255,1,29273,1,29275,1,29356,1,29572,1,29577,1,29916,
+ 1,29926,1,29976,1,29983,1,29992,1,30000,1,30091,1,30098,1,30326,
+ 1,30333,1,30382,1,30399,1,30446,1,30683,1,30690,1,30707,1,31034,
+ 1,31160,1,31166,1,31348,1,31435,1,31481,1,31859,1,31992,1,32566,
+ 1,32593,1,32650,1,32701,1,32769,1,32780,1,32786,1,32819,1,32895,
+ 1,32905,1,33251,1,33258,1,33267,1,33276,1,33292,1,33307,1,33311,
+ 1,33390,1,33394,1,33400,1,34381,1,34411,1,34880,1,34892,1,34915,
+ 1,35198,1,35211,1,35282,1,35328,1,35895,1,35910,1,35925,1,35960,
+ 1,35997,1,36196,1,36208,1,36275,1,36523,1,36554,1,36763,1,36784,
+ 1,36789,1,37009,1,37193,1,37318,1,37324,1,37329,1,38263,1,38272,
+ 1,38428,1,38582,1,38585,1,38632,1,38737,1,38750,1,38754,1,38761,
+ 1,38859,1,38893,1,38899,1,38913,1,39080,1,39131,1,39135,1,39318,
+ 1,39321,1,39340,1,39592,1,39640,1,39647,1,39717,1,39727,1,39730,
+ 1,39740,1,39770,1,40165,1,40565,1,40575,1,40613,1,40635,1,40643,
+ 1,40653,1,40657,1,40697,1,40701,1,40718,1,40723,1,40736,1,40763,
+ 1,40778,1,40786,1,40845,1,40860,1,40864,1,12306,1,21316,1,21317,
+ 2,12363,12441,2,12365,12441,2,12367,12441,2,12369,12441,2,12371,12441,2,
+ 12373,12441,2,12375,12441,2,12377,12441,2,12379,12441,2,12381,12441,2,12383,
+ 12441,2,12385,12441,2,12388,12441,2,12390,12441,2,12392,12441,2,12399,12441,
+ 2,12399,12442,2,12402,12441,2,12402,12442,2,12405,12441,2,12405,12442,2,
+ 12408,12441,2,12408,12442,2,12411,12441,2,12411,12442,2,12358,12441,2,32,
+ 12441,2,32,12442,2,12445,12441,2,12424,12426,2,12459,12441,2,12461,12441,
+ 2,12463,12441,2,12465,12441,2,12467,12441,2,12469,12441,2,12471,12441,2,
+ 12473,12441,2,12475,12441,2,12477,12441,2,12479,12441,2,12481,12441,2,12484,
+ 12441,2,12486,12441,2,12488,12441,2,12495,12441,2,12495,12442,2,12498,12441,
+ 2,12498,12442,2,12501,12441,2,12501,12442,2,12504,12441,2,12504,12442,2,
+ 12507,12441,2,12507,12442,2,12454,12441,2,12527,12441,2,12528,12441,2,12529,
+ 12441,2,12530,12441,2,12541,12441,2,12467,12488,1,4352,1,4353,1,4522,
+ 1,4354,1,4524,1,4525,1,4355,1,4356,1,4357,1,4528,1,4529,
+ 1,4530,1,4531,1,4532,1,4533,1,4378,1,4358,1,4359,1,4360,
+ 1,4385,1,4361,1,4362,1,4363,1,4364,1,4365,1,4366,1,4367,
+ 1,4368,1,4369,1,4370,1,4449,1,4450,1,4451,1,4452,1,4453,
+ 1,4454,1,4455,1,4456,1,4457,1,4458,1,4459,1,4460,1,4461,
+ 1,4462,1,4463,1,4464,1,4465,1,4466,1,4467,1,4468,1,4469,
+ 1,4448,1,4372,1,4373,1,4551,1,4552,1,4556,1,4558,1,4563,
+ 1,4567,1,4569,1,4380,1,4573,1,4575,1,4381,1,4382,1,4384,
+ 1,4386,1,4387,1,4391,1,4393,1,4395,1,4396,1,4397,1,4398,
+ 1,4399,1,4402,1,4406,1,4416,1,4423,1,4428,1,4593,1,4594,
+ 1,4439,1,4440,1,4441,1,4484,1,4485,1,4488,1,4497,1,4498,
+ 1,4500,1,4510,1,4513,1,19977,1,22235,1,19978,1,20013,1,19979,
+ 1,30002,1,19993,1,19969,1,22825,1,22320,3,40,4352,41,3,40,
+ 4354,41,3,40,4355,41,3,40,4357,41,3,40,4358,41,3,40,
+ 4359,41,3,40,4361,41,3,40,4363,41,3,40,4364,41,3,40,
+ 4366,41,3,40,4367,41,3,40,4368,41,3,40,4369,41,3,40,
+ 4370,41,4,40,4352,4449,41,4,40,4354,4449,41,4,40,4355,4449,
+ 41,4,40,4357,4449,41,4,40,4358,4449,41,4,40,4359,4449,41,
+ 4,40,4361,4449,41,4,40,4363,4449,41,4,40,4364,4449,41,4,
+ 40,4366,4449,41,4,40,4367,4449,41,4,40,4368,4449,41,4,40,
+ 4369,4449,41,4,40,4370,4449,41,4,40,4364,4462,41,7,40,4363,
+ 4457,4364,4453,4523,41,6,40,4363,4457,4370,4462,41,3,40,19968,41,
+ 3,40,20108,41,3,40,19977,41,3,40,22235,41,3,40,20116,41,
+ 3,40,20845,41,3,40,19971,41,3,40,20843,41,3,40,20061,41,
+ 3,40,21313,41,3,40,26376,41,3,40,28779,41,3,40,27700,41,
+ 3,40,26408,41,3,40,37329,41,3,40,22303,41,3,40,26085,41,
+ 3,40,26666,41,3,40,26377,41,3,40,31038,41,3,40,21517,41,
+ 3,40,29305,41,3,40,36001,41,3,40,31069,41,3,40,21172,41,
+ 3,40,20195,41,3,40,21628,41,3,40,23398,41,3,40,30435,41,
+ 3,40,20225,41,3,40,36039,41,3,40,21332,41,3,40,31085,41,
+ 3,40,20241,41,3,40,33258,41,3,40,33267,41,1,21839,1,24188,
+ 1,31631,3,80,84,69,2,50,49,2,50,50,2,50,51,2,
+ 50,52,2,50,53,2,50,54,2,50,55,2,50,56,2,50,
+ 57,2,51,48,2,51,49,2,51,50,2,51,51,2,51,52,
+ 2,51,53,2,4352,4449,2,4354,4449,2,4355,4449,2,4357,4449,2,
+ 4358,4449,2,4359,4449,2,4361,4449,2,4363,4449,2,4364,4449,2,4366,
+ 4449,2,4367,4449,2,4368,4449,2,4369,4449,2,4370,4449,5,4366,4449,
+ 4535,4352,4457,4,4364,4462,4363,4468,2,4363,4462,1,20116,1,20845,1,
+ 19971,1,20061,1,26666,1,26377,1,31038,1,21517,1,29305,1,36001,1,
+ 31069,1,21172,1,31192,1,30007,1,36969,1,20778,1,21360,1,27880,1,
+ 38917,1,20241,1,20889,1,27491,1,24038,1,21491,1,21307,1,23447,1,
+ 23398,1,30435,1,20225,1,36039,1,21332,1,22812,2,51,54,2,51,
+ 55,2,51,56,2,51,57,2,52,48,2,52,49,2,52,50,
+ 2,52,51,2,52,52,2,52,53,2,52,54,2,52,55,2,
+ 52,56,2,52,57,2,53,48,2,49,26376,2,50,26376,2,51,
+ 26376,2,52,26376,2,53,26376,2,54,26376,2,55,26376,2,56,26376,
+ 2,57,26376,3,49,48,26376,3,49,49,26376,3,49,50,26376,2,
+ 72,103,3,101,114,103,2,101,86,3,76,84,68,1,12450,1,
+ 12452,1,12454,1,12456,1,12458,1,12459,1,12461,1,12463,1,12465,1,
+ 12467,1,12469,1,12471,1,12473,1,12475,1,12477,1,12479,1,12481,1,
+ 12484,1,12486,1,12488,1,12490,1,12491,1,12492,1,12493,1,12494,1,
+ 12495,1,12498,1,12501,1,12504,1,12507,1,12510,1,12511,1,12512,1,
+ 12513,1,12514,1,12516,1,12518,1,12520,1,12521,1,12522,1,12523,1,
+ 12524,1,12525,1,12527,1,12528,1,12529,1,12530,2,20196,21644,5,12450,
+ 12495,12442,12540,12488,4,12450,12523,12501,12449,5,12450,12531,12504,12442,12450,3,
+ 12450,12540,12523,5,12452,12491,12531,12463,12441,3,12452,12531,12481,3,12454,12457,
+ 12531,6,12456,12473,12463,12540,12488,12441,4,12456,12540,12459,12540,3,12458,12531,
+ 12473,3,12458,12540,12512,3,12459,12452,12522,4,12459,12521,12483,12488,4,12459,
+ 12525,12522,12540,4,12459,12441,12525,12531,4,12459,12441,12531,12510,4,12461,12441,
+ 12459,12441,4,12461,12441,12491,12540,4,12461,12517,12522,12540,6,12461,12441,12523,
+ 12479,12441,12540,2,12461,12525,6,12461,12525,12463,12441,12521,12512,6,12461,12525,
+ 12513,12540,12488,12523,5,12461,12525,12527,12483,12488,4,12463,12441,12521,12512,6,
+ 12463,12441,12521,12512,12488,12531,6,12463,12523,12475,12441,12452,12525,4,12463,12525,
+ 12540,12493,3,12465,12540,12473,3,12467,12523,12490,4,12467,12540,12507,12442,4,
+ 12469,12452,12463,12523,5,12469,12531,12481,12540,12512,5,12471,12522,12531,12463,12441,
+ 3,12475,12531,12481,3,12475,12531,12488,4,12479,12441,12540,12473,3,12486,12441,
+ 12471,3,12488,12441,12523,2,12488,12531,2,12490,12494,3,12494,12483,12488,3,
+ 12495,12452,12484,6,12495,12442,12540,12475,12531,12488,4,12495,12442,12540,12484,5,
+ 12495,12441,12540,12524,12523,6,12498,12442,12450,12473,12488,12523,4,12498,12442,12463,
+ 12523,3,12498,12442,12467,3,12498,12441,12523,6,12501,12449,12521,12483,12488,12441,
+ 4,12501,12451,12540,12488,6,12501,12441,12483,12471,12455,12523,3,12501,12521,12531,
+ 5,12504,12463,12479,12540,12523,3,12504,12442,12477,4,12504,12442,12491,12498,3,
+ 12504,12523,12484,4,12504,12442,12531,12473,5,12504,12442,12540,12471,12441,4,12504,
+ 12441,12540,12479,5,12507,12442,12452,12531,12488,4,12507,12441,12523,12488,2,12507,
+ 12531,5,12507,12442,12531,12488,12441,3,12507,12540,12523,3,12507,12540,12531,4,
+ 12510,12452,12463,12525,3,12510,12452,12523,3,12510,12483,12495,3,12510,12523,12463,
+ 5,12510,12531,12471,12519,12531,4,12511,12463,12525,12531,2,12511,12522,6,12511,
+ 12522,12495,12441,12540,12523,3,12513,12459,12441,5,12513,12459,12441,12488,12531,4,
+ 12513,12540,12488,12523,4,12516,12540,12488,12441,3,12516,12540,12523,3,12518,12450,
+ 12531,4,12522,12483,12488,12523,2,12522,12521,4,12523,12498,12442,12540,5,12523,
+ 12540,12501,12441,12523,2,12524,12512,6,12524,12531,12488,12465,12441,12531,3,12527,
+ 12483,12488,2,48,28857,2,49,28857,2,50,28857,2,51,28857,2,52,
+ 28857,2,53,28857,2,54,28857,2,55,28857,2,56,28857,2,57,28857,
+ 3,49,48,28857,3,49,49,28857,3,49,50,28857,3,49,51,28857,
+ 3,49,52,28857,3,49,53,28857,3,49,54,28857,3,49,55,28857,
+ 3,49,56,28857,3,49,57,28857,3,50,48,28857,3,50,49,28857,
+ 3,50,50,28857,3,50,51,28857,3,50,52,28857,3,104,80,97,
+ 2,100,97,2,65,85,3,98,97,114,2,111,86,2,112,99,
+ 2,100,109,3,100,109,50,3,100,109,51,2,73,85,2,24179,
+ 25104,2,26157,21644,2,22823,27491,2,26126,27835,4,26666,24335,20250,31038,2,
+ 112,65,2,110,65,2,956,65,2,109,65,2,107,65,2,75,
+ 66,2,77,66,2,71,66,3,99,97,108,4,107,99,97,108,
+ 2,112,70,2,110,70,2,956,70,2,956,103,2,109,103,2,
+ 107,103,2,72,122,3,107,72,122,3,77,72,122,3,71,72,
+ 122,3,84,72,122,2,956,108,2,109,108,2,100,108,2,107,
+ 108,2,102,109,2,110,109,2,956,109,2,109,109,2,99,109,
+ 2,107,109,3,109,109,50,3,99,109,50,2,109,50,3,107,
+ 109,50,3,109,109,51,3,99,109,51,2,109,51,3,107,109,
+ 51,3,109,8725,115,4,109,8725,115,50,2,80,97,3,107,80,
+ 97,3,77,80,97,3,71,80,97,3,114,97,100,5,114,97,
+ 100,8725,115,6,114,97,100,8725,115,50,2,112,115,2,110,115,
+ 2,956,115,2,109,115,2,112,86,2,110,86,2,956,86,2,
+ 109,86,2,107,86,2,77,86,2,112,87,2,110,87,2,956,
+ 87,2,109,87,2,107,87,2,77,87,2,107,937,2,77,937,
+ 4,97,46,109,46,2,66,113,2,99,99,2,99,100,4,67,
+ 8725,107,103,3,67,111,46,2,100,66,2,71,121,2,104,97,
+ 2,72,80,2,105,110,2,75,75,2,75,77,2,107,116,2,
+ 108,109,2,108,110,3,108,111,103,2,108,120,2,109,98,3,
+ 109,105,108,3,109,111,108,2,80,72,4,112,46,109,46,3,
+ 80,80,77,2,80,82,2,115,114,2,83,118,2,87,98,3,
+ 86,8725,109,3,65,8725,109,2,49,26085,2,50,26085,2,51,26085,
+ 2,52,26085,2,53,26085,2,54,26085,2,55,26085,2,56,26085,2,
+ 57,26085,3,49,48,26085,3,49,49,26085,3,49,50,26085,3,49,
+ 51,26085,3,49,52,26085,3,49,53,26085,3,49,54,26085,3,49,
+ 55,26085,3,49,56,26085,3,49,57,26085,3,50,48,26085,3,50,
+ 49,26085,3,50,50,26085,3,50,51,26085,3,50,52,26085,3,50,
+ 53,26085,3,50,54,26085,3,50,55,26085,3,50,56,26085,3,50,
+ 57,26085,3,51,48,26085,3,51,49,26085,3,103,97,108,1,1098,
+ 1,1100,1,42863,1,294,1,339,1,42791,1,43831,1,619,1,43858,
+ 1,653,1,35912,1,26356,1,36040,1,28369,1,20018,1,21477,1,22865,
+ 1,21895,1,22856,1,25078,1,30313,1,32645,1,34367,1,34746,1,35064,
+ 1,37007,1,27138,1,27931,1,28889,1,29662,1,33853,1,37226,1,39409,
+ 1,20098,1,21365,1,27396,1,29211,1,34349,1,40478,1,23888,1,28651,
+ 1,34253,1,35172,1,25289,1,33240,1,34847,1,24266,1,26391,1,28010,
+ 1,29436,1,37070,1,20358,1,20919,1,21214,1,25796,1,27347,1,29200,
+ 1,30439,1,34310,1,34396,1,36335,1,38706,1,39791,1,40442,1,30860,
+ 1,31103,1,32160,1,33737,1,37636,1,35542,1,22751,1,24324,1,31840,
+ 1,32894,1,29282,1,30922,1,36034,1,38647,1,22744,1,23650,1,27155,
+ 1,28122,1,28431,1,32047,1,32311,1,38475,1,21202,1,32907,1,20956,
+ 1,20940,1,31260,1,32190,1,33777,1,38517,1,35712,1,25295,1,35582,
+ 1,20025,1,23527,1,24594,1,29575,1,30064,1,21271,1,30971,1,20415,
+ 1,24489,1,19981,1,27852,1,25976,1,32034,1,21443,1,22622,1,30465,
+ 1,33865,1,35498,1,27578,1,27784,1,25342,1,33509,1,25504,1,30053,
+ 1,20142,1,20841,1,20937,1,26753,1,31975,1,33391,1,35538,1,37327,
+ 1,21237,1,21570,1,24300,1,26053,1,28670,1,31018,1,38317,1,39530,
+ 1,40599,1,40654,1,26310,1,27511,1,36706,1,24180,1,24976,1,25088,
+ 1,25754,1,28451,1,29001,1,29833,1,31178,1,32244,1,32879,1,36646,
+ 1,34030,1,36899,1,37706,1,21015,1,21155,1,21693,1,28872,1,35010,
+ 1,24265,1,24565,1,25467,1,27566,1,31806,1,29557,1,20196,1,22265,
+ 1,23994,1,24604,1,29618,1,29801,1,32666,1,32838,1,37428,1,38646,
+ 1,38728,1,38936,1,20363,1,31150,1,37300,1,38584,1,24801,1,20102,
+ 1,20698,1,23534,1,23615,1,26009,1,29134,1,30274,1,34044,1,36988,
+ 1,26248,1,38446,1,21129,1,26491,1,26611,1,27969,1,28316,1,29705,
+ 1,30041,1,30827,1,32016,1,39006,1,25134,1,38520,1,20523,1,23833,
+ 1,28138,1,36650,1,24459,1,24900,1,26647,1,38534,1,21033,1,21519,
+ 1,23653,1,26131,1,26446,1,26792,1,27877,1,29702,1,30178,1,32633,
+ 1,35023,1,35041,1,38626,1,21311,1,28346,1,21533,1,29136,1,29848,
+ 1,34298,1,38563,1,40023,1,40607,1,26519,1,28107,1,33256,1,31520,
+ 1,31890,1,29376,1,28825,1,35672,1,20160,1,33590,1,21050,1,20999,
+ 1,24230,1,25299,1,31958,1,23429,1,27934,1,26292,1,36667,1,38477,
+ 1,24275,1,20800,1,21952,1,22618,1,26228,1,20958,1,29482,1,30410,
+ 1,31036,1,31070,1,31077,1,31119,1,38742,1,31934,1,34322,1,35576,
+ 1,36920,1,37117,1,39151,1,39164,1,39208,1,40372,1,37086,1,38583,
+ 1,20398,1,20711,1,20813,1,21193,1,21220,1,21329,1,21917,1,22022,
+ 1,22120,1,22592,1,22696,1,23652,1,24724,1,24936,1,24974,1,25074,
+ 1,25935,1,26082,1,26257,1,26757,1,28023,1,28186,1,28450,1,29038,
+ 1,29227,1,29730,1,30865,1,31049,1,31048,1,31056,1,31062,1,31117,
+ 1,31118,1,31296,1,31361,1,31680,1,32265,1,32321,1,32626,1,32773,
+ 1,33261,1,33401,1,33879,1,35088,1,35222,1,35585,1,35641,1,36051,
+ 1,36104,1,36790,1,38627,1,38911,1,38971,1,24693,1,148206,1,33304,
+ 1,20006,1,20917,1,20840,1,20352,1,20805,1,20864,1,21191,1,21242,
+ 1,21845,1,21913,1,21986,1,22707,1,22852,1,22868,1,23138,1,23336,
+ 1,24274,1,24281,1,24425,1,24493,1,24792,1,24910,1,24840,1,24928,
+ 1,25140,1,25540,1,25628,1,25682,1,25942,1,26395,1,26454,1,28379,
+ 1,28363,1,28702,1,30631,1,29237,1,29359,1,29809,1,29958,1,30011,
+ 1,30237,1,30239,1,30427,1,30452,1,30538,1,30528,1,30924,1,31409,
+ 1,31867,1,32091,1,32574,1,33618,1,33775,1,34681,1,35137,1,35206,
+ 1,35519,1,35531,1,35565,1,35722,1,36664,1,36978,1,37273,1,37494,
+ 1,38524,1,38875,1,38923,1,39698,1,141386,1,141380,1,144341,1,15261,
+ 1,16408,1,16441,1,152137,1,154832,1,163539,1,40771,1,40846,2,102,
+ 102,2,102,105,2,102,108,3,102,102,105,3,102,102,108,2,
+ 115,116,2,1396,1398,2,1396,1381,2,1396,1387,2,1406,1398,2,1396,
+ 1389,2,1497,1460,2,1522,1463,1,1506,1,1492,1,1499,1,1500,1,
+ 1501,1,1512,1,1514,2,1513,1473,2,1513,1474,3,1513,1468,1473,3,
+ 1513,1468,1474,2,1488,1463,2,1488,1464,2,1488,1468,2,1489,1468,2,
+ 1490,1468,2,1491,1468,2,1492,1468,2,1493,1468,2,1494,1468,2,1496,
+ 1468,2,1497,1468,2,1498,1468,2,1499,1468,2,1500,1468,2,1502,1468,
+ 2,1504,1468,2,1505,1468,2,1507,1468,2,1508,1468,2,1510,1468,2,
+ 1511,1468,2,1512,1468,2,1513,1468,2,1514,1468,2,1493,1465,2,1489,
+ 1471,2,1499,1471,2,1508,1471,2,1488,1500,1,1649,1,1659,1,1662,
+ 1,1664,1,1658,1,1663,1,1657,1,1700,1,1702,1,1668,1,1667,
+ 1,1670,1,1671,1,1677,1,1676,1,1678,1,1672,1,1688,1,1681,
+ 1,1705,1,1711,1,1715,1,1713,1,1722,1,1723,1,1729,1,1726,
+ 1,1746,1,1709,1,1735,1,1734,1,1736,1,1739,1,1733,1,1737,
+ 1,1744,1,1609,3,1610,1620,1575,3,1610,1620,1749,3,1610,1620,1608,
+ 3,1610,1620,1735,3,1610,1620,1734,3,1610,1620,1736,3,1610,1620,1744,
+ 3,1610,1620,1609,1,1740,3,1610,1620,1580,3,1610,1620,1581,3,1610,
+ 1620,1605,3,1610,1620,1610,2,1576,1580,2,1576,1581,2,1576,1582,2,
+ 1576,1605,2,1576,1609,2,1576,1610,2,1578,1580,2,1578,1581,2,1578,
+ 1582,2,1578,1605,2,1578,1609,2,1578,1610,2,1579,1580,2,1579,1605,
+ 2,1579,1609,2,1579,1610,2,1580,1581,2,1580,1605,2,1581,1580,2,
+ 1581,1605,2,1582,1580,2,1582,1581,2,1582,1605,2,1587,1580,2,1587,
+ 1581,2,1587,1582,2,1587,1605,2,1589,1581,2,1589,1605,2,1590,1580,
+ 2,1590,1581,2,1590,1582,2,1590,1605,2,1591,1581,2,1591,1605,2,
+ 1592,1605,2,1593,1580,2,1593,1605,2,1594,1580,2,1594,1605,2,1601,
+ 1580,2,1601,1581,2,1601,1582,2,1601,1605,2,1601,1609,2,1601,1610,
+ 2,1602,1581,2,1602,1605,2,1602,1609,2,1602,1610,2,1603,1575,2,
+ 1603,1580,2,1603,1581,2,1603,1582,2,1603,1604,2,1603,1605,2,1603,
+ 1609,2,1603,1610,2,1604,1580,2,1604,1581,2,1604,1582,2,1604,1605,
+ 2,1604,1609,2,1604,1610,2,1605,1580,2,1605,1581,2,1605,1582,2,
+ 1605,1605,2,1605,1609,2,1605,1610,2,1606,1580,2,1606,1581,2,1606,
+ 1582,2,1606,1605,2,1606,1609,2,1606,1610,2,1607,1580,2,1607,1605,
+ 2,1607,1609,2,1607,1610,2,1610,1580,2,1610,1581,2,1610,1582,2,
+ 1610,1605,2,1610,1609,2,1610,1610,2,1584,1648,2,1585,1648,2,1609,
+ 1648,3,32,1612,1617,3,32,1613,1617,3,32,1614,1617,3,32,1615,
+ 1617,3,32,1616,1617,3,32,1617,1648,3,1610,1620,1585,3,1610,1620,
+ 1586,3,1610,1620,1606,2,1576,1585,2,1576,1586,2,1576,1606,2,1578,
+ 1585,2,1578,1586,2,1578,1606,2,1579,1585,2,1579,1586,2,1579,1606,
+ 2,1605,1575,2,1606,1585,2,1606,1586,2,1606,1606,2,1610,1585,2,
+ 1610,1586,2,1610,1606,3,1610,1620,1582,3,1610,1620,1607,2,1576,1607,
+ 2,1578,1607,2,1589,1582,2,1604,1607,2,1606,1607,2,1607,1648,2,
+ 1610,1607,2,1579,1607,2,1587,1607,2,1588,1605,2,1588,1607,3,1600,
+ 1614,1617,3,1600,1615,1617,3,1600,1616,1617,2,1591,1609,2,1591,1610,
+ 2,1593,1609,2,1593,1610,2,1594,1609,2,1594,1610,2,1587,1609,2,
+ 1587,1610,2,1588,1609,2,1588,1610,2,1581,1609,2,1581,1610,2,1580,
+ 1609,2,1580,1610,2,1582,1609,2,1582,1610,2,1589,1609,2,1589,1610,
+ 2,1590,1609,2,1590,1610,2,1588,1580,2,1588,1581,2,1588,1582,2,
+ 1588,1585,2,1587,1585,2,1589,1585,2,1590,1585,2,1575,1611,3,1578,
+ 1580,1605,3,1578,1581,1580,3,1578,1581,1605,3,1578,1582,1605,3,1578,
+ 1605,1580,3,1578,1605,1581,3,1578,1605,1582,3,1580,1605,1581,3,1581,
+ 1605,1610,3,1581,1605,1609,3,1587,1581,1580,3,1587,1580,1581,3,1587,
+ 1580,1609,3,1587,1605,1581,3,1587,1605,1580,3,1587,1605,1605,3,1589,
+ 1581,1581,3,1589,1605,1605,3,1588,1581,1605,3,1588,1580,1610,3,1588,
+ 1605,1582,3,1588,1605,1605,3,1590,1581,1609,3,1590,1582,1605,3,1591,
+ 1605,1581,3,1591,1605,1605,3,1591,1605,1610,3,1593,1580,1605,3,1593,
+ 1605,1605,3,1593,1605,1609,3,1594,1605,1605,3,1594,1605,1610,3,1594,
+ 1605,1609,3,1601,1582,1605,3,1602,1605,1581,3,1602,1605,1605,3,1604,
+ 1581,1605,3,1604,1581,1610,3,1604,1581,1609,3,1604,1580,1580,3,1604,
+ 1582,1605,3,1604,1605,1581,3,1605,1581,1580,3,1605,1581,1605,3,1605,
+ 1581,1610,3,1605,1580,1581,3,1605,1580,1605,3,1605,1582,1580,3,1605,
+ 1582,1605,3,1605,1580,1582,3,1607,1605,1580,3,1607,1605,1605,3,1606,
+ 1581,1605,3,1606,1581,1609,3,1606,1580,1605,3,1606,1580,1609,3,1606,
+ 1605,1610,3,1606,1605,1609,3,1610,1605,1605,3,1576,1582,1610,3,1578,
+ 1580,1610,3,1578,1580,1609,3,1578,1582,1610,3,1578,1582,1609,3,1578,
+ 1605,1610,3,1578,1605,1609,3,1580,1605,1610,3,1580,1581,1609,3,1580,
+ 1605,1609,3,1587,1582,1609,3,1589,1581,1610,3,1588,1581,1610,3,1590,
+ 1581,1610,3,1604,1580,1610,3,1604,1605,1610,3,1610,1581,1610,3,1610,
+ 1580,1610,3,1610,1605,1610,3,1605,1605,1610,3,1602,1605,1610,3,1606,
+ 1581,1610,3,1593,1605,1610,3,1603,1605,1610,3,1606,1580,1581,3,1605,
+ 1582,1610,3,1604,1580,1605,3,1603,1605,1605,3,1580,1581,1610,3,1581,
+ 1580,1610,3,1605,1580,1610,3,1601,1605,1610,3,1576,1581,1610,3,1587,
+ 1582,1610,3,1606,1580,1610,3,1589,1604,1746,3,1602,1604,1746,4,1575,
+ 1604,1604,1607,4,1575,1603,1576,1585,4,1605,1581,1605,1583,4,1589,1604,
+ 1593,1605,4,1585,1587,1608,1604,4,1593,1604,1610,1607,4,1608,1587,1604,
+ 1605,3,1589,1604,1609,18,1589,1604,1609,32,1575,1604,1604,1607,32,1593,
+ 1604,1610,1607,32,1608,1587,1604,1605,8,1580,1604,32,1580,1604,1575,1604,
+ 1607,4,1585,1740,1575,1604,1,44,1,12289,1,12290,1,58,1,33,
+ 1,63,1,12310,1,12311,1,8212,1,8211,1,95,1,123,1,125,
+ 1,12308,1,12309,1,12304,1,12305,1,12298,1,12299,1,12300,1,12301,
+ 1,12302,1,12303,1,91,1,93,1,35,1,38,1,42,1,45,
+ 1,60,1,62,1,92,1,36,1,37,1,64,2,32,1611,2,
+ 1600,1611,2,32,1612,2,32,1613,2,32,1614,2,1600,1614,2,32,
+ 1615,2,1600,1615,2,32,1616,2,1600,1616,2,32,1617,2,1600,1617,
+ 2,32,1618,2,1600,1618,1,1569,1,1575,1,1576,1,1577,1,1578,
+ 1,1579,1,1580,1,1581,1,1582,1,1583,1,1584,1,1585,1,1586,
+ 1,1587,1,1588,1,1589,1,1590,1,1591,1,1592,1,1593,1,1594,
+ 1,1601,1,1602,1,1603,1,1604,1,1605,1,1606,1,1607,1,1608,
+ 1,1610,3,1604,1575,1619,3,1604,1575,1620,3,1604,1575,1621,2,1604,
+ 1575,1,34,1,39,1,47,1,94,1,124,1,126,1,10629,1,
+ 10630,1,12539,1,12449,1,12451,1,12453,1,12455,1,12457,1,12515,1,
+ 12517,1,12519,1,12483,1,12540,1,12531,1,12441,1,12442,1,162,1,
+ 163,1,172,1,166,1,165,1,8361,1,9474,1,8592,1,8593,1,
+ 8594,1,8595,1,9632,1,9675,1,720,1,721,1,230,1,665,1,
+ 595,1,675,1,43878,1,677,1,676,1,598,1,599,1,7569,1,
+ 600,1,606,1,681,1,612,1,610,1,608,1,667,1,668,1,
+ 615,1,644,1,682,1,683,1,620,1,122628,1,42894,1,622,1,
+ 122629,1,654,1,122630,1,248,1,630,1,631,1,634,1,122632,1,
+ 637,1,638,1,640,1,680,1,678,1,43879,1,679,1,648,1,
+ 11377,1,655,1,673,1,674,1,664,1,448,1,449,1,450,1,
+ 122634,1,122654,2,69785,69818,2,69787,69818,2,69797,69818,2,69937,69927,2,
+ 69938,69927,2,70471,70462,2,70471,70487,2,70841,70842,2,70841,70832,2,70841,
+ 70845,2,71096,71087,2,71097,71087,2,71989,71984,2,119127,119141,2,119128,119141,
+ 3,119128,119141,119150,3,119128,119141,119151,3,119128,119141,119152,3,119128,119141,119153,
+ 3,119128,119141,119154,2,119225,119141,2,119226,119141,3,119225,119141,119150,3,119226,
+ 119141,119150,3,119225,119141,119151,3,119226,119141,119151,1,305,1,567,1,913,
+ 1,914,1,916,1,917,1,918,1,919,1,921,1,922,1,923,
+ 1,924,1,925,1,926,1,927,1,929,1,932,1,934,1,935,
+ 1,936,1,8711,1,945,1,950,1,951,1,955,1,957,1,958,
+ 1,959,1,963,1,964,1,965,1,968,1,969,1,8706,1,988,
+ 1,989,1,1646,1,1697,1,1647,2,48,46,2,48,44,2,49,
+ 44,2,50,44,2,51,44,2,52,44,2,53,44,2,54,44,
+ 2,55,44,2,56,44,2,57,44,3,40,65,41,3,40,66,
+ 41,3,40,67,41,3,40,68,41,3,40,69,41,3,40,70,
+ 41,3,40,71,41,3,40,72,41,3,40,73,41,3,40,74,
+ 41,3,40,75,41,3,40,76,41,3,40,77,41,3,40,78,
+ 41,3,40,79,41,3,40,80,41,3,40,81,41,3,40,82,
+ 41,3,40,83,41,3,40,84,41,3,40,85,41,3,40,86,
+ 41,3,40,87,41,3,40,88,41,3,40,89,41,3,40,90,
+ 41,3,12308,83,12309,2,67,68,2,87,90,2,72,86,2,83,
+ 68,2,83,83,3,80,80,86,2,87,67,2,77,67,2,77,
+ 68,2,77,82,2,68,74,2,12411,12363,2,12467,12467,1,23383,1,
+ 21452,1,22810,1,35299,1,20132,1,26144,1,28961,1,21069,1,24460,1,
+ 20877,1,26032,1,21021,1,32066,1,36009,1,22768,1,21561,1,28436,1,
+ 25237,1,25429,1,36938,1,25351,1,25171,1,31105,1,31354,1,21512,1,
+ 28288,1,30003,1,21106,1,21942,1,37197,3,12308,26412,12309,3,12308,19977,
+ 12309,3,12308,20108,12309,3,12308,23433,12309,3,12308,28857,12309,3,12308,25171,
+ 12309,3,12308,30423,12309,3,12308,21213,12309,3,12308,25943,12309,1,24471,1,
+ 21487,1,20029,1,20024,1,20033,1,131362,1,20320,1,20411,1,20482,1,
+ 20602,1,20633,1,20687,1,13470,1,132666,1,20820,1,20836,1,20855,1,
+ 132380,1,13497,1,20839,1,132427,1,20887,1,20900,1,20172,1,20908,1,
+ 168415,1,20995,1,13535,1,21051,1,21062,1,21111,1,13589,1,21253,1,
+ 21254,1,21321,1,21338,1,21363,1,21373,1,21375,1,133676,1,28784,1,
+ 21450,1,21471,1,133987,1,21483,1,21489,1,21510,1,21662,1,21560,1,
+ 21576,1,21608,1,21666,1,21750,1,21776,1,21843,1,21859,1,21892,1,
+ 21931,1,21939,1,21954,1,22294,1,22295,1,22097,1,22132,1,22766,1,
+ 22478,1,22516,1,22541,1,22411,1,22578,1,22577,1,22700,1,136420,1,
+ 22770,1,22775,1,22790,1,22818,1,22882,1,136872,1,136938,1,23020,1,
+ 23067,1,23079,1,23000,1,23142,1,14062,1,14076,1,23304,1,23358,1,
+ 137672,1,23491,1,23512,1,23539,1,138008,1,23551,1,23558,1,24403,1,
+ 14209,1,23648,1,23744,1,23693,1,138724,1,23875,1,138726,1,23918,1,
+ 23915,1,23932,1,24033,1,24034,1,14383,1,24061,1,24104,1,24125,1,
+ 24169,1,14434,1,139651,1,14460,1,24240,1,24243,1,24246,1,172946,1,
+ 140081,1,33281,1,24354,1,14535,1,144056,1,156122,1,24418,1,24427,1,
+ 14563,1,24474,1,24525,1,24535,1,24569,1,24705,1,14650,1,14620,1,
+ 141012,1,24775,1,24904,1,24908,1,24954,1,25010,1,24996,1,25007,1,
+ 25054,1,25104,1,25115,1,25181,1,25265,1,25300,1,25424,1,142092,1,
+ 25405,1,25340,1,25448,1,25475,1,25572,1,142321,1,25634,1,25541,1,
+ 25513,1,14894,1,25705,1,25726,1,25757,1,25719,1,14956,1,25964,1,
+ 143370,1,26083,1,26360,1,26185,1,15129,1,15112,1,15076,1,20882,1,
+ 20885,1,26368,1,26268,1,32941,1,17369,1,26401,1,26462,1,26451,1,
+ 144323,1,15177,1,26618,1,26501,1,26706,1,144493,1,26766,1,26655,1,
+ 26900,1,26946,1,27043,1,27114,1,27304,1,145059,1,27355,1,15384,1,
+ 27425,1,145575,1,27476,1,15438,1,27506,1,27551,1,27579,1,146061,1,
+ 138507,1,146170,1,27726,1,146620,1,27839,1,27853,1,27751,1,27926,1,
+ 27966,1,28009,1,28024,1,28037,1,146718,1,27956,1,28207,1,28270,1,
+ 15667,1,28359,1,147153,1,28153,1,28526,1,147294,1,147342,1,28614,1,
+ 28729,1,28699,1,15766,1,28746,1,28797,1,28791,1,28845,1,132389,1,
+ 28997,1,148067,1,29084,1,148395,1,29224,1,29264,1,149000,1,29312,1,
+ 29333,1,149301,1,149524,1,29562,1,29579,1,16044,1,29605,1,16056,1,
+ 29767,1,29788,1,29829,1,29898,1,16155,1,29988,1,150582,1,30014,1,
+ 150674,1,139679,1,30224,1,151457,1,151480,1,151620,1,16380,1,16392,1,
+ 151795,1,151794,1,151833,1,151859,1,30494,1,30495,1,30603,1,16454,1,
+ 16534,1,152605,1,30798,1,16611,1,153126,1,153242,1,153285,1,31211,1,
+ 16687,1,31306,1,31311,1,153980,1,154279,1,31470,1,16898,1,154539,1,
+ 31686,1,31689,1,16935,1,154752,1,31954,1,17056,1,31976,1,31971,1,
+ 32000,1,155526,1,32099,1,17153,1,32199,1,32258,1,32325,1,17204,1,
+ 156200,1,156231,1,17241,1,156377,1,32634,1,156478,1,32661,1,32762,1,
+ 156890,1,156963,1,32864,1,157096,1,32880,1,144223,1,17365,1,32946,1,
+ 33027,1,17419,1,33086,1,23221,1,157607,1,157621,1,144275,1,144284,1,
+ 33284,1,36766,1,17515,1,33425,1,33419,1,33437,1,21171,1,33457,1,
+ 33459,1,33469,1,33510,1,158524,1,33565,1,33635,1,33709,1,33571,1,
+ 33725,1,33767,1,33619,1,33738,1,33740,1,33756,1,158774,1,159083,1,
+ 158933,1,17707,1,34033,1,34035,1,34070,1,160714,1,34148,1,159532,1,
+ 17757,1,17761,1,159665,1,159954,1,17771,1,34384,1,34407,1,34409,1,
+ 34473,1,34440,1,34574,1,34530,1,34600,1,34667,1,34694,1,17879,1,
+ 34785,1,34817,1,17913,1,34912,1,161383,1,35031,1,35038,1,17973,1,
+ 35066,1,13499,1,161966,1,162150,1,18110,1,18119,1,35488,1,162984,1,
+ 36011,1,36033,1,36123,1,36215,1,163631,1,133124,1,36299,1,36284,1,
+ 36336,1,133342,1,36564,1,165330,1,165357,1,37012,1,37105,1,37137,1,
+ 165678,1,37147,1,37432,1,37591,1,37592,1,37500,1,37881,1,37909,1,
+ 166906,1,38283,1,18837,1,38327,1,167287,1,18918,1,38595,1,23986,1,
+ 38691,1,168261,1,168474,1,19054,1,19062,1,38880,1,168970,1,19122,1,
+ 169110,1,38953,1,169398,1,39138,1,19251,1,39209,1,39335,1,39362,1,
+ 39422,1,19406,1,170800,1,40000,1,40189,1,19662,1,19693,1,40295,1,
+ 172238,1,19704,1,172293,1,172558,1,172689,1,19798,1,40702,1,40709,1,
+ 40719,1,40726,1,173568,
+};
+constinit const mojibake::detail::Composite mojibake::detail::normComposites[941] {
+ {60,824,8814},{61,824,8800},{62,824,8815},{65,768,192},
+ {65,769,193},{65,770,194},{65,771,195},{65,772,256},
+ {65,774,258},{65,775,550},{65,776,196},{65,777,7842},
+ {65,778,197},{65,780,461},{65,783,512},{65,785,514},
+ {65,803,7840},{65,805,7680},{65,808,260},{66,775,7682},
+ {66,803,7684},{66,817,7686},{67,769,262},{67,770,264},
+ {67,775,266},{67,780,268},{67,807,199},{68,775,7690},
+ {68,780,270},{68,803,7692},{68,807,7696},{68,813,7698},
+ {68,817,7694},{69,768,200},{69,769,201},{69,770,202},
+ {69,771,7868},{69,772,274},{69,774,276},{69,775,278},
+ {69,776,203},{69,777,7866},{69,780,282},{69,783,516},
+ {69,785,518},{69,803,7864},{69,807,552},{69,808,280},
+ {69,813,7704},{69,816,7706},{70,775,7710},{71,769,500},
+ {71,770,284},{71,772,7712},{71,774,286},{71,775,288},
+ {71,780,486},{71,807,290},{72,770,292},{72,775,7714},
+ {72,776,7718},{72,780,542},{72,803,7716},{72,807,7720},
+ {72,814,7722},{73,768,204},{73,769,205},{73,770,206},
+ {73,771,296},{73,772,298},{73,774,300},{73,775,304},
+ {73,776,207},{73,777,7880},{73,780,463},{73,783,520},
+ {73,785,522},{73,803,7882},{73,808,302},{73,816,7724},
+ {74,770,308},{75,769,7728},{75,780,488},{75,803,7730},
+ {75,807,310},{75,817,7732},{76,769,313},{76,780,317},
+ {76,803,7734},{76,807,315},{76,813,7740},{76,817,7738},
+ {77,769,7742},{77,775,7744},{77,803,7746},{78,768,504},
+ {78,769,323},{78,771,209},{78,775,7748},{78,780,327},
+ {78,803,7750},{78,807,325},{78,813,7754},{78,817,7752},
+ {79,768,210},{79,769,211},{79,770,212},{79,771,213},
+ {79,772,332},{79,774,334},{79,775,558},{79,776,214},
+ {79,777,7886},{79,779,336},{79,780,465},{79,783,524},
+ {79,785,526},{79,795,416},{79,803,7884},{79,808,490},
+ {80,769,7764},{80,775,7766},{82,769,340},{82,775,7768},
+ {82,780,344},{82,783,528},{82,785,530},{82,803,7770},
+ {82,807,342},{82,817,7774},{83,769,346},{83,770,348},
+ {83,775,7776},{83,780,352},{83,803,7778},{83,806,536},
+ {83,807,350},{84,775,7786},{84,780,356},{84,803,7788},
+ {84,806,538},{84,807,354},{84,813,7792},{84,817,7790},
+ {85,768,217},{85,769,218},{85,770,219},{85,771,360},
+ {85,772,362},{85,774,364},{85,776,220},{85,777,7910},
+ {85,778,366},{85,779,368},{85,780,467},{85,783,532},
+ {85,785,534},{85,795,431},{85,803,7908},{85,804,7794},
+ {85,808,370},{85,813,7798},{85,816,7796},{86,771,7804},
+ {86,803,7806},{87,768,7808},{87,769,7810},{87,770,372},
+ {87,775,7814},{87,776,7812},{87,803,7816},{88,775,7818},
+ {88,776,7820},{89,768,7922},{89,769,221},{89,770,374},
+ {89,771,7928},{89,772,562},{89,775,7822},{89,776,376},
+ {89,777,7926},{89,803,7924},{90,769,377},{90,770,7824},
+ {90,775,379},{90,780,381},{90,803,7826},{90,817,7828},
+ {97,768,224},{97,769,225},{97,770,226},{97,771,227},
+ {97,772,257},{97,774,259},{97,775,551},{97,776,228},
+ {97,777,7843},{97,778,229},{97,780,462},{97,783,513},
+ {97,785,515},{97,803,7841},{97,805,7681},{97,808,261},
+ {98,775,7683},{98,803,7685},{98,817,7687},{99,769,263},
+ {99,770,265},{99,775,267},{99,780,269},{99,807,231},
+ {100,775,7691},{100,780,271},{100,803,7693},{100,807,7697},
+ {100,813,7699},{100,817,7695},{101,768,232},{101,769,233},
+ {101,770,234},{101,771,7869},{101,772,275},{101,774,277},
+ {101,775,279},{101,776,235},{101,777,7867},{101,780,283},
+ {101,783,517},{101,785,519},{101,803,7865},{101,807,553},
+ {101,808,281},{101,813,7705},{101,816,7707},{102,775,7711},
+ {103,769,501},{103,770,285},{103,772,7713},{103,774,287},
+ {103,775,289},{103,780,487},{103,807,291},{104,770,293},
+ {104,775,7715},{104,776,7719},{104,780,543},{104,803,7717},
+ {104,807,7721},{104,814,7723},{104,817,7830},{105,768,236},
+ {105,769,237},{105,770,238},{105,771,297},{105,772,299},
+ {105,774,301},{105,776,239},{105,777,7881},{105,780,464},
+ {105,783,521},{105,785,523},{105,803,7883},{105,808,303},
+ {105,816,7725},{106,770,309},{106,780,496},{107,769,7729},
+ {107,780,489},{107,803,7731},{107,807,311},{107,817,7733},
+ {108,769,314},{108,780,318},{108,803,7735},{108,807,316},
+ {108,813,7741},{108,817,7739},{109,769,7743},{109,775,7745},
+ {109,803,7747},{110,768,505},{110,769,324},{110,771,241},
+ {110,775,7749},{110,780,328},{110,803,7751},{110,807,326},
+ {110,813,7755},{110,817,7753},{111,768,242},{111,769,243},
+ {111,770,244},{111,771,245},{111,772,333},{111,774,335},
+ {111,775,559},{111,776,246},{111,777,7887},{111,779,337},
+ {111,780,466},{111,783,525},{111,785,527},{111,795,417},
+ {111,803,7885},{111,808,491},{112,769,7765},{112,775,7767},
+ {114,769,341},{114,775,7769},{114,780,345},{114,783,529},
+ {114,785,531},{114,803,7771},{114,807,343},{114,817,7775},
+ {115,769,347},{115,770,349},{115,775,7777},{115,780,353},
+ {115,803,7779},{115,806,537},{115,807,351},{116,775,7787},
+ {116,776,7831},{116,780,357},{116,803,7789},{116,806,539},
+ {116,807,355},{116,813,7793},{116,817,7791},{117,768,249},
+ {117,769,250},{117,770,251},{117,771,361},{117,772,363},
+ {117,774,365},{117,776,252},{117,777,7911},{117,778,367},
+ {117,779,369},{117,780,468},{117,783,533},{117,785,535},
+ {117,795,432},{117,803,7909},{117,804,7795},{117,808,371},
+ {117,813,7799},{117,816,7797},{118,771,7805},{118,803,7807},
+ {119,768,7809},{119,769,7811},{119,770,373},{119,775,7815},
+ {119,776,7813},{119,778,7832},{119,803,7817},{120,775,7819},
+ {120,776,7821},{121,768,7923},{121,769,253},{121,770,375},
+ {121,771,7929},{121,772,563},{121,775,7823},{121,776,255},
+ {121,777,7927},{121,778,7833},{121,803,7925},{122,769,378},
+ {122,770,7825},{122,775,380},{122,780,382},{122,803,7827},
+ {122,817,7829},{168,768,8173},{168,769,901},{168,834,8129},
+ {194,768,7846},{194,769,7844},{194,771,7850},{194,777,7848},
+ {196,772,478},{197,769,506},{198,769,508},{198,772,482},
+ {199,769,7688},{202,768,7872},{202,769,7870},{202,771,7876},
+ {202,777,7874},{207,769,7726},{212,768,7890},{212,769,7888},
+ {212,771,7894},{212,777,7892},{213,769,7756},{213,772,556},
+ {213,776,7758},{214,772,554},{216,769,510},{220,768,475},
+ {220,769,471},{220,772,469},{220,780,473},{226,768,7847},
+ {226,769,7845},{226,771,7851},{226,777,7849},{228,772,479},
+ {229,769,507},{230,769,509},{230,772,483},{231,769,7689},
+ {234,768,7873},{234,769,7871},{234,771,7877},{234,777,7875},
+ {239,769,7727},{244,768,7891},{244,769,7889},{244,771,7895},
+ {244,777,7893},{245,769,7757},{245,772,557},{245,776,7759},
+ {246,772,555},{248,769,511},{252,768,476},{252,769,472},
+ {252,772,470},{252,780,474},{258,768,7856},{258,769,7854},
+ {258,771,7860},{258,777,7858},{259,768,7857},{259,769,7855},
+ {259,771,7861},{259,777,7859},{274,768,7700},{274,769,7702},
+ {275,768,7701},{275,769,7703},{332,768,7760},{332,769,7762},
+ {333,768,7761},{333,769,7763},{346,775,7780},{347,775,7781},
+ {352,775,7782},{353,775,7783},{360,769,7800},{361,769,7801},
+ {362,776,7802},{363,776,7803},{383,775,7835},{416,768,7900},
+ {416,769,7898},{416,771,7904},{416,777,7902},{416,803,7906},
+ {417,768,7901},{417,769,7899},{417,771,7905},{417,777,7903},
+ {417,803,7907},{431,768,7914},{431,769,7912},{431,771,7918},
+ {431,777,7916},{431,803,7920},{432,768,7915},{432,769,7913},
+ {432,771,7919},{432,777,7917},{432,803,7921},{439,780,494},
+ {490,772,492},{491,772,493},{550,772,480},{551,772,481},
+ {552,774,7708},{553,774,7709},{558,772,560},{559,772,561},
+ {658,780,495},{913,768,8122},{913,769,902},{913,772,8121},
+ {913,774,8120},{913,787,7944},{913,788,7945},{913,837,8124},
+ {917,768,8136},{917,769,904},{917,787,7960},{917,788,7961},
+ {919,768,8138},{919,769,905},{919,787,7976},{919,788,7977},
+ {919,837,8140},{921,768,8154},{921,769,906},{921,772,8153},
+ {921,774,8152},{921,776,938},{921,787,7992},{921,788,7993},
+ {927,768,8184},{927,769,908},{927,787,8008},{927,788,8009},
+ {929,788,8172},{933,768,8170},{933,769,910},{933,772,8169},
+ {933,774,8168},{933,776,939},{933,788,8025},{937,768,8186},
+ {937,769,911},{937,787,8040},{937,788,8041},{937,837,8188},
+ {940,837,8116},{942,837,8132},{945,768,8048},{945,769,940},
+ {945,772,8113},{945,774,8112},{945,787,7936},{945,788,7937},
+ {945,834,8118},{945,837,8115},{949,768,8050},{949,769,941},
+ {949,787,7952},{949,788,7953},{951,768,8052},{951,769,942},
+ {951,787,7968},{951,788,7969},{951,834,8134},{951,837,8131},
+ {953,768,8054},{953,769,943},{953,772,8145},{953,774,8144},
+ {953,776,970},{953,787,7984},{953,788,7985},{953,834,8150},
+ {959,768,8056},{959,769,972},{959,787,8000},{959,788,8001},
+ {961,787,8164},{961,788,8165},{965,768,8058},{965,769,973},
+ {965,772,8161},{965,774,8160},{965,776,971},{965,787,8016},
+ {965,788,8017},{965,834,8166},{969,768,8060},{969,769,974},
+ {969,787,8032},{969,788,8033},{969,834,8182},{969,837,8179},
+ {970,768,8146},{970,769,912},{970,834,8151},{971,768,8162},
+ {971,769,944},{971,834,8167},{974,837,8180},{978,769,979},
+ {978,776,980},{1030,776,1031},{1040,774,1232},{1040,776,1234},
+ {1043,769,1027},{1045,768,1024},{1045,774,1238},{1045,776,1025},
+ {1046,774,1217},{1046,776,1244},{1047,776,1246},{1048,768,1037},
+ {1048,772,1250},{1048,774,1049},{1048,776,1252},{1050,769,1036},
+ {1054,776,1254},{1059,772,1262},{1059,774,1038},{1059,776,1264},
+ {1059,779,1266},{1063,776,1268},{1067,776,1272},{1069,776,1260},
+ {1072,774,1233},{1072,776,1235},{1075,769,1107},{1077,768,1104},
+ {1077,774,1239},{1077,776,1105},{1078,774,1218},{1078,776,1245},
+ {1079,776,1247},{1080,768,1117},{1080,772,1251},{1080,774,1081},
+ {1080,776,1253},{1082,769,1116},{1086,776,1255},{1091,772,1263},
+ {1091,774,1118},{1091,776,1265},{1091,779,1267},{1095,776,1269},
+ {1099,776,1273},{1101,776,1261},{1110,776,1111},{1140,783,1142},
+ {1141,783,1143},{1240,776,1242},{1241,776,1243},{1256,776,1258},
+ {1257,776,1259},{1575,1619,1570},{1575,1620,1571},{1575,1621,1573},
+ {1608,1620,1572},{1610,1620,1574},{1729,1620,1730},{1746,1620,1747},
+ {1749,1620,1728},{2344,2364,2345},{2352,2364,2353},{2355,2364,2356},
+ {2503,2494,2507},{2503,2519,2508},{2887,2878,2891},{2887,2902,2888},
+ {2887,2903,2892},{2962,3031,2964},{3014,3006,3018},{3014,3031,3020},
+ {3015,3006,3019},{3142,3158,3144},{3263,3285,3264},{3270,3266,3274},
+ {3270,3285,3271},{3270,3286,3272},{3274,3285,3275},{3398,3390,3402},
+ {3398,3415,3404},{3399,3390,3403},{3545,3530,3546},{3545,3535,3548},
+ {3545,3551,3550},{3548,3530,3549},{4133,4142,4134},{6917,6965,6918},
+ {6919,6965,6920},{6921,6965,6922},{6923,6965,6924},{6925,6965,6926},
+ {6929,6965,6930},{6970,6965,6971},{6972,6965,6973},{6974,6965,6976},
+ {6975,6965,6977},{6978,6965,6979},{7734,772,7736},{7735,772,7737},
+ {7770,772,7772},{7771,772,7773},{7778,775,7784},{7779,775,7785},
+ {7840,770,7852},{7840,774,7862},{7841,770,7853},{7841,774,7863},
+ {7864,770,7878},{7865,770,7879},{7884,770,7896},{7885,770,7897},
+ {7936,768,7938},{7936,769,7940},{7936,834,7942},{7936,837,8064},
+ {7937,768,7939},{7937,769,7941},{7937,834,7943},{7937,837,8065},
+ {7938,837,8066},{7939,837,8067},{7940,837,8068},{7941,837,8069},
+ {7942,837,8070},{7943,837,8071},{7944,768,7946},{7944,769,7948},
+ {7944,834,7950},{7944,837,8072},{7945,768,7947},{7945,769,7949},
+ {7945,834,7951},{7945,837,8073},{7946,837,8074},{7947,837,8075},
+ {7948,837,8076},{7949,837,8077},{7950,837,8078},{7951,837,8079},
+ {7952,768,7954},{7952,769,7956},{7953,768,7955},{7953,769,7957},
+ {7960,768,7962},{7960,769,7964},{7961,768,7963},{7961,769,7965},
+ {7968,768,7970},{7968,769,7972},{7968,834,7974},{7968,837,8080},
+ {7969,768,7971},{7969,769,7973},{7969,834,7975},{7969,837,8081},
+ {7970,837,8082},{7971,837,8083},{7972,837,8084},{7973,837,8085},
+ {7974,837,8086},{7975,837,8087},{7976,768,7978},{7976,769,7980},
+ {7976,834,7982},{7976,837,8088},{7977,768,7979},{7977,769,7981},
+ {7977,834,7983},{7977,837,8089},{7978,837,8090},{7979,837,8091},
+ {7980,837,8092},{7981,837,8093},{7982,837,8094},{7983,837,8095},
+ {7984,768,7986},{7984,769,7988},{7984,834,7990},{7985,768,7987},
+ {7985,769,7989},{7985,834,7991},{7992,768,7994},{7992,769,7996},
+ {7992,834,7998},{7993,768,7995},{7993,769,7997},{7993,834,7999},
+ {8000,768,8002},{8000,769,8004},{8001,768,8003},{8001,769,8005},
+ {8008,768,8010},{8008,769,8012},{8009,768,8011},{8009,769,8013},
+ {8016,768,8018},{8016,769,8020},{8016,834,8022},{8017,768,8019},
+ {8017,769,8021},{8017,834,8023},{8025,768,8027},{8025,769,8029},
+ {8025,834,8031},{8032,768,8034},{8032,769,8036},{8032,834,8038},
+ {8032,837,8096},{8033,768,8035},{8033,769,8037},{8033,834,8039},
+ {8033,837,8097},{8034,837,8098},{8035,837,8099},{8036,837,8100},
+ {8037,837,8101},{8038,837,8102},{8039,837,8103},{8040,768,8042},
+ {8040,769,8044},{8040,834,8046},{8040,837,8104},{8041,768,8043},
+ {8041,769,8045},{8041,834,8047},{8041,837,8105},{8042,837,8106},
+ {8043,837,8107},{8044,837,8108},{8045,837,8109},{8046,837,8110},
+ {8047,837,8111},{8048,837,8114},{8052,837,8130},{8060,837,8178},
+ {8118,837,8119},{8127,768,8141},{8127,769,8142},{8127,834,8143},
+ {8134,837,8135},{8182,837,8183},{8190,768,8157},{8190,769,8158},
+ {8190,834,8159},{8592,824,8602},{8594,824,8603},{8596,824,8622},
+ {8656,824,8653},{8658,824,8655},{8660,824,8654},{8707,824,8708},
+ {8712,824,8713},{8715,824,8716},{8739,824,8740},{8741,824,8742},
+ {8764,824,8769},{8771,824,8772},{8773,824,8775},{8776,824,8777},
+ {8781,824,8813},{8801,824,8802},{8804,824,8816},{8805,824,8817},
+ {8818,824,8820},{8819,824,8821},{8822,824,8824},{8823,824,8825},
+ {8826,824,8832},{8827,824,8833},{8828,824,8928},{8829,824,8929},
+ {8834,824,8836},{8835,824,8837},{8838,824,8840},{8839,824,8841},
+ {8849,824,8930},{8850,824,8931},{8866,824,8876},{8872,824,8877},
+ {8873,824,8878},{8875,824,8879},{8882,824,8938},{8883,824,8939},
+ {8884,824,8940},{8885,824,8941},{12358,12441,12436},{12363,12441,12364},
+ {12365,12441,12366},{12367,12441,12368},{12369,12441,12370},{12371,12441,12372},
+ {12373,12441,12374},{12375,12441,12376},{12377,12441,12378},{12379,12441,12380},
+ {12381,12441,12382},{12383,12441,12384},{12385,12441,12386},{12388,12441,12389},
+ {12390,12441,12391},{12392,12441,12393},{12399,12441,12400},{12399,12442,12401},
+ {12402,12441,12403},{12402,12442,12404},{12405,12441,12406},{12405,12442,12407},
+ {12408,12441,12409},{12408,12442,12410},{12411,12441,12412},{12411,12442,12413},
+ {12445,12441,12446},{12454,12441,12532},{12459,12441,12460},{12461,12441,12462},
+ {12463,12441,12464},{12465,12441,12466},{12467,12441,12468},{12469,12441,12470},
+ {12471,12441,12472},{12473,12441,12474},{12475,12441,12476},{12477,12441,12478},
+ {12479,12441,12480},{12481,12441,12482},{12484,12441,12485},{12486,12441,12487},
+ {12488,12441,12489},{12495,12441,12496},{12495,12442,12497},{12498,12441,12499},
+ {12498,12442,12500},{12501,12441,12502},{12501,12442,12503},{12504,12441,12505},
+ {12504,12442,12506},{12507,12441,12508},{12507,12442,12509},{12527,12441,12535},
+ {12528,12441,12536},{12529,12441,12537},{12530,12441,12538},{12541,12441,12542},
+ {69785,69818,69786},{69787,69818,69788},{69797,69818,69803},{69937,69927,69934},
+ {69938,69927,69935},{70471,70462,70475},{70471,70487,70476},{70841,70832,70844},
+ {70841,70842,70843},{70841,70845,70846},{71096,71087,71098},{71097,71087,71099},
+ {71989,71984,71992},
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace mojibake::detail {
+
+    ///
+    /// Asynchronous generator: the coroutine may co_await anything
+    /// (e.g. network) between co_yield’s, and consumer co_await’s next()
+    ///   while (auto x = co_await gen.next()) { … }
+    /// Control goes between them by symmetric transfer, no threads involved
+    ///
+    template <class T>
+    class AsyncGenerator
+    {
+    public:
+        struct promise_type;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        /// Gives control back to consumer
+        struct ToConsumer {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(Handle h) const noexcept
+                { return h.promise().consumer; }
+            void await_resume() const noexcept {}
+        };
+
+        struct promise_type {
+            std::optional<T> value;
+            std::coroutine_handle<> consumer;
+            std::exception_ptr exception;
+
+            AsyncGenerator get_return_object() { return AsyncGenerator{Handle::from_promise(*this)}; }
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            ToConsumer final_suspend() const noexcept { return {}; }
+            ToConsumer yield_value(T x) noexcept
+            {
+                value.emplace(std::move(x));
+                return {};
+            }
+            void return_void() noexcept { value.reset(); }
+            void unhandled_exception() noexcept { exception = std::current_exception(); }
+        };
+
+        struct Next {
+            Handle h;
+            bool await_ready() const noexcept { return h.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept
+            {
+                h.promise().consumer = consumer;
+                h.promise().value.reset();
+                return h;
+            }
+            std::optional<T> await_resume()
+            {
+                if (auto ex = std::exchange(h.promise().exception, nullptr))
+                    std::rethrow_exception(ex);
+                if (h.done())
+                    return std::nullopt;
+                return std::move(h.promise().value);
+            }
+        };
+
+        AsyncGenerator(AsyncGenerator&& x) noexcept : h(std::exchange(x.h, nullptr)) {}
+        AsyncGenerator& operator = (AsyncGenerator&& x) noexcept
+            { std::swap(h, x.h);  return *this; }
+        ~AsyncGenerator() { if (h) h.destroy(); }
+
+        /// @return  awaitable of next value, nullopt if generator ended
+        Next next() { return { h }; }
+    private:
+        Handle h;
+        explicit AsyncGenerator(Handle aH) : h(aH) {}
+    };
+
+}   // namespace mojibake::detail
@@ -13,4 +13,102 @@ namespace mojibake::detail {
 
     constexpr char32_t CF_MAXCP = std::size(simpleCfLookup) * CF_BLOCKSIZE;
 
+    // Grapheme cluster break
+    constexpr int GCB_BLOCKSHIFT = 7;
+    constexpr int GCB_BLOCKSIZE = 1 << GCB_BLOCKSHIFT;
+    constexpr int GCB_BLOCKMASK = GCB_BLOCKSIZE - 1;
+
+    extern const unsigned char gcbBlocks[149][128];
+    extern const unsigned char gcbLookup[7200];
+
+    constexpr char32_t GCB_MAXCP = std::size(gcbLookup) * GCB_BLOCKSIZE;
+
+    /// Grapheme_Cluster_Break property, + Extended_Pictographic
+    /// @warning  Values are generated by ExtractUnicodeTable, do not reorder
+    enum class Gcb : unsigned char {
+        OTHER, CR, LF, CONTROL, EXTEND, ZWJ, REG_IND, PREPEND, SPACING_MARK,
+        L, V, T, LV, LVT, EXT_PICT };
+
+    // Display width
+    constexpr int WIDTH_BLOCKSHIFT = 7;
+    constexpr int WIDTH_BLOCKSIZE = 1 << WIDTH_BLOCKSHIFT;
+    constexpr int WIDTH_BLOCKMASK = WIDTH_BLOCKSIZE - 1;
+
+    extern const unsigned char widthBlocks[152][128];
+    extern const unsigned char widthLookup[7172];
+
+    constexpr char32_t WIDTH_MAXCP = std::size(widthLookup) * WIDTH_BLOCKSIZE;
+
+    // Normalization: canonical combining class
+    constexpr int CCC_BLOCKSHIFT = 5;
+    constexpr int CCC_BLOCKSIZE = 1 << CCC_BLOCKSHIFT;
+    constexpr int CCC_BLOCKMASK = CCC_BLOCKSIZE - 1;
+
+    extern const unsigned char cccBlocks[128][32];
+    extern const unsigned char cccLookup[3915];
+
+    constexpr char32_t CCC_MAXCP = std::size(cccLookup) * CCC_BLOCKSIZE;
+
+    // Normalization: quick check flags
+    constexpr int NORMFLAGS_BLOCKSHIFT = 6;
+    constexpr int NORMFLAGS_BLOCKSIZE = 1 << NORMFLAGS_BLOCKSHIFT;
+    constexpr int NORMFLAGS_BLOCKMASK = NORMFLAGS_BLOCKSIZE - 1;
+
+    extern const unsigned char normFlagsBlocks[133][64];
+    extern const unsigned char normFlagsLookup[3049];
+
+    constexpr char32_t NORMFLAGS_MAXCP = std::size(normFlagsLookup) * NORMFLAGS_BLOCKSIZE;
+
+    /// @warning  Values are generated by ExtractUnicodeTable
+    constexpr unsigned char NF_C_MAYBE = 1;
+    constexpr unsigned char NF_C_NO = 2;
+    constexpr unsigned char NF_KC_MAYBE = 4;
+    constexpr unsigned char NF_KC_NO = 8;
+    constexpr unsigned char NF_D_NO = 16;
+    constexpr unsigned char NF_KD_NO = 32;
+
+    // Normalization: full decompositions, indexes in normPool
+    //   normPool[index] = length, then code points
+    constexpr int DECOMP_BLOCKSHIFT = 6;
+    constexpr int DECOMP_BLOCKSIZE = 1 << DECOMP_BLOCKSHIFT;
+    constexpr int DECOMP_BLOCKMASK = DECOMP_BLOCKSIZE - 1;
+
+    extern const unsigned short canonDecompBlocks[81][64];
+    extern const unsigned char canonDecompLookup[3049];
+    extern const unsigned short compatDecompBlocks[170][64];
+    extern const unsigned char compatDecompLookup[3049];
+    extern const char32_t normPool[10389];
+
+    constexpr char32_t DECOMP_MAXCP = std::size(canonDecompLookup) * DECOMP_BLOCKSIZE;
+    static_assert(std::size(canonDecompLookup) == std::size(compatDecompLookup));
+
+    // Normalization: primary composites, sorted by first, second
+    struct Composite {
+        char32_t first, second, composite;
+    };
+
+    extern const Composite normComposites[941];
+
+    // Single-byte code pages, bytes 80…FF only, 0 = undefined
+    //   index is mojibake::Cp
+    extern const char16_t cpToUnicode[9][128];
+
+    // All 256 bytes in UTF-8: bytes of sequence from lowest,
+    //   length in the highest byte, 0 = undefined
+    extern const unsigned cpToUtf8[9][256];
+
+    // Code pages, reverse: lookup[page][cp >> shift] → block, 0 = unmappable
+    constexpr int CPFROM_BLOCKSHIFT = 6;
+    constexpr int CPFROM_BLOCKSIZE = 1 << CPFROM_BLOCKSHIFT;
+    constexpr int CPFROM_BLOCKMASK = CPFROM_BLOCKSIZE - 1;
+
+    extern const unsigned char cpFromUnicodeBlocks[46][64];
+    extern const unsigned char cpFromUnicodeLookup[9][151];
+
+    constexpr char32_t CPFROM_MAXCP = std::size(cpFromUnicodeLookup[0]) * CPFROM_BLOCKSIZE;
+
+    // Code page detection: weights of bytes 80…FF
+    //   frequent letter > lowercase > uppercase > other > control > undefined
+    extern const signed char cpDetectWeights[9][128];
+
 }   // mojibake::detail
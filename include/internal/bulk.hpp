@@ -0,0 +1,211 @@
+#pragma once
+
+#ifdef MJ_POSIX
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <sys/stat.h>
+
+namespace mojibake::detail {
+
+    /// Look-ahead for block boundaries, bytes: CESU-8 may skip
+    /// two continuation bytes and then a trailing surrogate
+    constexpr size_t BULK_LOOK = 8;
+
+    ///
+    /// Finds where block of file may start w/o cutting code point:
+    /// UTF-8 → not a continuation byte, UTF-16 → not a low surrogate,
+    /// CESU-8 → both.
+    /// A block starting at any of these is read just like the whole file,
+    /// except that long bad data may break in two
+    /// @return  boundary in [p, end]
+    ///
+    template <class Enc>
+    const char* blockBoundary(const char* p, const char* end)
+    {
+        if constexpr (std::is_same_v<Enc, Utf8> || std::is_same_v<Enc, Utf8Esc> || isCesu<Enc>) {
+            while (p != end && isU8ContinueByte(*p))
+                ++p;
+            if constexpr (isCesu<Enc>) {
+                if (readCesuSurrogate(p, end) >= SURROGATE_HI_MIN)
+                    p += 3;
+            }
+        } else if constexpr (BYTE_UNIT<Enc> == 2) {
+            if (end - p >= 2) {
+                auto q = p;
+                char32_t unit;
+                readUnit<2, Enc::endian>(q, end, unit);
+                if (unit >= SURROGATE_HI_MIN && unit <= SURROGATE_HI_MAX)
+                    p = q;
+            }
+        }
+        return p;
+    }
+
+    /// Reads n bytes at offset, less only at EOF
+    /// @return  # of bytes, −1 on error in errno
+    inline ssize_t preadFull(int fd, char* p, size_t n, off_t offset)
+    {
+        size_t done = 0;
+        while (done < n) {
+            auto r = ::pread(fd, p + done, n - done, offset + static_cast<off_t>(done));
+            if (r < 0) {
+                if (errno == EINTR)
+                    continue;
+                return -1;
+            }
+            if (r == 0)
+                break;
+            done += static_cast<size_t>(r);
+        }
+        return static_cast<ssize_t>(done);
+    }
+
+    ///
+    /// Transcodes stream that cannot be read in parallel: pipe, socket…
+    /// @return [+] OK [-] error in errno, or onMojibake halted
+    ///
+    template <class Enc1, class Enc2, class Mjh>
+    bool transcodeSerial(int fdIn, int fdOut, size_t blockSize, const Mjh& onMojibake)
+    {
+        AlignedBuffer raw(blockSize), out(blockSize * STREAM_RATIO<Enc2>);
+        size_t nCarry = 0;
+        while (true) {
+            auto n = readSome(fdIn, raw.data() + nCarry, raw.size() - nCarry);
+            if (n < 0)
+                return false;
+            auto len = nCarry + static_cast<size_t>(n);
+            auto r = transcodeBlock<Enc1, Enc2, Mjh>(
+                        raw.data(), raw.data() + len, n == 0, out.data(), onMojibake);
+            iovec iov { out.data(), static_cast<size_t>(r.destEnd - out.data()) };
+            if (!writeAll(fdOut, &iov, 1))
+                return false;
+            if (n == 0 || r.isHalted)
+                return !r.isHalted;
+            nCarry = raw.data() + len - r.used;
+            std::memmove(raw.data(), r.used, nCarry);
+        }
+    }
+
+    ///
+    /// Transcodes file by blocks: workers read blocks by pread (so several
+    /// reads are in flight) and transcode them in parallel, this thread
+    /// writes results in order. Ring of 2·nThreads blocks limits memory
+    /// @param [in] blockSize  multiple of 4
+    /// @return [+] OK [-] error in errno, or onMojibake halted
+    ///
+    template <class Enc1, class Enc2, class Mjh>
+    bool transcodeFile(int fdIn, int fdOut, unsigned nThreads, size_t blockSize,
+                       const Mjh& onMojibake)
+    {
+        struct stat st;
+        if (::fstat(fdIn, &st) != 0)
+            return false;
+        if (!S_ISREG(st.st_mode))
+            return transcodeSerial<Enc1, Enc2, Mjh>(fdIn, fdOut, blockSize, onMojibake);
+
+        const size_t size = st.st_size;
+        const size_t nBlocks = (size + blockSize - 1) / blockSize;
+        if (nThreads == 0)
+            nThreads = std::max(1u, std::thread::hardware_concurrency());
+        nThreads = static_cast<unsigned>(std::min<size_t>(nThreads, std::max<size_t>(nBlocks, 1)));
+        const size_t ringSize = nThreads * 2;
+
+        struct Slot {
+            std::vector<char> out;
+            size_t length = 0;
+            bool isReady = false;
+            bool isHalted = false;
+        };
+        std::vector<Slot> slots(ringSize);
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic<size_t> nextBlock = 0;
+        size_t nWritten = 0;    // guarded by mutex
+        bool isStopped = false; // guarded by mutex
+        int err = 0;            // guarded by mutex
+
+        auto stop = [&](int errNo) {
+            std::lock_guard lk(mutex);
+            isStopped = true;
+            if (err == 0)
+                err = errNo;
+            cv.notify_all();
+        };
+
+        auto work = [&] {
+            AlignedBuffer raw(blockSize + BULK_LOOK);
+            while (true) {
+                size_t i = nextBlock++;
+                if (i >= nBlocks)
+                    return;
+                {   std::unique_lock lk(mutex);
+                    cv.wait(lk, [&] { return isStopped || i < nWritten + ringSize; });
+                    if (isStopped)
+                        return;
+                }
+                auto offset = i * blockSize;
+                auto n = preadFull(fdIn, raw.data(), std::min(blockSize + BULK_LOOK, size - offset),
+                                   static_cast<off_t>(offset));
+                if (n < 0) {
+                    stop(errno);
+                    return;
+                }
+                auto end = raw.data() + n;
+                auto beg = (i == 0) ? raw.data()
+                        : blockBoundary<Enc1>(raw.data(), std::min(end, raw.data() + BULK_LOOK));
+                auto cut = (offset + blockSize >= size) ? end
+                        : blockBoundary<Enc1>(raw.data() + blockSize, end);
+                beg = std::min(beg, cut);
+                auto& slot = slots[i % ringSize];
+                slot.out.resize((cut - beg) * STREAM_RATIO<Enc2>);
+                auto r = transcodeBlock<Enc1, Enc2, Mjh>(beg, cut, true, slot.out.data(), onMojibake);
+                std::lock_guard lk(mutex);
+                slot.length = r.destEnd - slot.out.data();
+                slot.isHalted = r.isHalted;
+                slot.isReady = true;
+                cv.notify_all();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 0; i < nThreads; ++i)
+            workers.emplace_back(work);
+
+        bool isHalted = false;
+        for (size_t i = 0; i < nBlocks; ++i) {
+            auto& slot = slots[i % ringSize];
+            {   std::unique_lock lk(mutex);
+                cv.wait(lk, [&] { return isStopped || slot.isReady; });
+                if (isStopped)
+                    break;
+            }
+            iovec iov { slot.out.data(), slot.length };
+            if (!writeAll(fdOut, &iov, 1)) {
+                stop(errno);
+                break;
+            }
+            if (slot.isHalted) {
+                isHalted = true;
+                stop(0);
+                break;
+            }
+            std::lock_guard lk(mutex);
+            slot.isReady = false;
+            nWritten = i + 1;
+            cv.notify_all();
+        }
+        for (auto& w : workers)
+            w.join();
+        if (err != 0) {
+            errno = err;
+            return false;
+        }
+        return !isHalted;
+    }
+
+}   // namespace mojibake::detail
+
+#endif
@@ -0,0 +1,335 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+namespace mojibake::detail {
+
+    static_assert(std::endian::native == std::endian::little
+                  || std::endian::native == std::endian::big, "Strange machine");
+
+    constexpr char16_t swapBytes(char16_t x)
+        { return static_cast<char16_t>((x >> 8) | (x << 8)); }
+
+    constexpr char32_t swapBytes(char32_t x)
+    {
+        return (x >> 24) | ((x >> 8) & 0xFF00) | ((x << 8) & 0xFF0000) | (x << 24);
+    }
+
+    /// Writes byte to iterator of char, unsigned char, std::byte…
+    template <class It>
+    inline void putByte(It& it, unsigned char b)
+    {
+        if constexpr (std::is_assignable_v<decltype(*it), unsigned char>) {
+            *it = b;
+        } else {
+            *it = std::byte{b};
+        }
+        ++it;
+    }
+
+    ///
+    /// Reads N-byte unit of byte order e
+    /// Contiguous data is read unaligned, and byte swap is a single instruction
+    /// @param [in,out] p   moves to next unit, or to end if unit is incomplete
+    /// @return [+] OK [-] data ended in the middle of unit
+    ///
+    template <size_t N, std::endian e, class It>
+    inline bool readUnit(It& p, It end, char32_t& unit)
+    {
+        using Word = std::conditional_t<N == 2, char16_t, char32_t>;
+        if constexpr (std::contiguous_iterator<It>) {
+            if (end - p < static_cast<ptrdiff_t>(N)) [[unlikely]] {
+                p = end;
+                return false;
+            }
+            Word x;
+            std::memcpy(&x, std::to_address(p), N);
+            p += N;
+            if constexpr (e != std::endian::native)
+                x = swapBytes(x);
+            unit = x;
+        } else {
+            unit = 0;
+            for (size_t i = 0; i < N; ++i, ++p) {
+                if (p == end) [[unlikely]]
+                    return false;
+                auto shift = (e == std::endian::little) ? i * 8 : (N - 1 - i) * 8;
+                unit |= static_cast<char32_t>(static_cast<unsigned char>(*p)) << shift;
+            }
+        }
+        return true;
+    }
+
+    template <size_t N, std::endian e, class It>
+    inline void writeUnit(It& it, char32_t unit)
+    {
+        for (size_t i = 0; i < N; ++i) {
+            auto shift = (e == std::endian::little) ? i * 8 : (N - 1 - i) * 8;
+            putByte(it, static_cast<unsigned char>(unit >> shift));
+        }
+    }
+
+    /// @return [+] room for n bytes
+    template <class It>
+    inline bool hasRoom([[maybe_unused]] const It& it, [[maybe_unused]] size_t n)
+    {
+        if constexpr (IteratorLimit<It>::isLimited) {
+            return IteratorLimit<It>::remainder(it) >= n;
+        } else {
+            return true;
+        }
+    }
+
+#ifdef MJ_SSE2
+    ///
+    /// Loads 16 bytes of N-byte units of byte order e, unaligned,
+    /// and converts them to machine order
+    ///
+    template <size_t N, std::endian e>
+    inline __m128i loadUnits(const void* p)
+    {
+        auto v = _mm_loadu_si128(static_cast<const __m128i*>(p));
+        if constexpr (e != std::endian::native) {
+            v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+            if constexpr (N == 4)   // swap words too
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+        }
+        return v;
+    }
+
+    ///
+    /// @return [+] every unit is a code point by itself:
+    ///             UTF-16 w/o surrogates, valid UTF-32
+    ///
+    template <size_t N>
+    inline bool areWholeCps(__m128i v)
+    {
+        if constexpr (N == 2) {
+            auto isSurrogate = _mm_cmpeq_epi16(
+                    _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800))),
+                    _mm_set1_epi16(static_cast<short>(SURROGATE_MIN)));
+            return _mm_movemask_epi8(isSurrogate) == 0;
+        } else {
+            auto isSurrogate = _mm_cmpeq_epi32(
+                    _mm_and_si128(v, _mm_set1_epi32(static_cast<int>(0xFFFFF800))),
+                    _mm_set1_epi32(SURROGATE_MIN));
+            auto isTooHigh = _mm_or_si128(
+                    _mm_cmpgt_epi32(v, _mm_set1_epi32(UNICODE_MAX)),
+                    _mm_cmplt_epi32(v, _mm_setzero_si128()));
+            return _mm_movemask_epi8(_mm_or_si128(isSurrogate, isTooHigh)) == 0;
+        }
+    }
+#endif
+
+    ///
+    /// Reads code point by code point;
+    /// contiguous data goes in 16-byte blocks: load unaligned, swap bytes,
+    /// and if all units are whole code points, put them w/o further checks
+    ///
+    template <size_t N, std::endian e, class Enc, class It, class It2, class Enc2, class Mjh>
+    It2 copyByteOrdered(It p, It end, It2 dest, const Mjh& onMojibake)
+    {
+        // @return [+] halt
+        auto copyCp = [&]() {
+            auto c = ItEnc<It, Enc>::get(p, end, onMojibake);
+            bool halt = c & handler::FG_HALT;
+            c &= handler::MASK_CODE;
+            if (c != handler::RET_SKIP)
+                halt |= !ItEnc<It2, Enc2>::put(dest, c);
+            return halt;
+        };
+    #ifdef MJ_SSE2
+        if constexpr (std::contiguous_iterator<It> && sizeof(ChType<It>) == 1) {
+            constexpr ptrdiff_t BLOCK = 16;
+            constexpr size_t NUNITS = BLOCK / N;
+            using Word = std::conditional_t<N == 2, char16_t, char32_t>;
+            while (end - p >= BLOCK) {
+                auto v = loadUnits<N, e>(std::to_address(p));
+                if (!areWholeCps<N>(v)) [[unlikely]] {
+                    for (auto blockEnd = p + BLOCK; p < blockEnd; ) {
+                        if (copyCp())
+                            return dest;
+                    }
+                    continue;
+                }
+                if constexpr ((std::is_same_v<Enc2, Utf8> || std::is_same_v<Enc2, Cesu8>)
+                        && !IteratorLimit<It2>::isLimited) {
+                    if (nonAsciiMask<Word>(v) == 0) {
+                        char buf[BLOCK];
+                        if constexpr (N == 4)
+                            v = _mm_packs_epi32(v, v);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(buf), _mm_packus_epi16(v, v));
+                        dest = std::copy(buf, buf + NUNITS, dest);
+                        p += BLOCK;
+                        continue;
+                    }
+                }
+                Word units[NUNITS];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(units), v);
+                for (auto c : units) {
+                    if (!ItEnc<It2, Enc2>::put(dest, c))
+                        return dest;
+                }
+                p += BLOCK;
+            }
+        }
+    #endif
+        while (p != end) {
+            if (copyCp())
+                break;
+        }
+        return dest;
+    }
+
+    /// Counts code points by get(), for encodings where it’s fast enough
+    template <class It, class Enc>
+    size_t countCpsByGet(It p, It end)
+    {
+        size_t r = 0;
+        bool isBad;
+        auto onBadData = [&isBad](It, Event) { isBad = true; return handler::RET_SKIP; };
+        while (p != end) {
+            isBad = false;
+            ItEnc<It, Enc>::get(p, end, onBadData);
+            r += !isBad;
+        }
+        return r;
+    }
+
+    template <class It, class Enc>
+    bool isValidByGet(It p, It end)
+    {
+        auto onBadData = [](It, Event) { return handler::RET_HALT; };
+        while (p != end) {
+            if (ItEnc<It, Enc>::get(p, end, onBadData) & handler::FG_HALT)
+                return false;
+        }
+        return true;
+    }
+
+    ///// UTF-16 of some byte order ////////////////////////////////////////////
+
+    template <class It, std::endian e>
+    class ItEnc<It, Utf16Bytes<e>>
+    {
+    public:
+        static bool put(It& it, char32_t cp);
+
+        template <class It2, class Enc2, class Mjh>
+        static inline It2 copy(It p, It end, It2 dest, const Mjh& onMojibake)
+            { return copyByteOrdered<2, e, Utf16Bytes<e>, It, It2, Enc2, Mjh>(p, end, dest, onMojibake); }
+
+        template <class Mjh>
+        static char32_t get(It& p, It end, const Mjh& onMojibake);
+
+        static size_t countCps(It p, It end)
+            { return countCpsByGet<It, Utf16Bytes<e>>(p, end); }
+        static bool isValid(It p, It end)
+            { return isValidByGet<It, Utf16Bytes<e>>(p, end); }
+        static It prevStart(It beg, It p);
+    };
+
+    template <class It, std::endian e>
+    bool ItEnc<It, Utf16Bytes<e>>::put(It& it, char32_t cp)
+    {
+        if (cp < U16_2WORD_MIN) [[likely]] {   // 1 word
+            if (!hasRoom(it, 2))
+                return false;
+            writeUnit<2, e>(it, cp);
+        } else if (cp <= U16_2WORD_MAX) [[unlikely]] { // 2 words
+            if (!hasRoom(it, 4))
+                return false;
+            cp -= U16_2WORD_MIN;
+            writeUnit<2, e>(it, SURROGATE_LO_MIN | (cp >> 10));
+            writeUnit<2, e>(it, SURROGATE_HI_MIN | (cp & 0x3FF));
+        }
+        return true;
+    }
+
+    template <class It, std::endian e> template <class Mjh>
+    char32_t ItEnc<It, Utf16Bytes<e>>::get(It& p, It end, const Mjh& onMojibake)
+    {
+        auto cpStart = p;
+        char32_t word1, word2;
+        if (!readUnit<2, e>(p, end, word1)) [[unlikely]]
+            return onMojibake(cpStart, Event::END);
+        if (word1 < SURROGATE_MIN || word1 > SURROGATE_MAX) [[likely]]
+            return word1;
+        if (word1 >= SURROGATE_HI_MIN) [[unlikely]]  // Trailing surrogate
+            return onMojibake(cpStart, Event::BYTE_START);
+        auto next = p;
+        if (!readUnit<2, e>(next, end, word2)) [[unlikely]] {
+            p = end;
+            return onMojibake(cpStart, Event::END);
+        }
+        if (word2 < SURROGATE_HI_MIN || word2 > SURROGATE_HI_MAX) [[unlikely]]
+            return onMojibake(p, Event::BYTE_NEXT);   // DO NOT increment
+        p = next;
+        return (((word1 & 0x3FF) << 10) | (word2 & 0x3FF)) + 0x10000;
+    }
+
+    /// Incomplete unit at the end is a separate bad sequence,
+    /// or a part of bad pair with leading surrogate before it
+    template <class It, std::endian e>
+    It ItEnc<It, Utf16Bytes<e>>::prevStart(It beg, It p)
+    {
+        static_assert(std::random_access_iterator<It>, "Need random-access data");
+        auto last = p - (((p - beg) % 2 != 0) ? 1 : 2);
+        if (last - beg < 2)
+            return last;
+        auto q = last - 2, q1 = q;
+        char32_t word1, word2;
+        readUnit<2, e>(q1, last, word1);
+        if (word1 < SURROGATE_LO_MIN || word1 > SURROGATE_LO_MAX)
+            return last;
+        if (!readUnit<2, e>(q1, p, word2))
+            return q;
+        return (word2 >= SURROGATE_HI_MIN && word2 <= SURROGATE_HI_MAX) ? q : last;
+    }
+
+    ///// UTF-32 of some byte order ////////////////////////////////////////////
+
+    template <class It, std::endian e>
+    class ItEnc<It, Utf32Bytes<e>>
+    {
+    public:
+        static inline bool put(It& it, char32_t cp)
+        {
+            if (!hasRoom(it, 4))
+                return false;
+            writeUnit<4, e>(it, cp);
+            return true;
+        }
+
+        template <class It2, class Enc2, class Mjh>
+        static inline It2 copy(It p, It end, It2 dest, const Mjh& onMojibake)
+            { return copyByteOrdered<4, e, Utf32Bytes<e>, It, It2, Enc2, Mjh>(p, end, dest, onMojibake); }
+
+        /// Incomplete unit at the end → END
+        template <class Mjh>
+        static inline char32_t get(It& p, It end, const Mjh& onMojibake)
+        {
+            auto cpStart = p;
+            char32_t c;
+            if (!readUnit<4, e>(p, end, c)) [[unlikely]]
+                return onMojibake(cpStart, Event::END);
+            if (mojibake::isValid(c)) [[likely]]
+                return c;
+            return onMojibake(cpStart, Event::CODE);
+        }
+
+        static size_t countCps(It p, It end)
+            { return countCpsByGet<It, Utf32Bytes<e>>(p, end); }
+        static bool isValid(It p, It end)
+            { return isValidByGet<It, Utf32Bytes<e>>(p, end); }
+
+        static It prevStart(It beg, It p)
+        {
+            static_assert(std::random_access_iterator<It>, "Need random-access data");
+            auto rem = (p - beg) % 4;
+            return p - ((rem != 0) ? rem : 4);
+        }
+    };
+
+}   // namespace mojibake::detail
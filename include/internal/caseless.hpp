@@ -0,0 +1,102 @@
+#pragma once
+
+#include <string>
+
+namespace mojibake::detail {
+
+    ///
+    /// Skips units that cannot start a match: ASCII except lo and up
+    /// (non-ASCII may fold to ASCII: K KELVIN SIGN → k)
+    /// @param [in] lo, up  ASCII variants of 1st code point, or ≥ 0x80
+    /// @return  1st candidate in [p, end), or end
+    ///
+    template <class Ch>
+    const Ch* findCaselessCandidate(const Ch* p, const Ch* end, char32_t lo, char32_t up)
+    {
+        if (lo > U8_1BYTE_MAX)
+            return findNonAscii(p, end);
+    #ifdef MJ_SSE2
+        constexpr auto N = SIMD_UNITS<Ch>;
+        __m128i vLo, vUp;
+        if constexpr (sizeof(Ch) == 1) {
+            vLo = _mm_set1_epi8(static_cast<char>(lo));
+            vUp = _mm_set1_epi8(static_cast<char>(up));
+        } else if constexpr (sizeof(Ch) == 2) {
+            vLo = _mm_set1_epi16(static_cast<short>(lo));
+            vUp = _mm_set1_epi16(static_cast<short>(up));
+        } else {
+            vLo = _mm_set1_epi32(static_cast<int>(lo));
+            vUp = _mm_set1_epi32(static_cast<int>(up));
+        }
+        auto cmpeq = [](__m128i a, __m128i b) {
+            if constexpr (sizeof(Ch) == 1) {
+                return _mm_cmpeq_epi8(a, b);
+            } else if constexpr (sizeof(Ch) == 2) {
+                return _mm_cmpeq_epi16(a, b);
+            } else {
+                return _mm_cmpeq_epi32(a, b);
+            }
+        };
+        for (; end - p >= static_cast<ptrdiff_t>(N); p += N) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            unsigned mask = nonAsciiMask<Ch>(v)
+                    | _mm_movemask_epi8(_mm_or_si128(cmpeq(v, vLo), cmpeq(v, vUp)));
+            if (mask != 0)
+                return p + std::countr_zero(mask) / sizeof(Ch);
+        }
+    #endif
+        for (; p != end; ++p) {
+            char32_t c = static_cast<UnsignedCh<Ch>>(*p);
+            if (c > U8_1BYTE_MAX || c == lo || c == up)
+                break;
+        }
+        return p;
+    }
+
+    ///
+    /// Finds folded needle in haystack folded on the fly;
+    /// bad data is skipped, like simpleCaseFold does
+    ///
+    template <class It, class Enc>
+    std::ranges::subrange<It> findCaseless(It beg, It end, const std::u32string& needle)
+    {
+        if (needle.empty())
+            return { beg, beg };
+        using Sk = handler::Skip<It>;
+        const char32_t first = needle[0];
+        char32_t lo = U8_1BYTE_MAX + 1, up = lo;
+        if (first <= U8_1BYTE_MAX) {
+            lo = up = first;
+            if (first >= 'a' && first <= 'z')
+                up = first - 'a' + 'A';
+        }
+        auto p = beg;
+        while (p != end) {
+            if constexpr (hasAsciiFastPath<It, Enc>) {
+                auto b = std::to_address(p);
+                p += findCaselessCandidate(b, b + (end - p), lo, up) - b;
+                if (p == end)
+                    break;
+            }
+            auto q = p;
+            auto cp = ItEnc<It, Enc>::get(q, end, Sk{});
+            if (cp != handler::RET_SKIP && simpleCaseFoldCp(cp) == first) {
+                auto r = q;
+                size_t i = 1;
+                while (i < needle.length() && r != end) {
+                    auto c = ItEnc<It, Enc>::get(r, end, Sk{});
+                    if (c == handler::RET_SKIP)
+                        continue;
+                    if (simpleCaseFoldCp(c) != needle[i])
+                        break;
+                    ++i;
+                }
+                if (i == needle.length())
+                    return { p, r };
+            }
+            p = q;
+        }
+        return { end, end };
+    }
+
+}   // namespace mojibake::detail
@@ -0,0 +1,171 @@
+#pragma once
+
+namespace mojibake::detail {
+
+    template <class Enc>
+    constexpr bool isCesu = std::is_same_v<Enc, Cesu8> || std::is_same_v<Enc, Mutf8>;
+
+    ///
+    /// Reads surrogate in three bytes: ED A0…BF 80…BF
+    /// @return  surrogate, or 0 if [p, end) does not start with it
+    ///
+    template <class It>
+    char32_t readCesuSurrogate(It p, It end)
+    {
+        unsigned char b[3];
+        for (auto& x : b) {
+            if (p == end)
+                return 0;
+            x = static_cast<unsigned char>(*p);
+            ++p;
+        }
+        if (b[0] != 0xED || (b[1] & 0xE0) != 0xA0 || !isU8ContinueByte(b[2]))
+            return 0;
+        return 0xD000 | ((b[1] & 0x3F) << 6) | (b[2] & 0x3F);
+    }
+
+    ///
+    /// CESU-8 and Modified UTF-8: UTF-8 whose supplementary code points are
+    /// surrogate pairs, three bytes per surrogate.
+    /// Reading goes by UTF-8, and only what UTF-8 finds bad is checked
+    /// for surrogates and C0 80. So we are lenient: 4-byte UTF-8 is also read,
+    /// and so is raw NUL of Modified UTF-8
+    ///
+    template <class It, class Enc>
+    class ItEncCesu
+    {
+    public:
+        static bool put(It& it, char32_t cp);
+
+        template <class It2, class Enc2, class Mjh>
+        static It2 copy(It p, It end, It2 dest, const Mjh& onMojibake);
+
+        template <class Mjh>
+        static char32_t get(It& p, It end, const Mjh& onMojibake);
+
+        static size_t countCps(It p, It end)
+            { return countCpsByGet<It, Enc>(p, end); }
+        static bool isValid(It p, It end)
+            { return isValidByGet<It, Enc>(p, end); }
+        static It prevStart(It beg, It p);
+    };
+
+    template <class It, class Enc>
+    bool ItEncCesu<It, Enc>::put(It& it, char32_t cp)
+    {
+        if constexpr (std::is_same_v<Enc, Mutf8>) {
+            if (cp == 0) [[unlikely]] {
+                if (!hasRoom(it, 2))
+                    return false;
+                putByte(it, 0xC0);
+                putByte(it, 0x80);
+                return true;
+            }
+        }
+        if (cp < U16_2WORD_MIN) [[likely]]
+            return ItEnc<It, Utf8>::put(it, cp);
+        if (cp <= U16_2WORD_MAX) {
+            if (!hasRoom(it, 6))
+                return false;
+            cp -= U16_2WORD_MIN;
+            ItEnc<It, Utf8>::put(it, SURROGATE_LO_MIN | (cp >> 10));
+            ItEnc<It, Utf8>::put(it, SURROGATE_HI_MIN | (cp & 0x3FF));
+        }
+        return true;
+    }
+
+    template <class It, class Enc> template <class Mjh>
+    char32_t ItEncCesu<It, Enc>::get(It& p, It end, const Mjh& onMojibake)
+    {
+        auto cpStart = p;
+        auto place = p;
+        auto event = Event::CODE;
+        bool isBad = false;
+        auto onBadData = [&](It aPlace, Event aEvent) {
+            isBad = true;
+            place = aPlace;
+            event = aEvent;
+            return handler::RET_SKIP;
+        };
+        auto c = ItEnc<It, Utf8>::get(p, end, onBadData);
+        if (!isBad) [[likely]]
+            return c;
+        if (event == Event::CODE) {
+            auto byte1 = static_cast<unsigned char>(*cpStart);
+            if constexpr (std::is_same_v<Enc, Mutf8>) {
+                // CODE at C0 = two bytes
+                if (byte1 == 0xC0 && static_cast<unsigned char>(*std::next(cpStart)) == 0x80)
+                    return 0;
+            }
+            if (byte1 == 0xED) {    // CODE at ED = surrogate
+                auto word1 = readCesuSurrogate(cpStart, p);
+                if (word1 >= SURROGATE_HI_MIN)  // Trailing surrogate
+                    return onMojibake(cpStart, Event::BYTE_START);
+                if (p == end)
+                    return onMojibake(cpStart, Event::END);
+                auto word2 = readCesuSurrogate(p, end);
+                if (word2 < SURROGATE_HI_MIN)
+                    return onMojibake(p, Event::BYTE_NEXT);   // DO NOT increment
+                std::advance(p, 3);
+                return (((word1 & 0x3FF) << 10) | (word2 & 0x3FF)) + 0x10000;
+            }
+        }
+        return onMojibake(place, event);
+    }
+
+    ///
+    /// Data goes through UTF-8 copy at full speed, which halts on what
+    /// UTF-8 finds bad, then we read one code point by ourselves
+    ///
+    template <class It, class Enc> template <class It2, class Enc2, class Mjh>
+    It2 ItEncCesu<It, Enc>::copy(It p, It end, It2 dest, const Mjh& onMojibake)
+    {
+        It bad = end;
+        Event event = Event::CODE;
+        auto onBadData = [&bad, &event](It place, Event ev) {
+            bad = place;
+            event = ev;
+            return handler::RET_HALT;
+        };
+        while (p != end) {
+            bad = end;
+            dest = ItEnc<It, Utf8>::template copy<It2, Enc2, decltype(onBadData)>(
+                        p, end, dest, onBadData);
+            if (bad == end)     // data ended, or no room
+                break;
+            // BYTE_NEXT: sequence start is behind, UTF-8 goes on from bad unit
+            p = bad;
+            auto c = (event == Event::BYTE_NEXT)
+                    ? onMojibake(p, event)
+                    : get(p, end, onMojibake);
+            bool halt = c & handler::FG_HALT;
+            c &= handler::MASK_CODE;
+            if (c != handler::RET_SKIP)
+                halt |= !ItEnc<It2, Enc2>::put(dest, c);
+            if (halt)
+                break;
+        }
+        return dest;
+    }
+
+    template <class It, class Enc>
+    It ItEncCesu<It, Enc>::prevStart(It beg, It p)
+    {
+        static_assert(std::random_access_iterator<It>, "Need random-access data");
+        auto s = ItEnc<It, Utf8>::prevStart(beg, p);
+        if (p - s == 3 && s - beg >= 3
+                && readCesuSurrogate(s, p) >= SURROGATE_HI_MIN) {
+            auto word1 = readCesuSurrogate(s - 3, s);
+            if (word1 >= SURROGATE_LO_MIN && word1 <= SURROGATE_LO_MAX)
+                return s - 3;
+        }
+        return s;
+    }
+
+    template <class It>
+    class ItEnc<It, Cesu8> : public ItEncCesu<It, Cesu8> {};
+
+    template <class It>
+    class ItEnc<It, Mutf8> : public ItEncCesu<It, Mutf8> {};
+
+}   // namespace mojibake::detail
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstring>
+
+namespace mojibake::detail {
+
+    static_assert(std::size(cpToUnicode) == static_cast<size_t>(Cp::NN));
+    static_assert(std::size(cpFromUnicodeLookup) == static_cast<size_t>(Cp::NN));
+
+    template <class Enc>
+    constexpr bool isCodePage = false;
+
+    template <Cp x>
+    constexpr bool isCodePage<CodePage<x>> = true;
+
+    /// What we write instead of code points that are not in code page
+    constexpr unsigned char CP_SUBST = '?';
+
+    /// @return  code point of byte, 0 if undefined
+    template <Cp id>
+    inline char32_t cpDecode(unsigned char b)
+    {
+        if (b <= U8_1BYTE_MAX)
+            return b;
+        return cpToUnicode[static_cast<int>(id)][b - 0x80];
+    }
+
+    /// @return  byte of code point, 0 if not in code page (and cp ≠ 0)
+    template <Cp id>
+    inline unsigned char cpEncode(char32_t cp)
+    {
+        if (cp <= U8_1BYTE_MAX)
+            return cp;
+        if (cp >= CPFROM_MAXCP)
+            return 0;
+        auto index = cpFromUnicodeLookup[static_cast<int>(id)][cp >> CPFROM_BLOCKSHIFT];
+        return cpFromUnicodeBlocks[index][cp & CPFROM_BLOCKMASK];
+    }
+
+    template <class It, Cp id>
+    class ItEnc<It, CodePage<id>>
+    {
+    public:
+        /// Writes CP_SUBST if cp is not in code page
+        static inline bool put(It& it, char32_t cp)
+            noexcept (noexcept(*it = static_cast<unsigned char>(cp)) && noexcept (++it))
+        {
+            if constexpr (IteratorLimit<It>::isLimited) {
+                if (IteratorLimit<It>::remainder(it) == 0)
+                    return false;
+            }
+            auto b = cpEncode<id>(cp);
+            if (b == 0 && cp != 0) [[unlikely]]
+                b = CP_SUBST;
+            *it = b;
+            ++it;
+            return true;
+        }
+
+        template <class It2, class Enc2, class Mjh>
+        static inline It2 copy(It p, It end, It2 dest, const Mjh& onMojibake);
+
+        template <class Mjh>
+        static inline char32_t get(It& p, It end, const Mjh& onMojibake);
+
+        static size_t countCps(It p, It end);
+        static bool isValid(It p, It end);
+        static It prevStart([[maybe_unused]] It beg, It p) { return std::prev(p); }
+        static It startOf([[maybe_unused]] It beg, It x) { return x; }
+    };
+
+    ///
+    /// Block kernel: code page → UTF-8
+    /// 16-byte blocks of ASCII are found by SIMD and copied as a whole,
+    /// other blocks are expanded from precomputed UTF-8 sequences
+    /// to small buffer w/o branching
+    ///
+    template <Cp id, class It, class It2, class Enc2, class Mjh>
+    It2 copyCpToUtf8(It p, It end, It2 dest, const Mjh& onMojibake)
+    {
+        const auto& table = cpToUtf8[static_cast<int>(id)];
+        auto beg = std::to_address(p);
+        auto q = beg;
+        auto qend = beg + (end - p);
+        // @return [+] halt
+        auto putSlowly = [&](decltype(beg) qq) {
+            auto seq = table[static_cast<unsigned char>(*qq)];
+            if (seq == 0) [[unlikely]]
+                return handleMojibake<Enc2>(p + (qq - beg), Event::CODE, dest, onMojibake);
+            for (auto len = seq >> 24; len != 0; --len, seq >>= 8) {
+                *dest = static_cast<unsigned char>(seq);  ++dest;
+            }
+            return false;
+        };
+        if constexpr (std::endian::native == std::endian::little) {
+            constexpr size_t N = 16;
+            char buf[N * 3 + 1];    // 3 bytes max, + 1 written extra
+            for (; qend - q >= static_cast<ptrdiff_t>(N); q += N) {
+            #ifdef MJ_SSE2
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+                if (nonAsciiMask<char>(v) == 0) {
+                    dest = std::copy(q, q + N, dest);
+                    continue;
+                }
+            #endif
+                auto out = buf;
+                bool isBad = false;
+                for (size_t i = 0; i < N; ++i) {
+                    auto seq = table[static_cast<unsigned char>(q[i])];
+                    isBad |= (seq == 0);
+                    std::memcpy(out, &seq, 4);
+                    out += seq >> 24;
+                }
+                if (isBad) [[unlikely]] {
+                    for (size_t i = 0; i < N; ++i) {
+                        if (putSlowly(q + i))
+                            return dest;
+                    }
+                } else {
+                    dest = std::copy(buf, out, dest);
+                }
+            }
+        }
+        for (; q != qend; ++q) {
+            if (putSlowly(q))
+                break;
+        }
+        return dest;
+    }
+
+    template <class It, Cp id> template <class It2, class Enc2, class Mjh>
+    inline It2 ItEnc<It, CodePage<id>>::copy(It p, It end, It2 dest, const Mjh& onMojibake)
+    {
+        // Code pages are BMP, so CESU-8 is the same
+        if constexpr (hasAsciiFastPath<It, CodePage<id>>
+                && (std::is_same_v<Enc2, Utf8> || std::is_same_v<Enc2, Cesu8>)
+                && !IteratorLimit<It2>::isLimited) {
+            return copyCpToUtf8<id, It, It2, Enc2, Mjh>(p, end, dest, onMojibake);
+        } else if constexpr (id == Cp::ISO8859_1) {
+            return copyFromLatin1<It, It2, Enc2>(p, end, dest);
+        }
+        for (; p != end; ++p) {
+            char32_t c = cpDecode<id>(*p);
+            if (c != 0 || *p == 0) [[likely]] {
+                if (!ItEnc<It2, Enc2>::put(dest, c))
+                    break;
+            } else [[unlikely]] {
+                if (handleMojibake<Enc2>(p, Event::CODE, dest, onMojibake))
+                    break;
+            }
+        }
+        return dest;
+    }
+
+    template <class It, Cp id> template <class Mjh>
+    inline char32_t ItEnc<It, CodePage<id>>::get(It& p, [[maybe_unused]] It end, const Mjh& onMojibake)
+    {
+        auto cpStart = p++;
+        char32_t c = cpDecode<id>(*cpStart);
+        if (c != 0 || *cpStart == 0) [[likely]]
+            return c;
+        return onMojibake(cpStart, Event::CODE);
+    }
+
+    template <class It, Cp id>
+    size_t ItEnc<It, CodePage<id>>::countCps(It p, It end)
+    {
+        size_t r = 0;
+        for (; p != end; ++p) {
+            if (cpDecode<id>(*p) != 0 || *p == 0)
+                ++r;
+        }
+        return r;
+    }
+
+    template <class It, Cp id>
+    bool ItEnc<It, CodePage<id>>::isValid(It p, It end)
+    {
+        for (; p != end; ++p) {
+            if (cpDecode<id>(*p) == 0 && *p != 0)
+                return false;
+        }
+        return true;
+    }
+
+    ///
+    /// Copies data to code page: every code point not in code page
+    /// goes to onMojibake as Event::CODE
+    ///
+    template <class It1, class It2, class Enc1, class Enc2, class Mjh>
+    It2 copyToCodePage(It1 p, It1 end, It2 dest, const Mjh& onMojibake)
+    {
+        bool isMojibake = false;
+        auto onBadData = [&isMojibake, &onMojibake](It1 place, Event event) {
+            isMojibake = true;
+            return onMojibake(place, event);
+        };
+        while (p != end) {
+            auto cpStart = p;
+            isMojibake = false;
+            auto c = ItEnc<It1, Enc1>::get(p, end, onBadData);
+            bool halt = c & handler::FG_HALT;
+            c &= handler::MASK_CODE;
+            if (c != handler::RET_SKIP) {
+                // What handler returned is not checked again
+                if (isMojibake || cpEncode<Enc2::id>(c) != 0 || c == 0) [[likely]] {
+                    if (!ItEnc<It2, Enc2>::put(dest, c))
+                        break;
+                } else {
+                    halt |= handleMojibake<Enc2>(cpStart, Event::CODE, dest, onMojibake);
+                }
+            }
+            if (halt)
+                break;
+        }
+        return dest;
+    }
+
+    /// Chooses copy algorithm: code pages need one more check on writing
+    template <class It1, class It2, class Enc1, class Enc2, class Mjh>
+    inline It2 copy(It1 beg, It1 end, It2 dest, const Mjh& onMojibake)
+    {
+        if constexpr (std::is_same_v<Enc2, Latin1>) {
+            return copyToLatin1<It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake);
+        } else if constexpr (isCodePage<Enc2>) {
+            return copyToCodePage<It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake);
+        } else {
+            return ItEnc<It1, Enc1>::template copy<It2, Enc2, Mjh>(beg, end, dest, onMojibake);
+        }
+    }
+
+}   // namespace mojibake::detail
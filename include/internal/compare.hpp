@@ -0,0 +1,102 @@
+#pragma once
+
+#include <compare>
+
+namespace mojibake::detail {
+
+#ifdef MJ_SSE2
+    /// Char type of W bytes
+    template <size_t W>
+    using CharOfSize = std::conditional_t<W == 1, char,
+                       std::conditional_t<W == 2, char16_t, char32_t>>;
+
+    ///
+    /// Loads 16 units, zero-extended to W bytes
+    /// @param [out] out  W vectors
+    ///
+    template <size_t W, class Ch>
+    inline void loadWidened(const Ch* p, __m128i* out)
+    {
+        static_assert(sizeof(Ch) <= W);
+        const auto zero = _mm_setzero_si128();
+        for (size_t i = 0; i < sizeof(Ch); ++i) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + i);
+            if constexpr (sizeof(Ch) == W) {
+                *out++ = v;
+            } else if constexpr (sizeof(Ch) == 2) {     // 2 → 4
+                *out++ = _mm_unpacklo_epi16(v, zero);
+                *out++ = _mm_unpackhi_epi16(v, zero);
+            } else {
+                auto lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+                if constexpr (W == 2) {
+                    *out++ = lo;
+                    *out++ = hi;
+                } else {
+                    *out++ = _mm_unpacklo_epi16(lo, zero);
+                    *out++ = _mm_unpackhi_epi16(lo, zero);
+                    *out++ = _mm_unpacklo_epi16(hi, zero);
+                    *out++ = _mm_unpackhi_epi16(hi, zero);
+                }
+            }
+        }
+    }
+
+    /// @return  # of leading units of 16 that are ASCII and equal in both
+    template <class Ch1, class Ch2>
+    inline size_t commonAsciiPrefix(const Ch1* p1, const Ch2* p2)
+    {
+        constexpr size_t W = std::max(sizeof(Ch1), sizeof(Ch2));
+        __m128i v1[W], v2[W];
+        loadWidened<W>(p1, v1);
+        loadWidened<W>(p2, v2);
+        for (size_t i = 0; i < W; ++i) {
+            unsigned bad = nonAsciiMask<CharOfSize<W>>(v1[i])
+                         | (~_mm_movemask_epi8(_mm_cmpeq_epi8(v1[i], v2[i])) & 0xFFFF);
+            if (bad != 0)
+                return i * (16 / W) + std::countr_zero(bad) / W;
+        }
+        return 16;
+    }
+#endif
+
+    ///
+    /// Compares by code points; equal ASCII units are skipped w/o decoding,
+    /// by SIMD if possible
+    ///
+    template <class It1, class Enc1, class It2, class Enc2>
+    std::strong_ordering compare(It1 p1, It1 end1, It2 p2, It2 end2)
+    {
+        while (true) {
+            if constexpr (hasAsciiFastPath<It1, Enc1> && hasAsciiFastPath<It2, Enc2>) {
+            #ifdef MJ_SSE2
+                while (end1 - p1 >= 16 && end2 - p2 >= 16) {
+                    auto n = commonAsciiPrefix(std::to_address(p1), std::to_address(p2));
+                    p1 += n;
+                    p2 += n;
+                    if (n < 16)
+                        break;
+                }
+            #endif
+            }
+            if constexpr (isAsciiBased<Enc1> && isAsciiBased<Enc2>) {
+                for (; p1 != end1 && p2 != end2; ++p1, ++p2) {
+                    auto c = unitAt(p1);
+                    if (c > U8_1BYTE_MAX || c != unitAt(p2))
+                        break;
+                }
+            }
+            if (p1 == end1 || p2 == end2) {
+                if (p2 != end2)
+                    return std::strong_ordering::less;
+                if (p1 != end1)
+                    return std::strong_ordering::greater;
+                return std::strong_ordering::equal;
+            }
+            auto c1 = ItEnc<It1, Enc1>::get(p1, end1, handler::Moji<It1>{});
+            auto c2 = ItEnc<It2, Enc2>::get(p2, end2, handler::Moji<It2>{});
+            if (c1 != c2)
+                return c1 <=> c2;
+        }
+    }
+
+}   // namespace mojibake::detail
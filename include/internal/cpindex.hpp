@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>   // won’t be included actually
+
+namespace mojibake::detail {
+
+    /// @return [+] code point starts at this unit:
+    ///             all except UTF-8 10xx.xxxx and UTF-16 trailing surrogates
+    template <class Ch>
+    constexpr bool isStartUnit(Ch c)
+    {
+        if constexpr (sizeof(Ch) == 1) {
+            return (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+        } else {
+            return (static_cast<char16_t>(c) & 0xFC00) != SURROGATE_HI_MIN;
+        }
+    }
+
+#ifdef MJ_SSE2
+    ///
+    /// @return  bit mask of starting units in 16 bytes at p,
+    ///          lowest bit of every unit
+    ///
+    template <class Ch>
+    inline unsigned startMask(const Ch* p)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        if constexpr (sizeof(Ch) == 1) {
+            // 80…BF = −128…−65
+            return _mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8(-65)));
+        } else {
+            auto isCont = _mm_cmpeq_epi16(
+                    _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFC00))),
+                    _mm_set1_epi16(static_cast<short>(SURROGATE_HI_MIN)));
+            return ~_mm_movemask_epi8(isCont) & 0x5555;
+        }
+    }
+#endif
+
+    /// @return  # of starting units in [p, end)
+    template <class Ch>
+    size_t countStarts(const Ch* p, const Ch* end)
+    {
+        size_t r = 0;
+    #ifdef MJ_SSE2
+        constexpr ptrdiff_t N = SIMD_UNITS<Ch>;
+        for (; end - p >= N; p += N)
+            r += std::popcount(startMask(p));
+    #endif
+        for (; p != end; ++p)
+            r += isStartUnit(*p);
+        return r;
+    }
+
+    ///
+    /// Finds n’th starting unit in [p, end), n ≥ 1
+    /// @param [in,out] n  − # of starting units passed, 0 if found
+    /// @return  that unit, or end
+    ///
+    template <class Ch>
+    const Ch* skipStarts(const Ch* p, const Ch* end, size_t& n)
+    {
+    #ifdef MJ_SSE2
+        constexpr ptrdiff_t N = SIMD_UNITS<Ch>;
+        for (; end - p >= N; p += N) {
+            auto mask = startMask(p);
+            size_t count = std::popcount(mask);
+            if (count >= n) {
+                for (; n > 1; --n)
+                    mask &= mask - 1;
+                n = 0;
+                return p + std::countr_zero(mask) / sizeof(Ch);
+            }
+            n -= count;
+        }
+    #endif
+        for (; p != end; ++p) {
+            if (isStartUnit(*p) && --n == 0)
+                return p;
+        }
+        return end;
+    }
+
+    ///
+    /// Builds code point index in one pass
+    /// First unit always starts a code point
+    /// @param [out] offsets  offset of every STEP’th code point
+    /// @return  # of code points
+    ///
+    template <class Ch>
+    size_t buildCpIndex(const Ch* beg, const Ch* end, std::vector<size_t>& offsets)
+    {
+        if (beg == end)
+            return 0;
+        offsets.reserve((end - beg) / CPINDEX_STEP + 1);
+        offsets.push_back(0);
+        size_t nCps = 1;
+        for (auto p = beg + 1; ; ++p) {
+            size_t n = CPINDEX_STEP;
+            p = skipStarts(p, end, n);
+            nCps += CPINDEX_STEP - n;
+            if (p == end)
+                return nCps;
+            offsets.push_back(p - beg);
+        }
+    }
+
+}   // namespace mojibake::detail
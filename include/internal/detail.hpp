@@ -191,8 +191,20 @@ namespace mojibake::detail {
         template <class It2, class Enc2, class Mjh>
         static inline It2 copy(It p, It end, It2 dest, const Mjh& onMojibake);
 
+        /// Reads one code point the same way copy does, p != end
+        /// @return  code point, or what onMojibake returned
+        template <class Mjh>
+        static inline char32_t get(It& p, It end, const Mjh& onMojibake);
+
         static size_t countCps(It p, It end);
         static bool isValid(It p, It end);
+
+        /// @return  start of code point (or bad data) that ends at p, p != beg;
+        ///          the same that reading from beg would find
+        static It prevStart([[maybe_unused]] It beg, It p) { return std::prev(p); }
+
+        /// @return  start of code point (or bad data) that contains unit x
+        static It startOf([[maybe_unused]] It beg, It x) { return x; }
     };
 
     /// @return [+] halt
@@ -275,6 +287,16 @@ namespace mojibake::detail {
         return dest;
     }
 
+    template <class It> template <class Mjh>
+    inline char32_t ItEnc<It, Utf32>::get(It& p, [[maybe_unused]] It end, const Mjh& onMojibake)
+    {
+        auto cpStart = p++;
+        char32_t c = *cpStart;
+        if (mojibake::isValid(c)) [[likely]]
+            return c;
+        return onMojibake(cpStart, Event::CODE);
+    }
+
     template <class It>
     class ItEnc<It, Utf16>
     {
@@ -285,8 +307,13 @@ namespace mojibake::detail {
         template <class It2, class Enc2, class Mjh>
         static It2 copy(It p, It end, It2 dest, const Mjh& onMojibake);
 
+        template <class Mjh>
+        static char32_t get(It& p, It end, const Mjh& onMojibake);
+
         static size_t countCps(It p, It end);
         static bool isValid(It p, It end);
+        static It prevStart(It beg, It p) { return startOf(beg, std::prev(p)); }
+        static It startOf(It beg, It x);
     };
 
     template <class It>
@@ -350,6 +377,24 @@ namespace mojibake::detail {
         return dest;
     }
 
+    template <class It> template <class Mjh>
+    char32_t ItEnc<It, Utf16>::get(It& p, It end, const Mjh& onMojibake)
+    {
+        auto cpStart = p++;
+        char16_t word1 = *cpStart;
+        if (word1 < SURROGATE_MIN || word1 > SURROGATE_MAX) [[likely]]
+            return word1;
+        if (word1 >= SURROGATE_HI_MIN) [[unlikely]]  // Trailing surrogate
+            return onMojibake(cpStart, Event::BYTE_START);
+        if (p == end) [[unlikely]]
+            return onMojibake(cpStart, Event::END);
+        char16_t word2 = *p;
+        if (word2 < SURROGATE_HI_MIN || word2 > SURROGATE_HI_MAX) [[unlikely]]
+            return onMojibake(p, Event::BYTE_NEXT);   // DO NOT increment
+        ++p;
+        return (((word1 & 0x3FF) << 10) | (word2 & 0x3FF)) + 0x10000;
+    }
+
     template <class It>
     size_t ItEnc<It, Utf16>::countCps(It p, It end)
     {
@@ -418,6 +463,19 @@ namespace mojibake::detail {
         return true;
     }
 
+    template <class It>
+    It ItEnc<It, Utf16>::startOf(It beg, It x)
+    {
+        char16_t word2 = *x;
+        if (x != beg && word2 >= SURROGATE_HI_MIN && word2 <= SURROGATE_HI_MAX) {
+            auto q = std::prev(x);
+            char16_t word1 = *q;
+            if (word1 >= SURROGATE_LO_MIN && word1 <= SURROGATE_LO_MAX)
+                return q;
+        }
+        return x;
+    }
+
     template <class It>
     class ItEnc<It, Utf8>
     {
@@ -428,8 +486,13 @@ namespace mojibake::detail {
         template <class It2, class Enc2, class Mjh>
         static inline It2 copy(It p, It end, It2 dest, const Mjh& onMojibake);
 
+        template <class Mjh>
+        static char32_t get(It& p, It end, const Mjh& onMojibake);
+
         static size_t countCps(It p, It end);
         static bool isValid(It p, It end);
+        static It prevStart(It beg, It p) { return startOf(beg, std::prev(p)); }
+        static It startOf(It beg, It x);
     };
 
     template <class It>
@@ -548,6 +611,60 @@ namespace mojibake::detail {
 #undef MJ_PUT_HALTSTMT
 #undef MJ_CHECK_REM
 
+    template <class It> template <class Mjh>
+    char32_t ItEnc<It, Utf8>::get(It& p, It end, const Mjh& onMojibake)
+    {
+    #define MJ_READCP \
+                if (p == end) goto abruptEnd;     \
+                byte2 = *p;                       \
+                if (!isU8ContinueByte(byte2)) goto badNext; \
+                ++p;
+
+        auto cpStart = p++;
+        unsigned char byte1 = *cpStart;
+        unsigned char byte2;
+        char32_t cp;
+        switch (count1(byte1)) {
+        case 0:  // 0###.#### = 1 byte
+            return byte1;
+        // 1 is default!!
+        case 2:  // 110#.#### = 2 bytes
+            cp = (byte1 & 0x1F) << 6;
+            MJ_READCP;  cp |= (byte2 & 0x3F);
+            if (cp < U8_2BYTE_MIN)
+                goto badCode;
+            return cp;
+        case 3: // 1110.#### = 3 bytes
+            cp = (byte1 & 0x0F) << 12;
+            MJ_READCP;  cp |= ((byte2 & 0x3F) << 6);
+            MJ_READCP;  cp |=  (byte2 & 0x3F);
+            if ((cp >= SURROGATE_MIN && cp <= SURROGATE_MAX) || cp < U8_3BYTE_MIN)
+                goto badCode;
+            return cp;
+        case 4: // 1111.0### = 4 bytes
+            cp = (byte1 & 0x07) << 18;
+            MJ_READCP;  cp |= ((byte2 & 0x3F) << 12);
+            MJ_READCP;  cp |= ((byte2 & 0x3F) << 6);
+            MJ_READCP;  cp |=  (byte2 & 0x3F);
+            if (cp < U8_4BYTE_MIN || cp > UNICODE_MAX)
+                goto badCode;
+            return cp;
+        default: [[unlikely]]
+            // Skip all continuation bytes
+            while (p != end && isU8ContinueByte(*p))
+                ++p;
+            return onMojibake(cpStart, Event::BYTE_START);
+        }
+    abruptEnd: [[unlikely]]
+        return onMojibake(cpStart, Event::END);
+    badNext: [[unlikely]]
+        return onMojibake(p, Event::BYTE_NEXT);
+    badCode: [[unlikely]]
+        return onMojibake(cpStart, Event::CODE);
+
+    #undef MJ_READCP
+    }
+
 
     template <class It>
     size_t ItEnc<It, Utf8>::countCps(It p, It end)
@@ -663,4 +780,35 @@ namespace mojibake::detail {
 #undef MJ_READCP
     }
 
+    ///
+    /// Continuation bytes go to the nearest starting byte before them
+    /// if it takes them all; otherwise get() makes them a separate bad sequence.
+    /// O(1) for good data, O(n) for long runs of bad continuation bytes
+    ///
+    template <class It>
+    It ItEnc<It, Utf8>::startOf(It beg, It x)
+    {
+        if (!isU8ContinueByte(*x))
+            return x;
+        auto q = x;
+        while (q != beg && isU8ContinueByte(*q))
+            --q;
+        unsigned char byte1 = *q;
+        int len = count1(byte1);
+        switch (len) {
+        case 0:     // ASCII, then bad continuation bytes
+            return std::next(q);
+        case 1:     // continuation bytes from the very beginning
+            return q;
+        case 2:
+        case 3:
+        case 4:     // get() reads len bytes at most
+            if (std::distance(q, x) < len)
+                return q;
+            return std::next(q, len);
+        default:    // bad starting byte takes all continuation bytes
+            return q;
+        }
+    }
+
 }   // namespace detail
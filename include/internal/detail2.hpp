@@ -4,26 +4,26 @@
 
 namespace mojibake::detail {
 
-    template <typename ToC, typename FromC, bool isEqual>
+    template <typename ToC, typename FromC, class Enc2, class Enc1, bool isEqual>
     class ConvStringProto;
 
-    template <typename ToC, typename FromC>
-    class ConvStringProto<ToC, FromC, false>
+    template <typename ToC, typename FromC, class Enc2, class Enc1>
+    class ConvStringProto<ToC, FromC, Enc2, Enc1, false>
     {
     protected:
         using ToStr = std::basic_string<ToC>;
         using FromSv = std::basic_string_view<FromC>;
         ToStr tmp;
 
-        ConvStringProto(FromSv x) : tmp(toQ<ToStr>(x)) {}
+        ConvStringProto(FromSv x) : tmp(toQ<ToStr, FromSv, Enc2, Enc1>(x)) {}
         size_t length() const { return tmp.length(); }
         const void* data() const { return tmp.data(); }
         void* nonConstData() { return const_cast<void*>(data()); }
         static constexpr bool isConverted() { return true; }
     };
 
-    template <typename ToC, typename FromC>
-    class ConvStringProto<ToC, FromC, true>
+    template <typename ToC, typename FromC, class Enc2, class Enc1>
+    class ConvStringProto<ToC, FromC, Enc2, Enc1, true>
     {
     protected:
         using FromSv = std::basic_string_view<FromC>;
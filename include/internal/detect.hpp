@@ -0,0 +1,169 @@
+#pragma once
+
+namespace mojibake::detail {
+
+    /// Code pages in order of preference, when they score equally
+    constexpr Cp DETECT_CODE_PAGES[] {
+        Cp::CP1252, Cp::CP1251, Cp::CP1250, Cp::KOI8_R, Cp::KOI8_U,
+        Cp::ISO8859_1, Cp::ISO8859_15, Cp::ISO8859_2, Cp::ISO8859_5 };
+
+    /// Weight of frequent letter in cpDetectWeights, MUST match ExtractUnicodeTable
+    constexpr int DETECT_MAX_WEIGHT = 4;
+
+    ///
+    /// Counts zero bytes by position mod 4
+    /// @param [out] zeros  zeros[i] = # of zero bytes at positions 4k+i
+    ///
+    inline void countZeros(const unsigned char* p, size_t n, size_t (&zeros)[4])
+    {
+        size_t i = 0;
+    #ifdef MJ_SSE2
+        for (; n - i >= 16; i += 16) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+            if (mask == 0)
+                continue;
+            zeros[0] += std::popcount(mask & 0x1111u);
+            zeros[1] += std::popcount(mask & 0x2222u);
+            zeros[2] += std::popcount(mask & 0x4444u);
+            zeros[3] += std::popcount(mask & 0x8888u);
+        }
+    #endif
+        for (; i < n; ++i)
+            zeros[i % 4] += (p[i] == 0);
+    }
+
+    /// Detects UTF-16/32 by zero bytes of ASCII chars
+    /// @return  detected, or UNKNOWN if zeros do not form any pattern
+    inline Detected detectWide(size_t n, const size_t (&zeros)[4])
+    {
+        const size_t n4 = n / 4, n2 = n / 2;
+        // Too short
+        if (n4 == 0)
+            return {};
+        // UTF-32: BMP has two zero bytes of four, and ASCII three
+        if (zeros[2] + zeros[3] >= n4 * 2 * 9 / 10 && zeros[0] * 4 < n4)
+            return { Charset::UTF32LE, Cp::NN, 0, 90 };
+        if (zeros[0] + zeros[1] >= n4 * 2 * 9 / 10 && zeros[3] * 4 < n4)
+            return { Charset::UTF32BE, Cp::NN, 0, 90 };
+        // UTF-16: ASCII (and even most of punctuation in other scripts)
+        // has zero high byte
+        auto zEven = zeros[0] + zeros[2], zOdd = zeros[1] + zeros[3];
+        auto confidence = [n2](size_t z) {
+            return static_cast<unsigned char>(std::min<size_t>(99, 60 + z * 80 / n2));
+        };
+        if (zOdd * 10 >= n2 && zEven * 8 <= zOdd)
+            return { Charset::UTF16LE, Cp::NN, 0, confidence(zOdd) };
+        if (zEven * 10 >= n2 && zOdd * 8 <= zEven)
+            return { Charset::UTF16BE, Cp::NN, 0, confidence(zEven) };
+        return {};
+    }
+
+    /// @return  length of [p, p+n) w/o incomplete UTF-8 sequence at the end
+    inline size_t trimUtf8(const unsigned char* p, size_t n)
+    {
+        for (size_t i = 1; i <= 4 && i <= n; ++i) {
+            auto b = p[n - i];
+            if (b < 0x80)
+                return n;
+            if (!isU8ContinueByte(b)) {     // starting byte
+                size_t len = (b >= 0xF0) ? 4 : (b >= 0xE0) ? 3 : 2;
+                return (len > i) ? n - i : n;
+            }
+        }
+        return n;
+    }
+
+    /// Scores code pages by histogram of high bytes;
+    /// each code page weighs frequent letters of its own languages only
+    inline Detected detectCodePage(const size_t (&hist)[128], size_t nHigh)
+    {
+        constexpr auto NPAGES = std::size(DETECT_CODE_PAGES);
+        long long scores[NPAGES];
+        size_t iBest = 0;
+        for (size_t i = 0; i < NPAGES; ++i) {
+            auto& weights = cpDetectWeights[static_cast<int>(DETECT_CODE_PAGES[i])];
+            long long score = 0;
+            for (size_t b = 0; b < 128; ++b)
+                score += static_cast<long long>(hist[b]) * weights[b];
+            scores[i] = score;
+            if (score > scores[iBest])
+                iBest = i;
+        }
+        auto best = scores[iBest];
+        if (best <= 0)
+            return {};
+        // Runner-up that decodes our bytes in another way
+        auto& bestTable = cpToUnicode[static_cast<int>(DETECT_CODE_PAGES[iBest])];
+        long long second = 0;
+        for (size_t i = 0; i < NPAGES; ++i) {
+            auto& table = cpToUnicode[static_cast<int>(DETECT_CODE_PAGES[i])];
+            bool isSame = true;
+            for (size_t b = 0; b < 128 && isSame; ++b)
+                isSame = (hist[b] == 0 || table[b] == bestTable[b]);
+            if (!isSame)
+                second = std::max(second, scores[i]);
+        }
+        // How much text looks like letters (max = all are frequent ones),
+        // + margin over runner-up, less for few high bytes
+        auto maxScore = static_cast<long long>(nHigh) * DETECT_MAX_WEIGHT;
+        auto confidence = std::min<long long>(50, best * 50 / maxScore)
+                        + (best - second) * 45 / best;
+        confidence = confidence * static_cast<long long>(std::min<size_t>(nHigh, 16)) / 16;
+        return { Charset::CODE_PAGE, DETECT_CODE_PAGES[iBest], 0,
+                 static_cast<unsigned char>(confidence) };
+    }
+
+    inline Detected detect(const unsigned char* p, size_t n)
+    {
+        // BOM
+        auto startsWith = [p, n](std::initializer_list<unsigned char> bom) {
+            return n >= bom.size() && std::equal(bom.begin(), bom.end(), p);
+        };
+        if (startsWith({ 0xEF, 0xBB, 0xBF }))
+            return { Charset::UTF8, Cp::NN, 3, 100 };
+        if (startsWith({ 0xFF, 0xFE, 0, 0 }))
+            return { Charset::UTF32LE, Cp::NN, 4, 100 };
+        if (startsWith({ 0, 0, 0xFE, 0xFF }))
+            return { Charset::UTF32BE, Cp::NN, 4, 100 };
+        if (startsWith({ 0xFF, 0xFE }))
+            return { Charset::UTF16LE, Cp::NN, 2, 100 };
+        if (startsWith({ 0xFE, 0xFF }))
+            return { Charset::UTF16BE, Cp::NN, 2, 100 };
+
+        // Zero bytes: UTF-16/32, or binary data
+        size_t zeros[4] { 0, 0, 0, 0 };
+        countZeros(p, n, zeros);
+        if (zeros[0] + zeros[1] + zeros[2] + zeros[3] != 0)
+            return detectWide(n, zeros);
+
+        // UTF-8: ASCII is skipped by SIMD, stops at 1st bad sequence
+        auto p1 = reinterpret_cast<const char*>(p);
+        auto end8 = p1 + trimUtf8(p, n);
+        size_t nSeqs = 0;
+        bool isUtf8 = true;
+        for (auto q = p1; (q = findNonAscii(q, end8)) != end8; ++nSeqs) {
+            using Mh = handler::MojiHalt<const char*>;
+            if (ItEnc<const char*, Utf8>::get(q, end8, Mh{}) & handler::FG_HALT) {
+                isUtf8 = false;
+                break;
+            }
+        }
+        if (isUtf8) {
+            auto confidence = std::min<size_t>(100, 80 + nSeqs * 4);
+            if (nSeqs == 0)     // pure ASCII
+                confidence = 100;
+            return { Charset::UTF8, Cp::NN, 0, static_cast<unsigned char>(confidence) };
+        }
+
+        // Single-byte code pages
+        size_t hist[128] {};
+        size_t nHigh = 0;
+        for (auto q = p1, end = p1 + n; (q = findNonAscii(q, end)) != end; ++q) {
+            ++hist[static_cast<unsigned char>(*q) - 0x80];
+            ++nHigh;
+        }
+        return detectCodePage(hist, nHigh);
+    }
+
+}   // namespace mojibake::detail
@@ -0,0 +1,102 @@
+#pragma once
+
+namespace mojibake::detail {
+
+    /// Byte b of bad data ↔ lone surrogate ESC_BASE + b
+    constexpr unsigned ESC_BASE = SURROGATE_HI_MIN;
+    constexpr unsigned ESC_MIN = ESC_BASE + 0x80;
+    constexpr unsigned ESC_MAX = ESC_BASE + 0xFF;
+
+    /// @return [+] cp is an escaped byte
+    constexpr bool isEscapedByte(char32_t cp) { return cp - ESC_MIN <= ESC_MAX - ESC_MIN; }
+
+    ///// UTF-8 with surrogateescape ///////////////////////////////////////////
+
+    template <class It>
+    class ItEnc<It, Utf8Esc>
+    {
+    public:
+        /// Escaped bytes go as is, the rest as UTF-8
+        static bool put(It& it, char32_t cp)
+        {
+            if (isEscapedByte(cp)) [[unlikely]] {
+                if (!hasRoom(it, 1))
+                    return false;
+                putByte(it, static_cast<unsigned char>(cp));
+                return true;
+            }
+            return ItEnc<It, Utf8>::put(it, cp);
+        }
+
+        template <class It2, class Enc2, class Mjh>
+        static It2 copy(It p, It end, It2 dest, const Mjh& onMojibake);
+
+        /// Never calls onMojibake
+        template <class Mjh>
+        static char32_t get(It& p, It end, [[maybe_unused]] const Mjh& onMojibake)
+        {
+            bool isBad = false;
+            auto onBadData = [&isBad](It, Event) { isBad = true; return handler::RET_SKIP; };
+            auto q = p;
+            auto c = ItEnc<It, Utf8>::get(q, end, onBadData);
+            if (isBad) [[unlikely]]
+                return ESC_BASE | unitAt(p++);
+            p = q;
+            return c;
+        }
+
+        static size_t countCps(It p, It end)
+            { return countCpsByGet<It, Utf8Esc>(p, end); }
+        static bool isValid(It, It) { return true; }
+
+        /// Bad data is escaped by bytes, so either a good UTF-8 sequence,
+        /// or the last byte
+        static It prevStart(It beg, It p)
+        {
+            auto s = ItEnc<It, Utf8>::prevStart(beg, p);
+            return ItEnc<It, Utf8>::isValid(s, p) ? s : std::prev(p);
+        }
+    };
+
+    ///
+    /// Good data goes through UTF-8 copy at full speed, which halts on bad
+    /// data; then we escape a single byte and go on from the next one.
+    /// So every byte of bad data is escaped, even in bad sequences
+    /// that UTF-8 reports at once
+    ///
+    template <class It> template <class It2, class Enc2, class Mjh>
+    It2 ItEnc<It, Utf8Esc>::copy(It p, It end, It2 dest, [[maybe_unused]] const Mjh& onMojibake)
+    {
+        if constexpr (std::bidirectional_iterator<It>) {
+            It bad = end;
+            Event event = Event::CODE;
+            auto onBadData = [&bad, &event](It place, Event ev) {
+                bad = place;
+                event = ev;
+                return handler::RET_HALT;
+            };
+            while (p != end) {
+                bad = end;
+                dest = ItEnc<It, Utf8>::template copy<It2, Enc2, decltype(onBadData)>(
+                            p, end, dest, onBadData);
+                if (bad == end)     // data ended, or no room
+                    break;
+                if (event == Event::BYTE_NEXT) {    // back to sequence start
+                    do {
+                        --bad;
+                    } while (isU8ContinueByte(static_cast<unsigned char>(*bad)));
+                }
+                if (!ItEnc<It2, Enc2>::put(dest, ESC_BASE | unitAt(bad)))
+                    break;
+                p = std::next(bad);
+            }
+        } else {
+            while (p != end) {
+                if (!ItEnc<It2, Enc2>::put(dest, get(p, end, onMojibake)))
+                    break;
+            }
+        }
+        return dest;
+    }
+
+}   // namespace mojibake::detail
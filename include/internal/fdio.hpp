@@ -0,0 +1,101 @@
+#pragma once
+
+// POSIX file descriptors; define MJ_NO_POSIX to disable
+#if !defined(MJ_NO_POSIX) && __has_include(<unistd.h>) && __has_include(<sys/uio.h>) \
+        && __has_include(<poll.h>)
+    #define MJ_POSIX 1
+    #include <cerrno>
+    #include <new>
+    #include <poll.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+#ifdef MJ_POSIX
+
+namespace mojibake::detail {
+
+    /// Page-aligned buffer, fit for O_DIRECT too
+    class AlignedBuffer
+    {
+    public:
+        static constexpr std::align_val_t ALIGN { 4096 };
+
+        explicit AlignedBuffer(size_t aSize)
+            : fSize(aSize), fData(static_cast<char*>(::operator new(aSize, ALIGN))) {}
+        ~AlignedBuffer() { ::operator delete(fData, ALIGN); }
+        AlignedBuffer(const AlignedBuffer&) = delete;
+        AlignedBuffer& operator = (const AlignedBuffer&) = delete;
+
+        char* data() const { return fData; }
+        size_t size() const { return fSize; }
+    private:
+        size_t fSize;
+        char* fData;
+    };
+
+    /// Waits until non-blocking fd is ready
+    /// @return [+] OK [-] error in errno
+    inline bool waitFd(int fd, short events)
+    {
+        pollfd pfd { fd, events, 0 };
+        while (::poll(&pfd, 1, -1) < 0) {
+            if (errno != EINTR)
+                return false;
+        }
+        return true;
+    }
+
+    ///
+    /// Reads what is there, restarts after signals,
+    /// waits for non-blocking fd
+    /// @return  # of bytes, 0 at EOF, −1 on error in errno
+    ///
+    inline ssize_t readSome(int fd, char* p, size_t n)
+    {
+        while (true) {
+            auto r = ::read(fd, p, n);
+            if (r >= 0)
+                return r;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                if (!waitFd(fd, POLLIN))
+                    return -1;
+            } else if (errno != EINTR) {
+                return -1;
+            }
+        }
+    }
+
+    ///
+    /// Writes everything by writev, resuming after partial writes
+    /// (pipes, sockets) and signals, waits for non-blocking fd
+    /// @param [in,out] iov  scratch, contents are lost
+    /// @return [+] OK [-] error in errno
+    ///
+    inline bool writeAll(int fd, iovec* iov, int nIov)
+    {
+        while (nIov > 0) {
+            auto r = ::writev(fd, iov, nIov);
+            if (r < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    if (!waitFd(fd, POLLOUT))
+                        return false;
+                } else if (errno != EINTR) {
+                    return false;
+                }
+                continue;
+            }
+            auto n = static_cast<size_t>(r);
+            for (; nIov > 0 && n >= iov->iov_len; ++iov, --nIov)
+                n -= iov->iov_len;
+            if (nIov > 0) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+                iov->iov_len -= n;
+            }
+        }
+        return true;
+    }
+
+}   // namespace mojibake::detail
+
+#endif
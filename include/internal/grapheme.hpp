@@ -0,0 +1,178 @@
+#pragma once
+
+namespace mojibake::detail {
+
+    /// @return  grapheme cluster break of code point
+    inline Gcb gcbOf(char32_t cp)
+    {
+        // ASCII: no table lookup
+        if (cp < 0x80) {
+            if (cp >= 0x20 && cp < 0x7F)
+                return Gcb::OTHER;
+            switch (cp) {
+            case '\r': return Gcb::CR;
+            case '\n': return Gcb::LF;
+            default:   return Gcb::CONTROL;
+            }
+        }
+        if (cp >= GCB_MAXCP)
+            return Gcb::OTHER;
+        auto index = gcbLookup[cp >> GCB_BLOCKSHIFT];
+        return static_cast<Gcb>(gcbBlocks[index][cp & GCB_BLOCKMASK]);
+    }
+
+    ///
+    ///  State machine of UAX 29 extended grapheme clusters
+    ///  (rules GB3…GB13 and GB999)
+    ///
+    class GraphemeMachine
+    {
+    public:
+        GraphemeMachine(Gcb first) noexcept { advance(first); }
+
+        /// Feeds the next code point’s break class
+        /// @return [+] there’s a break before it
+        bool isBreak(Gcb next) noexcept
+        {
+            bool r = isBreakBefore(next);
+            advance(next);
+            return r;
+        }
+    private:
+        enum class Emoji : unsigned char {
+            NONE,       ///< no emoji sequence
+            PICT,       ///< ExtPict Extend*
+            PICT_ZWJ    ///< ExtPict Extend* ZWJ
+        };
+        Gcb prev = Gcb::OTHER;
+        Emoji emoji = Emoji::NONE;
+        bool isOddRi = false;   ///< odd # of regional indicators before
+
+        bool isBreakBefore(Gcb next) const noexcept
+        {
+            switch (prev) {
+            case Gcb::CR:                   // GB3, GB4
+                return (next != Gcb::LF);
+            case Gcb::LF:
+            case Gcb::CONTROL:              // GB4
+                return true;
+            default: ;
+            }
+            switch (next) {
+            case Gcb::CR:
+            case Gcb::LF:
+            case Gcb::CONTROL:              // GB5
+                return true;
+            case Gcb::EXTEND:
+            case Gcb::ZWJ:                  // GB9
+            case Gcb::SPACING_MARK:         // GB9a
+                return false;
+            default: ;
+            }
+            switch (prev) {
+            case Gcb::PREPEND:              // GB9b
+                return false;
+            case Gcb::L:                    // GB6
+                return (next != Gcb::L && next != Gcb::V
+                        && next != Gcb::LV && next != Gcb::LVT);
+            case Gcb::LV:
+            case Gcb::V:                    // GB7
+                return (next != Gcb::V && next != Gcb::T);
+            case Gcb::LVT:
+            case Gcb::T:                    // GB8
+                return (next != Gcb::T);
+            case Gcb::ZWJ:                  // GB11
+                return (next != Gcb::EXT_PICT || emoji != Emoji::PICT_ZWJ);
+            case Gcb::REG_IND:              // GB12, GB13
+                return (next != Gcb::REG_IND || !isOddRi);
+            default:                        // GB999
+                return true;
+            }
+        }
+
+        void advance(Gcb next) noexcept
+        {
+            switch (next) {
+            case Gcb::EXT_PICT:
+                emoji = Emoji::PICT; break;
+            case Gcb::EXTEND:
+                if (emoji != Emoji::PICT)
+                    emoji = Emoji::NONE;
+                break;
+            case Gcb::ZWJ:
+                emoji = (emoji == Emoji::PICT) ? Emoji::PICT_ZWJ : Emoji::NONE;
+                break;
+            default:
+                emoji = Emoji::NONE;
+            }
+            isOddRi = (next == Gcb::REG_IND) && !isOddRi;
+            prev = next;
+        }
+    };
+
+    template <class It, class Enc>
+    It nextGrapheme(It p, It end)
+    {
+        if (p == end)
+            return p;
+        // Fast path: ASCII except CR, followed by ASCII
+        // GB4/GB999 break both, and there’s nothing to look up
+        // Units should be code points: not for UTF-16/32 in bytes
+        if constexpr (isAsciiBased<Enc> && sizeof(ChType<It>) == sizeof(typename Enc::Ch)) {
+            auto unit = unitAt(p);
+            if (unit < 0x80 && unit != '\r') {
+                auto q = std::next(p);
+                if (q == end || unitAt(q) < 0x80)
+                    return q;
+            }
+        }
+        // Slow path: bad data is just a mojibake, GCB=Other
+        using Mo = handler::Moji<It>;
+        char32_t cp = ItEnc<It, Enc>::get(p, end, Mo{});
+        GraphemeMachine machine(gcbOf(cp));
+        while (p != end) {
+            auto q = p;
+            cp = ItEnc<It, Enc>::get(q, end, Mo{});
+            if (machine.isBreak(gcbOf(cp)))
+                break;
+            p = q;
+        }
+        return p;
+    }
+
+    ///
+    /// @return [+] grapheme cluster break right before code point at p,
+    ///             beg < p < end, p at code point boundary
+    /// Looks back only as far as emoji (GB11) and flag (GB12/13) rules need
+    ///
+    template <class It, class Enc>
+    bool isGraphemeBreak(It beg, It p, It end)
+    {
+        using Mo = handler::Moji<It>;
+        // @return  class of code point before q, q moves to its start
+        auto gcbBefore = [beg, end](It& q) {
+            q = ItEnc<It, Enc>::prevStart(beg, q);
+            auto q1 = q;
+            return gcbOf(ItEnc<It, Enc>::get(q1, end, Mo{}));
+        };
+        auto q = p;
+        auto next = gcbOf(ItEnc<It, Enc>::get(q, end, Mo{}));
+        q = p;
+        auto prev = gcbBefore(q);
+        if (prev == Gcb::ZWJ && next == Gcb::EXT_PICT) {     // GB11
+            auto cls = Gcb::EXTEND;
+            while (q != beg && cls == Gcb::EXTEND)
+                cls = gcbBefore(q);
+            return (cls != Gcb::EXT_PICT);
+        }
+        if (prev == Gcb::REG_IND && next == Gcb::REG_IND) {  // GB12, GB13
+            bool isOddRi = true;
+            while (q != beg && gcbBefore(q) == Gcb::REG_IND)
+                isOddRi = !isOddRi;
+            return !isOddRi;
+        }
+        GraphemeMachine machine(prev);
+        return machine.isBreak(next);
+    }
+
+}   // namespace mojibake::detail
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace mojibake::detail {
+
+    /// Odd constants of wyhash
+    constexpr uint64_t HASH_SECRET[] {
+        0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+        0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+    /// @return  high ^ low of 128-bit product, wyhash’s mixer
+    inline uint64_t hashMix(uint64_t a, uint64_t b)
+    {
+    #if defined(__SIZEOF_INT128__)
+        auto r = static_cast<unsigned __int128>(a) * b;
+        return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+    #elif defined(_MSC_VER) && defined(_M_X64)
+        uint64_t hi;
+        uint64_t lo = _umul128(a, b, &hi);
+        return lo ^ hi;
+    #else
+        uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32, bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+        uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+        uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+        uint64_t lo = (ll & 0xFFFFFFFF) | (mid << 32);
+        uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        return lo ^ hi;
+    #endif
+    }
+
+    ///
+    /// Hashes code points in blocks of 16, each code point as 32-bit word;
+    /// the hash depends on code points only, not on how they are fed
+    ///
+    class CpHasher
+    {
+    public:
+        static constexpr size_t BLOCK = 16;
+
+        void add(char32_t cp)
+        {
+            buf[nBuf++] = cp;
+            if (nBuf == BLOCK)
+                flush();
+        }
+
+        /// Adds BLOCK ASCII units at once
+        /// @return [-] some are not ASCII, or block is half-filled → add one by one
+        template <class Ch>
+        bool addAsciiBlock(const Ch* p);
+
+        uint64_t result();
+    private:
+        char32_t buf[BLOCK];
+        size_t nBuf = 0;
+        uint64_t state = HASH_SECRET[0];
+        uint64_t nCps = 0;
+
+        void flush();
+    };
+
+    inline void CpHasher::flush()
+    {
+        for (size_t i = 0; i < nBuf; i += 4) {
+            auto a = buf[i]     | static_cast<uint64_t>(buf[i + 1]) << 32;
+            auto b = buf[i + 2] | static_cast<uint64_t>(buf[i + 3]) << 32;
+            state = hashMix(a ^ HASH_SECRET[1], b ^ state);
+        }
+        nCps += nBuf;
+        nBuf = 0;
+    }
+
+    inline uint64_t CpHasher::result()
+    {
+        if (nBuf != 0) {
+            std::fill(buf + nBuf, buf + (nBuf + 3) / 4 * 4, 0);
+            flush();
+        }
+        return hashMix(state ^ HASH_SECRET[2], nCps ^ HASH_SECRET[3]);
+    }
+
+    template <class Ch>
+    inline bool CpHasher::addAsciiBlock([[maybe_unused]] const Ch* p)
+    {
+    #ifdef MJ_SSE2
+        if (nBuf != 0)
+            return false;
+        constexpr size_t NVEC = BLOCK / SIMD_UNITS<Ch>;
+        __m128i v[NVEC];
+        unsigned bad = 0;
+        for (size_t i = 0; i < NVEC; ++i) {
+            v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + i);
+            bad |= nonAsciiMask<Ch>(v[i]);
+        }
+        if (bad != 0)
+            return false;
+        // Zero-extend units to 32 bits
+        auto out = reinterpret_cast<__m128i*>(buf);
+        const auto zero = _mm_setzero_si128();
+        for (size_t i = 0; i < NVEC; ++i) {
+            if constexpr (sizeof(Ch) == 1) {
+                auto lo = _mm_unpacklo_epi8(v[i], zero), hi = _mm_unpackhi_epi8(v[i], zero);
+                _mm_storeu_si128(out++, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(out++, _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(out++, _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(out++, _mm_unpackhi_epi16(hi, zero));
+            } else if constexpr (sizeof(Ch) == 2) {
+                _mm_storeu_si128(out++, _mm_unpacklo_epi16(v[i], zero));
+                _mm_storeu_si128(out++, _mm_unpackhi_epi16(v[i], zero));
+            } else {
+                _mm_storeu_si128(out++, v[i]);
+            }
+        }
+        nBuf = BLOCK;
+        flush();
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    template <class It, class Enc, class Mjh>
+    uint64_t hashCps(It p, It end, const Mjh& onMojibake)
+    {
+        CpHasher hasher;
+        while (p != end) {
+            if constexpr (hasAsciiFastPath<It, Enc>) {
+                if (end - p >= static_cast<ptrdiff_t>(CpHasher::BLOCK)
+                        && hasher.addAsciiBlock(std::to_address(p))) {
+                    p += CpHasher::BLOCK;
+                    continue;
+                }
+            }
+            auto cp = ItEnc<It, Enc>::get(p, end, onMojibake);
+            auto code = cp & handler::MASK_CODE;
+            if (code != handler::RET_SKIP)
+                hasher.add(code);
+            if (cp & handler::FG_HALT)
+                break;
+        }
+        return hasher.result();
+    }
+
+}   // namespace mojibake::detail
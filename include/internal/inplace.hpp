@@ -0,0 +1,120 @@
+#pragma once
+
+#include <vector>
+
+namespace mojibake::detail {
+
+    /// @return  # of bytes that code point takes in Enc
+    template <class Enc>
+    constexpr size_t cpBytes(char32_t cp)
+    {
+        if constexpr (std::is_same_v<Enc, Utf8>) {
+            return (cp <= U8_1BYTE_MAX) ? 1 : (cp <= U8_2BYTE_MAX) ? 2
+                 : (cp <= U8_3BYTE_MAX) ? 3 : 4;
+        } else if constexpr (std::is_same_v<Enc, Utf8Esc>) {
+            return isEscapedByte(cp) ? 1 : cpBytes<Utf8>(cp);
+        } else if constexpr (isCesu<Enc>) {
+            if (std::is_same_v<Enc, Mutf8> && cp == 0)
+                return 2;
+            return (cp < U16_2WORD_MIN) ? cpBytes<Utf8>(cp) : 6;
+        } else if constexpr (std::is_same_v<Enc, Utf16>
+                || std::is_same_v<Enc, Utf16Bytes<std::endian::little>>
+                || std::is_same_v<Enc, Utf16Bytes<std::endian::big>>) {
+            return (cp < U16_2WORD_MIN) ? 2 : 4;
+        } else if constexpr (isCodePage<Enc>) {
+            return 1;
+        } else {
+            return 4;
+        }
+    }
+
+    /// Max # of bytes per code point in Enc
+    template <class Enc>
+    constexpr size_t MAX_CP_BYTES = cpBytes<Enc>(UNICODE_MAX);
+
+    struct InPlacePlan {
+        size_t nBytes;      ///< length of result, bytes
+        bool isSafe;        ///< [+] writing never outruns reading
+    };
+
+    ///
+    /// Length pre-pass of in-place transcoding
+    /// What onMojibake returns is unknown, so bad data is counted
+    /// as longest code point
+    ///
+    template <class Enc1, class Enc2, class Ch1>
+    InPlacePlan planInPlace(const Ch1* beg, const Ch1* end)
+    {
+        using It1 = const Ch1*;
+        InPlacePlan r { 0, true };
+        bool isMojibake = false;
+        auto onBadData = [&isMojibake](It1, Event) {
+            isMojibake = true;
+            return char32_t{0};
+        };
+        auto p = beg;
+        while (p != end) {
+            if constexpr (hasAsciiFastPath<It1, Enc1>) {
+                if (unitAt(p) < 0x80) {
+                    auto q = findNonAscii(p, end);
+                    r.nBytes += (q - p) * cpBytes<Enc2>('A');
+                    // Modified UTF-8 writes NUL in two bytes
+                    if constexpr (cpBytes<Enc2>(0) != cpBytes<Enc2>('A'))
+                        r.nBytes += std::count(p, q, Ch1{0}) * (cpBytes<Enc2>(0) - cpBytes<Enc2>('A'));
+                    p = q;
+                    r.isSafe &= (r.nBytes <= (p - beg) * sizeof(Ch1));
+                    continue;
+                }
+            }
+            isMojibake = false;
+            auto cp = ItEnc<It1, Enc1>::get(p, end, onBadData);
+            r.nBytes += isMojibake ? MAX_CP_BYTES<Enc2> : cpBytes<Enc2>(cp);
+            r.isSafe &= (r.nBytes <= (p - beg) * sizeof(Ch1));
+        }
+        return r;
+    }
+
+    ///
+    /// How we write Enc2 over buffer of Ch1:
+    /// units of the same size and bytes are written as they are,
+    /// other units bytewise in native order, not to break aliasing rules
+    ///
+    template <class Ch1, class Enc2>
+    struct InPlaceTarget {
+        using Ch2 = typename Enc2::Ch;
+        static constexpr bool isSameSize = (sizeof(Ch2) == sizeof(Ch1));
+        using It = std::conditional_t<isSameSize, Ch1*, char*>;
+        using Enc = std::conditional_t<isSameSize || sizeof(Ch2) == 1, Enc2,
+                    std::conditional_t<sizeof(Ch2) == 2,
+                            Utf16Bytes<std::endian::native>, Utf32Bytes<std::endian::native>>>;
+    };
+
+    template <class Enc1, class Enc2, class Ch1, class Mjh>
+    size_t transcodeInPlace(Ch1* data, size_t length, const Mjh& onMojibake)
+    {
+        using It1 = const Ch1*;
+        using Target = InPlaceTarget<Ch1, Enc2>;
+        using It2 = typename Target::It;
+        using EncW = typename Target::Enc;
+        auto plan = planInPlace<Enc1, Enc2, Ch1>(data, data + length);
+        if (plan.nBytes > length * sizeof(Ch1))
+            return INPLACE_NO_ROOM;
+        auto dest = reinterpret_cast<It2>(data);
+        It2 destEnd;
+        if (plan.isSafe) {
+            destEnd = detail::copy<It1, It2, Enc1, EncW, Mjh>(data, data + length, dest, onMojibake);
+        } else {
+            // Fits, but some code point gets longer and overwrites source
+            // that is not read yet → copy source away
+            std::vector<Ch1> source(length);
+            std::copy(data, data + length, source.data());
+            auto onBadData = [data, &source, &onMojibake](It1 place, Event event) {
+                return onMojibake(data + (place - source.data()), event);
+            };
+            destEnd = detail::copy<It1, It2, Enc1, EncW, decltype(onBadData)>(
+                        source.data(), source.data() + length, dest, onBadData);
+        }
+        return (destEnd - dest) * sizeof(*dest) / sizeof(typename Enc2::Ch);
+    }
+
+}   // namespace mojibake::detail
@@ -0,0 +1,200 @@
+#pragma once
+
+namespace mojibake::detail {
+
+    /// Latin-1 byte is code point U+0000…00FF by itself
+    constexpr char32_t LATIN1_MAX = 0xFF;
+
+#ifdef MJ_SSE2
+    ///
+    /// @return  bit mask, 1 bit per byte, of units > FF
+    ///          (a unit sets all of its bits)
+    ///
+    template <class Ch>
+    inline unsigned nonLatin1Mask(__m128i v)
+    {
+        static_assert(sizeof(Ch) == 2 || sizeof(Ch) == 4);
+        auto isLatin1 = (sizeof(Ch) == 2)
+                ? _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF00))),
+                                  _mm_setzero_si128())
+                : _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(static_cast<int>(0xFFFFFF00))),
+                                  _mm_setzero_si128());
+        return ~_mm_movemask_epi8(isLatin1) & 0xFFFF;
+    }
+
+    /// Packs 16 units ≤ FF to bytes
+    template <class Ch>
+    inline __m128i packLatin1(const Ch* p)
+    {
+        auto load = [p](size_t i) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        };
+        if constexpr (sizeof(Ch) == 2) {
+            return _mm_packus_epi16(load(0), load(8));
+        } else {    // SSE2 has no unsigned pack of dwords, but units are small
+            return _mm_packus_epi16(_mm_packs_epi32(load(0), load(4)),
+                                    _mm_packs_epi32(load(8), load(12)));
+        }
+    }
+#endif
+
+    ///
+    /// Skips units ≤ FF, for UTF-16/32 they are code points
+    /// @return  1st unit > FF in [p, end), or end
+    ///
+    template <class Ch>
+    const Ch* findNonLatin1(const Ch* p, const Ch* end)
+    {
+        static_assert(sizeof(Ch) == 2 || sizeof(Ch) == 4);
+    #ifdef MJ_SSE2
+        constexpr auto N = SIMD_UNITS<Ch>;
+        for (; end - p >= static_cast<ptrdiff_t>(N); p += N) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            auto bad = nonLatin1Mask<Ch>(v);
+            if (bad != 0)
+                return p + std::countr_zero(bad) / sizeof(Ch);
+        }
+    #endif
+        for (; p != end; ++p) {
+            if (static_cast<UnsignedCh<Ch>>(*p) > LATIN1_MAX)
+                break;
+        }
+        return p;
+    }
+
+    ///
+    /// @return [+] every code point is U+0000…00FF;
+    ///         bad data does not fit
+    ///
+    template <class It, class Enc>
+    bool fitsLatin1(It p, It end)
+    {
+        if constexpr (hasAsciiFastPath<It, Enc> && sizeof(typename Enc::Ch) > 1) {
+            // UTF-16/32: units > FF are surrogates or non-Latin-1
+            auto q = std::to_address(p);
+            return findNonLatin1(q, q + (end - p)) == q + (end - p);
+        } else {
+            auto onBadData = [](It, Event) { return handler::RET_HALT; };
+            while (p != end) {
+                if constexpr (hasAsciiFastPath<It, Enc>) {
+                    auto q = std::to_address(p);
+                    p += findNonAscii(q, q + (end - p)) - q;
+                    if (p == end)
+                        break;
+                }
+                if (ItEnc<It, Enc>::get(p, end, onBadData) > LATIN1_MAX)
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    ///
+    /// Widens Latin-1: contiguous data to UTF-16/32 goes by SIMD zero-extension,
+    /// other w/o code page tables
+    ///
+    template <class It, class It2, class Enc2>
+    It2 copyFromLatin1(It p, It end, It2 dest)
+    {
+    #ifdef MJ_SSE2
+        if constexpr (std::contiguous_iterator<It> && !IteratorLimit<It2>::isLimited
+                && (std::is_same_v<Enc2, Utf16> || std::is_same_v<Enc2, Utf32>)) {
+            using Ch2 = typename Enc2::Ch;
+            constexpr ptrdiff_t BLOCK = 16;
+            const auto zero = _mm_setzero_si128();
+            while (end - p >= BLOCK) {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(std::to_address(p)));
+                Ch2 buf[BLOCK];
+                auto store = [&buf](size_t i, __m128i x) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(buf + i), x);
+                };
+                auto lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+                if constexpr (sizeof(Ch2) == 2) {
+                    store(0, lo);
+                    store(8, hi);
+                } else {
+                    store(0, _mm_unpacklo_epi16(lo, zero));
+                    store(4, _mm_unpackhi_epi16(lo, zero));
+                    store(8, _mm_unpacklo_epi16(hi, zero));
+                    store(12, _mm_unpackhi_epi16(hi, zero));
+                }
+                dest = std::copy(buf, buf + BLOCK, dest);
+                p += BLOCK;
+            }
+        }
+    #endif
+        for (; p != end; ++p) {
+            if (!ItEnc<It2, Enc2>::put(dest, unitAt(p)))
+                break;
+        }
+        return dest;
+    }
+
+    ///
+    /// Narrows to Latin-1: contiguous UTF-16/32 goes by SIMD packing,
+    /// contiguous ASCII-based bytes skip ASCII;
+    /// every code point > FF goes to onMojibake as Event::CODE
+    ///
+    template <class It1, class It2, class Enc1, class Enc2, class Mjh>
+    It2 copyToLatin1(It1 p, It1 end, It2 dest, const Mjh& onMojibake)
+    {
+        bool isMojibake = false;
+        auto onBadData = [&isMojibake, &onMojibake](It1 place, Event event) {
+            isMojibake = true;
+            return onMojibake(place, event);
+        };
+        // @return [+] halt
+        auto copyCp = [&]() {
+            auto cpStart = p;
+            isMojibake = false;
+            auto c = ItEnc<It1, Enc1>::get(p, end, onBadData);
+            bool halt = c & handler::FG_HALT;
+            c &= handler::MASK_CODE;
+            if (c != handler::RET_SKIP) {
+                // What handler returned is not checked again
+                if (isMojibake || c <= LATIN1_MAX) [[likely]] {
+                    halt |= !ItEnc<It2, Enc2>::put(dest, c);
+                } else {
+                    halt |= handleMojibake<Enc2>(cpStart, Event::CODE, dest, onMojibake);
+                }
+            }
+            return halt;
+        };
+    #ifdef MJ_SSE2
+        if constexpr (hasAsciiFastPath<It1, Enc1> && !IteratorLimit<It2>::isLimited) {
+            using Ch = ChType<It1>;
+            constexpr ptrdiff_t BLOCK = 16;
+            while (end - p >= BLOCK) {
+                auto q = std::to_address(p);
+                auto v = _mm_setzero_si128();
+                bool isFast;
+                if constexpr (sizeof(Ch) == 1) {
+                    v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+                    isFast = (nonAsciiMask<Ch>(v) == 0);
+                } else {
+                    isFast = (findNonLatin1(q, q + BLOCK) == q + BLOCK);
+                    if (isFast)
+                        v = packLatin1(q);
+                }
+                if (!isFast) {
+                    for (auto blockEnd = p + BLOCK; p < blockEnd; ) {
+                        if (copyCp())
+                            return dest;
+                    }
+                    continue;
+                }
+                char buf[BLOCK];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(buf), v);
+                dest = std::copy(buf, buf + BLOCK, dest);
+                p += BLOCK;
+            }
+        }
+    #endif
+        while (p != end) {
+            if (copyCp())
+                break;
+        }
+        return dest;
+    }
+
+}   // namespace mojibake::detail
@@ -0,0 +1,62 @@
+#pragma once
+
+namespace mojibake::detail {
+
+    /// Max # of units per code point: 6 bytes in CESU-8
+    template <class Enc>
+    constexpr size_t MAX_CP_UNITS = MAX_CP_BYTES<Enc> / sizeof(typename Enc::Ch);
+
+    /// Bulk mode of copyLimited needs room for that many source units
+    constexpr size_t LIMITED_BLOCK = 64;
+
+    ///
+    /// Copies data to limited iterator
+    /// Bulk mode: while destination surely has room for a block of source,
+    /// copies it w/o checking remainder; the rest is checked per code point
+    ///
+    template <class It1, class ItL, class Enc1, class Enc2, class Mjh>
+    ItL copyLimited(It1 p, It1 end, ItL dest, const Mjh& onMojibake)
+    {
+        using It2 = decltype(dest.curr);
+        if constexpr (std::random_access_iterator<It1> && std::random_access_iterator<It2>
+                && requires { ItEnc<It1, Enc1>::startOf(p, p); }) {
+            bool isHalted = false;
+            auto onBadData = [&isHalted, &onMojibake](It1 place, Event event) {
+                char32_t r = onMojibake(place, event);
+                isHalted |= ((r & handler::FG_HALT) != 0);
+                return r;
+            };
+            while (p != end) {
+                auto room = dest.end - dest.curr;
+                if (room < static_cast<ptrdiff_t>(LIMITED_BLOCK * MAX_CP_UNITS<Enc2>))
+                    break;
+                size_t nUnits = static_cast<size_t>(room) / MAX_CP_UNITS<Enc2>;
+                auto q = end;
+                if (nUnits < static_cast<size_t>(end - p)) {
+                    q = ItEnc<It1, Enc1>::startOf(p, p + nUnits);
+                    // Bad data at the end of block may look at the next unit
+                    while (q != p) {
+                        auto s = ItEnc<It1, Enc1>::prevStart(p, q);
+                        if (ItEnc<It1, Enc1>::isValid(s, q))
+                            break;
+                        q = s;
+                    }
+                    if (q == p)
+                        break;
+                }
+                if constexpr (std::is_same_v<Mjh, handler::Skip<It1>>
+                        || std::is_same_v<Mjh, handler::Moji<It1>>) {   // never halt
+                    dest.curr = detail::copy<It1, It2, Enc1, Enc2, Mjh>(p, q, dest.curr, onMojibake);
+                } else {
+                    dest.curr = detail::copy<It1, It2, Enc1, Enc2, decltype(onBadData)>(
+                                p, q, dest.curr, onBadData);
+                    if (isHalted)
+                        return dest;
+                }
+                p = q;
+            }
+        }
+        return detail::copy<It1, ItL, Enc1, Enc2, Mjh>(p, end, dest, onMojibake);
+    }
+
+}   // namespace mojibake::detail
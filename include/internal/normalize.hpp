@@ -0,0 +1,339 @@
+#pragma once
+
+#include <string>   // won’t be included actually
+
+namespace mojibake::detail {
+
+    constexpr char32_t HANGUL_S_FIRST = 0xAC00;
+    constexpr char32_t HANGUL_L_FIRST = 0x1100;
+    constexpr char32_t HANGUL_V_FIRST = 0x1161;
+    constexpr char32_t HANGUL_T_BASE = 0x11A7;  ///< T_FIRST − 1, as T is optional
+    constexpr unsigned HANGUL_L_COUNT = 19;
+    constexpr unsigned HANGUL_V_COUNT = 21;
+    constexpr unsigned HANGUL_T_COUNT = 28;
+    constexpr unsigned HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+    constexpr unsigned HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+    inline unsigned cccOf(char32_t cp)
+    {
+        if (cp >= CCC_MAXCP)
+            return 0;
+        auto index = cccLookup[cp >> CCC_BLOCKSHIFT];
+        return cccBlocks[index][cp & CCC_BLOCKMASK];
+    }
+
+    inline unsigned normFlagsOf(char32_t cp)
+    {
+        if (cp >= NORMFLAGS_MAXCP)
+            return 0;
+        auto index = normFlagsLookup[cp >> NORMFLAGS_BLOCKSHIFT];
+        return normFlagsBlocks[index][cp & NORMFLAGS_BLOCKMASK];
+    }
+
+    constexpr bool isCompat(Nf nf) { return nf == Nf::NFKC || nf == Nf::NFKD; }
+    constexpr bool isComposed(Nf nf) { return nf == Nf::NFC || nf == Nf::NFKC; }
+
+    template <Nf nf>
+    constexpr unsigned char NF_QC_NO =
+            (nf == Nf::NFC) ? NF_C_NO : (nf == Nf::NFKC) ? NF_KC_NO
+          : (nf == Nf::NFD) ? NF_D_NO : NF_KD_NO;
+
+    template <Nf nf>
+    constexpr unsigned char NF_QC_MAYBE =
+            (nf == Nf::NFC) ? NF_C_MAYBE : (nf == Nf::NFKC) ? NF_KC_MAYBE : 0;
+
+    /// Code points below are quick-check YES and starters:
+    /// 300 = combining grave, C0 = À, A0 = no-break space
+    template <Nf nf>
+    constexpr char32_t NF_QC_MIN =
+            (nf == Nf::NFC) ? 0x300 : (nf == Nf::NFD) ? 0xC0 : 0xA0;
+
+    ///
+    /// @return  full decomposition from normPool: length, then code points;
+    ///          nullptr if none (Hangul syllables are not here too)
+    ///
+    template <Nf nf>
+    inline const char32_t* decompositionOf(char32_t cp)
+    {
+        if (cp >= DECOMP_MAXCP)
+            return nullptr;
+        unsigned pos;
+        if constexpr (isCompat(nf)) {
+            auto index = compatDecompLookup[cp >> DECOMP_BLOCKSHIFT];
+            pos = compatDecompBlocks[index][cp & DECOMP_BLOCKMASK];
+        } else {
+            auto index = canonDecompLookup[cp >> DECOMP_BLOCKSHIFT];
+            pos = canonDecompBlocks[index][cp & DECOMP_BLOCKMASK];
+        }
+        return (pos == 0) ? nullptr : normPool + pos;
+    }
+
+    /// @return  primary composite of two code points, or 0
+    inline char32_t composePair(char32_t first, char32_t second)
+    {
+        // Hangul L+V, LV+T
+        if (first - HANGUL_L_FIRST < HANGUL_L_COUNT) {
+            if (second - HANGUL_V_FIRST < HANGUL_V_COUNT)
+                return HANGUL_S_FIRST + ((first - HANGUL_L_FIRST) * HANGUL_V_COUNT
+                                      + (second - HANGUL_V_FIRST)) * HANGUL_T_COUNT;
+            return 0;
+        }
+        if (first - HANGUL_S_FIRST < HANGUL_S_COUNT) {
+            if ((first - HANGUL_S_FIRST) % HANGUL_T_COUNT == 0
+                    && second - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1)
+                return first + (second - HANGUL_T_BASE);
+            return 0;
+        }
+        auto it = std::lower_bound(std::begin(normComposites), std::end(normComposites),
+                        Composite { first, second, 0 },
+                        [](const Composite& x, const Composite& y) {
+                            return (x.first != y.first) ? (x.first < y.first)
+                                                        : (x.second < y.second);
+                        });
+        if (it == std::end(normComposites) || it->first != first || it->second != second)
+            return 0;
+        return it->composite;
+    }
+
+    ///
+    /// UAX 15 quick check
+    /// Bad data → NO, as normalization will alter it anyway
+    ///
+    template <Nf nf, class It, class Enc>
+    Qc quickCheck(It p, It end)
+    {
+        using Mh = handler::MojiHalt<It>;
+        unsigned lastCcc = 0;
+        Qc r = Qc::YES;
+        while (p != end) {
+            if constexpr (hasAsciiFastPath<It, Enc>) {
+                if (unitAt(p) < 0x80) {
+                    auto beg = std::to_address(p);
+                    auto q = findNonAscii(beg, beg + (end - p));
+                    p += q - beg;
+                    lastCcc = 0;
+                    continue;
+                }
+            }
+            char32_t cp = ItEnc<It, Enc>::get(p, end, Mh{});
+            if (cp < NF_QC_MIN<nf>) {
+                lastCcc = 0;
+                continue;
+            }
+            if (cp & handler::FG_HALT)
+                return Qc::NO;
+            auto ccc = cccOf(cp);
+            if (ccc != 0 && lastCcc > ccc)
+                return Qc::NO;
+            auto flags = normFlagsOf(cp);
+            if (flags & NF_QC_NO<nf>)
+                return Qc::NO;
+            if (flags & NF_QC_MAYBE<nf>)
+                r = Qc::MAYBE;
+            lastCcc = ccc;
+        }
+        return r;
+    }
+
+    ///
+    ///  Normalizes code points one by one, flushing them to some iterator
+    ///  when it’s sure that nothing will combine with them
+    ///
+    template <Nf nf>
+    class Normalizer
+    {
+    public:
+        /// Normalized segments go to put(std::u32string_view)
+        /// @return [+] OK [-] put failed: no room in dest, or halt
+        template <class Put>
+        bool add(char32_t cp, const Put& put);
+
+        /// @return [+] OK [-] put failed
+        template <class Put>
+        bool flush(const Put& put);
+
+        bool isEmpty() const noexcept { return buf.empty(); }
+    private:
+        std::u32string buf;
+
+        /// @return [+] no code point before can combine with cp
+        static bool isStable(char32_t cp)
+        {
+            return cccOf(cp) == 0 && !(normFlagsOf(cp) & NF_QC_MAYBE<nf>);
+        }
+
+        template <class Put>
+        bool addDecomposed(char32_t cp, const Put& put)
+        {
+            if (!buf.empty() && isStable(cp)) {
+                if (!flush(put))
+                    return false;
+            }
+            buf.push_back(cp);
+            return true;
+        }
+
+        void reorder();
+        void compose();
+    };
+
+    template <Nf nf> template <class Put>
+    bool Normalizer<nf>::add(char32_t cp, const Put& put)
+    {
+        if (cp - HANGUL_S_FIRST < HANGUL_S_COUNT) {
+            auto index = cp - HANGUL_S_FIRST;
+            if (!addDecomposed(HANGUL_L_FIRST + index / HANGUL_N_COUNT, put))
+                return false;
+            buf.push_back(HANGUL_V_FIRST + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+            if (index % HANGUL_T_COUNT != 0)
+                buf.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+            return true;
+        }
+        auto decomp = decompositionOf<nf>(cp);
+        if (!decomp)
+            return addDecomposed(cp, put);
+        auto len = *decomp;
+        for (++decomp; len != 0; --len, ++decomp) {
+            if (!addDecomposed(*decomp, put))
+                return false;
+        }
+        return true;
+    }
+
+    template <Nf nf> template <class Put>
+    bool Normalizer<nf>::flush(const Put& put)
+    {
+        reorder();
+        if constexpr (isComposed(nf))
+            compose();
+        if (!put(std::u32string_view(buf)))
+            return false;
+        buf.clear();
+        return true;
+    }
+
+    /// Canonical ordering: stable sort of non-starters by CCC
+    template <Nf nf>
+    void Normalizer<nf>::reorder()
+    {
+        for (size_t i = 1; i < buf.size(); ++i) {
+            auto ccc = cccOf(buf[i]);
+            if (ccc == 0)
+                continue;
+            for (size_t j = i; j > 0 && cccOf(buf[j - 1]) > ccc; --j)
+                std::swap(buf[j - 1], buf[j]);
+        }
+    }
+
+    /// Canonical composition of reordered buffer
+    template <Nf nf>
+    void Normalizer<nf>::compose()
+    {
+        if (buf.empty())
+            return;
+        size_t starterPos = 0;
+        unsigned lastCcc = cccOf(buf[0]);
+        if (lastCcc != 0)
+            lastCcc = 256;    // no starter → block everything
+        size_t outPos = 1;
+        for (size_t i = 1; i < buf.size(); ++i) {
+            auto c = buf[i];
+            auto ccc = cccOf(c);
+            if (lastCcc < ccc || lastCcc == 0) {
+                if (auto composite = composePair(buf[starterPos], c)) {
+                    buf[starterPos] = composite;
+                    continue;
+                }
+            }
+            if (ccc == 0)
+                starterPos = outPos;
+            lastCcc = ccc;
+            buf[outPos++] = c;
+        }
+        buf.resize(outPos);
+    }
+
+    ///
+    /// Normalizes data to code page: every code point not in code page
+    /// goes to onMojibake as Event::CODE, place is start of its segment
+    ///
+    template <Nf nf, class It1, class It2, class Enc1, class Enc2, class Mjh>
+    It2 normalizeToCodePage(It1 p, It1 end, It2 dest, const Mjh& onMojibake)
+    {
+        Normalizer<nf> normalizer;
+        auto cpStart = p, segStart = p;
+        auto put = [&cpStart, &segStart, &dest, &onMojibake](std::u32string_view segment) {
+            for (auto c : segment) {
+                if (cpEncode<Enc2::id>(c) != 0 || c == 0) [[likely]] {
+                    if (!ItEnc<It2, Enc2>::put(dest, c))
+                        return false;
+                } else if (handleMojibake<Enc2>(segStart, Event::CODE, dest, onMojibake)) {
+                    return false;
+                }
+            }
+            // What remains in buffer came from current code point
+            segStart = cpStart;
+            return true;
+        };
+        bool isMojibake = false;
+        auto onBadData = [&isMojibake, &onMojibake](It1 place, Event event) {
+            isMojibake = true;
+            return onMojibake(place, event);
+        };
+        while (p != end) {
+            cpStart = p;
+            isMojibake = false;
+            auto c = ItEnc<It1, Enc1>::get(p, end, onBadData);
+            bool halt = c & handler::FG_HALT;
+            c &= handler::MASK_CODE;
+            if (c != handler::RET_SKIP) {
+                if (isMojibake) {
+                    // What handler returned is neither checked again nor normalized
+                    if (!normalizer.flush(put) || !ItEnc<It2, Enc2>::put(dest, c))
+                        return dest;
+                } else {
+                    if (normalizer.isEmpty())
+                        segStart = cpStart;
+                    if (!normalizer.add(c, put))
+                        return dest;
+                }
+            }
+            if (halt)
+                break;
+        }
+        normalizer.flush(put);
+        return dest;
+    }
+
+    /// Code pages need one more check on writing, as copy does
+    template <Nf nf, class It1, class It2, class Enc1, class Enc2, class Mjh>
+    It2 normalize(It1 p, It1 end, It2 dest, const Mjh& onMojibake)
+    {
+        if constexpr (isCodePage<Enc2>) {
+            return normalizeToCodePage<nf, It1, It2, Enc1, Enc2, Mjh>(p, end, dest, onMojibake);
+        } else {
+            Normalizer<nf> normalizer;
+            auto put = [&dest](std::u32string_view segment) {
+                for (auto c : segment) {
+                    if (!ItEnc<It2, Enc2>::put(dest, c))
+                        return false;
+                }
+                return true;
+            };
+            while (p != end) {
+                auto r = ItEnc<It1, Enc1>::get(p, end, onMojibake);
+                bool halt = r & handler::FG_HALT;
+                r &= handler::MASK_CODE;
+                if (r != handler::RET_SKIP) {
+                    if (!normalizer.add(r, put))
+                        return dest;
+                }
+                if (halt)
+                    break;
+            }
+            normalizer.flush(put);
+            return dest;
+        }
+    }
+
+}   // namespace mojibake::detail
@@ -0,0 +1,277 @@
+#pragma once
+
+// Profiling of call sites; define MJ_PROFILE to enable.
+// Otherwise public functions get no extra parameter, and nothing is measured
+#ifdef MJ_PROFILE
+    #include <chrono>
+    #include <cstdint>
+    #include <cstdio>
+    #include <cstring>
+    #include <functional>
+    #include <mutex>
+    #include <source_location>
+    #include <unordered_map>
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        #include <intrin.h>
+        #define MJ_RDTSC 1
+    #elif defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+        #define MJ_RDTSC 1
+    #endif
+    /// Call site, last parameter of public function
+    #define MJ_LOC_PARAM , std::source_location mjLoc = std::source_location::current()
+    /// Passes call site to another public function
+    #define MJ_LOC_ARG , mjLoc
+#else
+    #define MJ_LOC_PARAM
+    #define MJ_LOC_ARG
+#endif
+
+#ifdef MJ_PROFILE
+
+namespace mojibake::profile {
+
+    struct Site {
+        const char* file;
+        const char* function;
+        uint_least32_t line, column;
+        const char* op;     ///< copy, to, isValid, countCps, simpleCaseFold
+    };
+
+    ///
+    /// Totals of call site
+    /// Bytes/code points are of input, and unknown (0) for input iterators;
+    /// output bytes are unknown for output iterators like back_inserter
+    ///
+    struct Stats {
+        uint64_t nCalls = 0;
+        uint64_t bytesIn = 0;
+        uint64_t bytesOut = 0;
+        uint64_t nCps = 0;          ///< valid code points, as countCps
+        uint64_t nMojibake = 0;     ///< calls of mojibake handler
+        uint64_t ticks = 0;         ///< CPU cycles by TSC on x86, steady clock’s ticks otherwise
+
+        Stats& operator += (const Stats& x);
+    };
+
+    struct Entry {
+        Site site;
+        Stats stats;
+    };
+
+    using Sink = std::function<void(const std::vector<Entry>&)>;
+
+    inline Stats& Stats::operator += (const Stats& x)
+    {
+        nCalls += x.nCalls;
+        bytesIn += x.bytesIn;
+        bytesOut += x.bytesOut;
+        nCps += x.nCps;
+        nMojibake += x.nMojibake;
+        ticks += x.ticks;
+        return *this;
+    }
+
+}   // namespace mojibake::profile
+
+namespace mojibake::detail {
+
+    inline uint64_t profileTicks()
+    {
+    #ifdef MJ_RDTSC
+        return __rdtsc();
+    #else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    #endif
+    }
+
+    /// Depth of profiled calls in this thread: only the outer one is recorded,
+    /// so to → copy is a single “to”
+    inline thread_local unsigned profileDepth = 0;
+
+    ///
+    /// Stats of all call sites, shared by threads
+    ///
+    class ProfileRegistry
+    {
+    public:
+        void add(const std::source_location& loc, const char* op, const profile::Stats& x);
+        std::vector<profile::Entry> snapshot();
+        void reset();
+        void setSink(profile::Sink aSink, std::chrono::steady_clock::duration aPeriod);
+    private:
+        struct Key {
+            const char* file;
+            uint_least32_t line, column;
+            const char* op;
+
+            // Same header in different TUs may have different file strings
+            bool operator == (const Key& x) const
+            {
+                return line == x.line && column == x.column
+                    && std::strcmp(op, x.op) == 0 && std::strcmp(file, x.file) == 0;
+            }
+        };
+        struct KeyHash {
+            size_t operator () (const Key& x) const noexcept
+                { return (size_t{x.line} << 10) ^ x.column; }
+        };
+
+        std::mutex mutex;
+        std::unordered_map<Key, profile::Entry, KeyHash> sites;
+        profile::Sink sink;
+        std::chrono::steady_clock::duration period {};
+        std::chrono::steady_clock::time_point lastDump {};
+
+        std::vector<profile::Entry> snapshotLocked() const;
+    };
+
+    inline ProfileRegistry& profileRegistry()
+    {
+        static ProfileRegistry r;
+        return r;
+    }
+
+    inline void ProfileRegistry::add(
+            const std::source_location& loc, const char* op, const profile::Stats& x)
+    {
+        profile::Sink sinkNow;
+        std::vector<profile::Entry> entries;
+        {
+            std::lock_guard lock(mutex);
+            auto& entry = sites[Key { loc.file_name(), loc.line(), loc.column(), op }];
+            if (entry.stats.nCalls == 0)
+                entry.site = { loc.file_name(), loc.function_name(), loc.line(), loc.column(), op };
+            entry.stats += x;
+            if (sink) {
+                auto now = std::chrono::steady_clock::now();
+                if (now - lastDump >= period) {
+                    lastDump = now;
+                    sinkNow = sink;
+                    entries = snapshotLocked();
+                }
+            }
+        }
+        if (sinkNow) {
+            // Conversions inside sink are not recorded
+            ++profileDepth;
+            sinkNow(entries);
+            --profileDepth;
+        }
+    }
+
+    /// Sorted by ticks, most costly first
+    inline std::vector<profile::Entry> ProfileRegistry::snapshotLocked() const
+    {
+        std::vector<profile::Entry> r;
+        r.reserve(sites.size());
+        for (auto& [key, entry] : sites)
+            r.push_back(entry);
+        std::sort(r.begin(), r.end(),
+                  [](const profile::Entry& a, const profile::Entry& b)
+                        { return a.stats.ticks > b.stats.ticks; });
+        return r;
+    }
+
+    inline std::vector<profile::Entry> ProfileRegistry::snapshot()
+    {
+        std::lock_guard lock(mutex);
+        return snapshotLocked();
+    }
+
+    inline void ProfileRegistry::reset()
+    {
+        std::lock_guard lock(mutex);
+        sites.clear();
+    }
+
+    inline void ProfileRegistry::setSink(
+            profile::Sink aSink, std::chrono::steady_clock::duration aPeriod)
+    {
+        std::lock_guard lock(mutex);
+        sink = std::move(aSink);
+        period = aPeriod;
+        lastDump = std::chrono::steady_clock::now();
+    }
+
+    ///
+    /// Measures a call of public function, and records it
+    /// to call site unless nested into another one
+    ///
+    class ProfileScope
+    {
+    public:
+        ProfileScope(const char* aOp, const std::source_location& aLoc)
+            : op(aOp), loc(aLoc), isOuter(profileDepth++ == 0), start(profileTicks()) {}
+        ~ProfileScope();
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator = (const ProfileScope&) = delete;
+
+        /// Stops the clock, counting that goes next is not measured
+        void stop() { stats.ticks = profileTicks() - start;  isStopped = true; }
+
+        /// @return  handler that counts bad data, then calls onMojibake
+        template <class Mjh>
+        auto counting(const Mjh& onMojibake)
+        {
+            return [this, &onMojibake](auto place, Event event) {
+                ++stats.nMojibake;
+                return onMojibake(place, event);
+            };
+        }
+
+        /// Counts input bytes, if input is multi-pass
+        template <class It>
+        void countBytesIn([[maybe_unused]] It beg, [[maybe_unused]] It end)
+        {
+            if constexpr (std::forward_iterator<It>)
+                stats.bytesIn = std::distance(beg, end) * sizeof(std::iter_value_t<It>);
+        }
+
+        /// Counts input bytes and code points by another pass, if input is multi-pass
+        template <class It, class Enc>
+        void countIn(It beg, It end)
+        {
+            if constexpr (std::forward_iterator<It>) {
+                if (isOuter) {
+                    countBytesIn(beg, end);
+                    stats.nCps = ItEnc<It, Enc>::countCps(beg, end);
+                }
+            }
+        }
+
+        /// Counts output bytes, if output is multi-pass
+        template <class It>
+        void countOut([[maybe_unused]] It beg, [[maybe_unused]] It end)
+        {
+            if constexpr (std::forward_iterator<It>)
+                stats.bytesOut = std::distance(beg, end) * sizeof(std::iter_value_t<It>);
+        }
+
+        template <class Cont>
+        void countOut(const Cont& cont)
+            { stats.bytesOut = std::size(cont) * sizeof(*std::begin(cont)); }
+
+        profile::Stats stats;
+    private:
+        const char* op;
+        std::source_location loc;
+        bool isOuter;
+        bool isStopped = false;
+        uint64_t start;
+    };
+
+    inline ProfileScope::~ProfileScope()
+    {
+        if (!isStopped)
+            stop();
+        --profileDepth;
+        if (isOuter) {
+            stats.nCalls = 1;
+            profileRegistry().add(loc, op, stats);
+        }
+    }
+
+}   // namespace mojibake::detail
+
+#endif
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <bit>
+#include <iterator>
+#include <type_traits>
+
+// SSE2 is always present on x64; 32-bit x86 needs a compiler switch
+// Define MJ_NO_SIMD to get plain C++
+#if !defined(MJ_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define MJ_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace mojibake::detail {
+
+    /// Number of units checked at once
+    template <class Ch>
+    constexpr size_t SIMD_UNITS = 16 / sizeof(Ch);
+
+    template <class Ch>
+    using UnsignedCh = std::make_unsigned_t<Ch>;
+
+#ifdef MJ_SSE2
+    ///
+    /// @return  bit mask, 1 bit per byte, of non-ASCII units
+    ///          (a unit sets all of its bits)
+    ///
+    template <class Ch>
+    inline unsigned nonAsciiMask(__m128i v)
+    {
+        if constexpr (sizeof(Ch) == 1) {
+            return _mm_movemask_epi8(v);
+        } else {
+            const __m128i mask = (sizeof(Ch) == 2)
+                    ? _mm_set1_epi16(static_cast<short>(0xFF80))
+                    : _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+            auto isAscii = (sizeof(Ch) == 2)
+                    ? _mm_cmpeq_epi16(_mm_and_si128(v, mask), _mm_setzero_si128())
+                    : _mm_cmpeq_epi32(_mm_and_si128(v, mask), _mm_setzero_si128());
+            return ~_mm_movemask_epi8(isAscii) & 0xFFFF;
+        }
+    }
+
+    ///
+    /// @return  bit mask, same format, of controls 00…1F, 7F
+    /// @warning  Valid for ASCII units only
+    ///
+    template <class Ch>
+    inline unsigned controlMask(__m128i v)
+    {
+        if constexpr (sizeof(Ch) == 1) {
+            auto isCtl = _mm_or_si128(
+                    _mm_cmplt_epi8(v, _mm_set1_epi8(0x20)),
+                    _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7F)));
+            return _mm_movemask_epi8(isCtl);
+        } else if constexpr (sizeof(Ch) == 2) {
+            auto isCtl = _mm_or_si128(
+                    _mm_cmplt_epi16(v, _mm_set1_epi16(0x20)),
+                    _mm_cmpeq_epi16(v, _mm_set1_epi16(0x7F)));
+            return _mm_movemask_epi8(isCtl);
+        } else {
+            auto isCtl = _mm_or_si128(
+                    _mm_cmplt_epi32(v, _mm_set1_epi32(0x20)),
+                    _mm_cmpeq_epi32(v, _mm_set1_epi32(0x7F)));
+            return _mm_movemask_epi8(isCtl);
+        }
+    }
+#endif
+
+    /// @return [+] unit is a control char 00…1F, 7F
+    constexpr bool isAsciiControl(char32_t c) { return c < 0x20 || c == 0x7F; }
+
+    ///
+    /// Skips ASCII units and counts controls among them
+    /// @param [in,out] nControls  += # of 00…1F, 7F in the ASCII part
+    /// @return  1st non-ASCII unit in [p, end), or end
+    ///
+    template <class Ch>
+    const Ch* findNonAscii(const Ch* p, const Ch* end, size_t& nControls)
+    {
+        static_assert(sizeof(Ch) == 1 || sizeof(Ch) == 2 || sizeof(Ch) == 4);
+    #ifdef MJ_SSE2
+        constexpr auto N = SIMD_UNITS<Ch>;
+        for (; end - p >= static_cast<ptrdiff_t>(N); p += N) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            auto bad = nonAsciiMask<Ch>(v);
+            auto ctl = controlMask<Ch>(v);
+            if (bad != 0) {
+                auto nGoodBytes = std::countr_zero(bad);
+                ctl &= (1u << nGoodBytes) - 1;
+                nControls += std::popcount(ctl) / sizeof(Ch);
+                return p + nGoodBytes / sizeof(Ch);
+            }
+            nControls += std::popcount(ctl) / sizeof(Ch);
+        }
+    #endif
+        for (; p != end; ++p) {
+            char32_t c = static_cast<UnsignedCh<Ch>>(*p);
+            if (c >= 0x80)
+                break;
+            nControls += isAsciiControl(c);
+        }
+        return p;
+    }
+
+    ///
+    /// Skips ASCII units
+    /// @return  1st non-ASCII unit in [p, end), or end
+    ///
+    template <class Ch>
+    const Ch* findNonAscii(const Ch* p, const Ch* end)
+    {
+        static_assert(sizeof(Ch) == 1 || sizeof(Ch) == 2 || sizeof(Ch) == 4);
+    #ifdef MJ_SSE2
+        constexpr auto N = SIMD_UNITS<Ch>;
+        for (; end - p >= static_cast<ptrdiff_t>(N); p += N) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            auto bad = nonAsciiMask<Ch>(v);
+            if (bad != 0)
+                return p + std::countr_zero(bad) / sizeof(Ch);
+        }
+    #endif
+        for (; p != end; ++p) {
+            char32_t c = static_cast<UnsignedCh<Ch>>(*p);
+            if (c >= 0x80)
+                break;
+        }
+        return p;
+    }
+
+    /// @return  code unit of any iterator, w/o sign extension
+    template <class It>
+    inline char32_t unitAt(It p)
+    {
+        using Ch = ChType<It>;
+        if constexpr (std::is_integral_v<Ch>) {
+            return static_cast<std::make_unsigned_t<Ch>>(*p);
+        } else {
+            return *p;
+        }
+    }
+
+    /// @return [+] units 00…7F are ASCII chars
+    template <class Enc>
+    constexpr bool isAsciiBased = std::is_same_v<Enc, Utf8> || std::is_same_v<Enc, Utf16>
+                    || std::is_same_v<Enc, Utf32> || std::is_same_v<Enc, Utf8Esc>
+                    || std::is_same_v<Enc, Cesu8> || std::is_same_v<Enc, Mutf8>;
+
+    template <Cp x>
+    constexpr bool isAsciiBased<CodePage<x>> = true;
+
+    /// @return [+] contiguous input, and ASCII units are ASCII chars,
+    ///             so we can skip them by SIMD
+    template <class It, class Enc>
+    constexpr bool hasAsciiFastPath = std::contiguous_iterator<It>
+            && isAsciiBased<Enc>
+            && sizeof(ChType<It>) == sizeof(typename Enc::Ch);
+
+    /// @return [+] ASCII code points are written as they are, a unit each
+    ///             (Modified UTF-8 writes NUL in two bytes)
+    template <class Enc>
+    constexpr bool putsAsciiAsIs = isAsciiBased<Enc> && !std::is_same_v<Enc, Mutf8>;
+
+    /// @return  index of 1st unit ≥ 80 in [beg, end), or its length
+    template <class It>
+    size_t firstNonAscii(It beg, It end)
+    {
+        if constexpr (std::contiguous_iterator<It>) {
+            auto p = std::to_address(beg);
+            return findNonAscii(p, p + (end - beg)) - p;
+        } else {
+            size_t r = 0;
+            for (; beg != end && unitAt(beg) <= 0x7F; ++beg)
+                ++r;
+            return r;
+        }
+    }
+
+    /// Appends units to container, at once if it can
+    template <class To, class Ch>
+    inline void appendUnits(To& r, const Ch* p, const Ch* end)
+    {
+        if constexpr (requires { r.append(p, end); }) {
+            r.append(p, end);
+        } else if constexpr (requires { r.insert(r.end(), p, end); }) {
+            r.insert(r.end(), p, end);
+        } else {
+            std::copy(p, end, std::back_inserter(r));
+        }
+    }
+
+    ///
+    /// ASCII prefix is the same in both encodings → appends it
+    /// by units w/o decoding, if we can find it by SIMD
+    /// @return  where the rest starts
+    ///
+    template <class Enc1, class Enc2, class To, class It>
+    inline It appendAsciiPrefix([[maybe_unused]] To& r, It beg, [[maybe_unused]] It end)
+    {
+        if constexpr (hasAsciiFastPath<It, Enc1> && putsAsciiAsIs<Enc2>) {
+            auto p = std::to_address(beg);
+            auto n = firstNonAscii(beg, end);
+            appendUnits(r, p, p + n);
+            return beg + n;
+        } else {
+            return beg;
+        }
+    }
+
+}   // namespace mojibake::detail
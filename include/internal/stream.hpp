@@ -0,0 +1,120 @@
+#pragma once
+
+namespace mojibake::detail {
+
+    /// Unit size of byte-based encoding
+    template <class Enc>
+    constexpr size_t BYTE_UNIT = 1;
+
+    template <std::endian e>
+    constexpr size_t BYTE_UNIT<Utf16Bytes<e>> = 2;
+
+    template <std::endian e>
+    constexpr size_t BYTE_UNIT<Utf32Bytes<e>> = 4;
+
+    /// Block of stream transcoding yields that many units per input byte, max
+    template <class Enc2>
+    constexpr size_t STREAM_RATIO = MAX_CP_BYTES<Enc2> / sizeof(typename Enc2::Ch);
+
+    ///
+    /// UTF-8 reports a run of stray continuation bytes (maybe after bad
+    /// starting byte) as one bad sequence, so the run may go on in the next block
+    /// @param [in] s  start of sequence that contains the last byte
+    /// @return [+] [s, end) is such run
+    ///
+    template <class Enc>
+    bool isBadRun([[maybe_unused]] const char* s, [[maybe_unused]] const char* end)
+    {
+        if constexpr (std::is_same_v<Enc, Utf8> || isCesu<Enc>) {
+            if (s == end)
+                return false;
+            auto byte1 = static_cast<unsigned char>(*s);
+            return isU8ContinueByte(byte1) || count1(byte1) > 4;
+        } else {
+            return false;
+        }
+    }
+
+    ///
+    /// Finds code point that may continue in the next block
+    /// @return  its start in [beg, end), or end if data ends at code point boundary
+    ///
+    template <class Enc>
+    const char* incompleteTail(const char* beg, const char* end)
+    {
+        static_assert(sizeof(typename Enc::Ch) == 1, "Need byte-based encoding");
+        if constexpr (std::is_same_v<Enc, Utf8> || std::is_same_v<Enc, Utf8Esc> || isCesu<Enc>) {
+            if (beg == end)
+                return end;
+            auto s = ItEnc<const char*, Utf8>::startOf(beg, end - 1);
+            if (isBadRun<Enc>(s, end))
+                return s;
+            bool isCut = (end - s < 4) && !ItEnc<const char*, Utf8>::isValid(s, end);
+            if (!isCut)
+                s = end;
+            if constexpr (isCesu<Enc>) {
+                // Leading surrogate waits for its pair
+                if (s - beg >= 3) {
+                    auto word1 = readCesuSurrogate(s - 3, s);
+                    if (word1 >= SURROGATE_LO_MIN && word1 <= SURROGATE_LO_MAX)
+                        s -= 3;
+                }
+            }
+            return s;
+        } else if constexpr (BYTE_UNIT<Enc> == 2) {
+            auto s = end - (end - beg) % 2;
+            if (s - beg >= 2) {
+                auto p = s - 2;
+                char32_t unit;
+                readUnit<2, Enc::endian>(p, s, unit);
+                if (unit >= SURROGATE_LO_MIN && unit <= SURROGATE_LO_MAX)
+                    s -= 2;
+            }
+            return s;
+        } else if constexpr (BYTE_UNIT<Enc> == 4) {
+            return end - (end - beg) % 4;
+        } else {
+            return end;
+        }
+    }
+
+    template <class Ch2>
+    struct StreamBlock {
+        const char* used;   ///< what is not used should go to the next block
+        Ch2* destEnd;
+        bool isHalted;      ///< [+] onMojibake halted
+    };
+
+    ///
+    /// Transcodes block of stream, leaving code point that may continue
+    /// in the next block.
+    /// Bad run at the end is left by its last byte, which stands for
+    /// the whole run, so that result does not depend on block boundaries,
+    /// and what is left stays short
+    /// @param [in] isLast  [+] no more data, incomplete code point is bad data
+    /// @param [in] dest    room for (end − p) · STREAM_RATIO units
+    ///
+    template <class Enc1, class Enc2, class Mjh, class Ch2 = typename Enc2::Ch>
+    StreamBlock<Ch2> transcodeBlock(const char* p, const char* end, bool isLast,
+                                    Ch2* dest, const Mjh& onMojibake)
+    {
+        using It = const char*;
+        auto cut = isLast ? end : incompleteTail<Enc1>(p, end);
+        auto used = (!isLast && isBadRun<Enc1>(cut, end)) ? end - 1 : cut;
+        if constexpr (std::is_same_v<Mjh, handler::Skip<It>>
+                || std::is_same_v<Mjh, handler::Moji<It>>) {   // never halt
+            return { used, detail::copy<It, Ch2*, Enc1, Enc2, Mjh>(p, cut, dest, onMojibake), false };
+        } else {
+            bool isHalted = false;
+            auto onBadData = [&isHalted, &onMojibake](It place, Event event) {
+                char32_t r = onMojibake(place, event);
+                isHalted |= ((r & handler::FG_HALT) != 0);
+                return r;
+            };
+            auto destEnd = detail::copy<It, Ch2*, Enc1, Enc2, decltype(onBadData)>(
+                        p, cut, dest, onBadData);
+            return { used, destEnd, isHalted };
+        }
+    }
+
+}   // namespace mojibake::detail
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <iterator> // won’t be included actually
+
+namespace mojibake::detail {
+
+    /// @return  0, 1 or 2, see mojibake::cpWidth
+    inline int widthOf(char32_t cp)
+    {
+        if (cp < 0x80)
+            return !isAsciiControl(cp);
+        if (cp >= WIDTH_MAXCP)
+            return 1;
+        auto index = widthLookup[cp >> WIDTH_BLOCKSHIFT];
+        return widthBlocks[index][cp & WIDTH_BLOCKMASK];
+    }
+
+    template <class It, class Enc>
+    size_t displayWidth(It p, It end)
+    {
+        using Mo = handler::Moji<It>;
+        size_t r = 0;
+        while (p != end) {
+            if constexpr (hasAsciiFastPath<It, Enc>) {
+                if (unitAt(p) < 0x80) {
+                    auto beg = std::to_address(p);
+                    size_t nControls = 0;
+                    auto q = findNonAscii(beg, beg + (end - p), nControls);
+                    r += (q - beg) - nControls;
+                    p += q - beg;
+                    continue;
+                }
+            }
+            r += widthOf(ItEnc<It, Enc>::get(p, end, Mo{}));
+        }
+        return r;
+    }
+
+    template <class It, class Enc>
+    It truncateWidth(It p, It end, size_t maxWidth)
+    {
+        using Mo = handler::Moji<It>;
+        size_t width = 0;
+        while (p != end) {
+            if constexpr (hasAsciiFastPath<It, Enc>) {
+                // ASCII is never wider than 1 → scan remaining width at most
+                if (unitAt(p) < 0x80 && width < maxWidth) {
+                    auto beg = std::to_address(p);
+                    auto lim = std::min<size_t>(end - p, maxWidth - width);
+                    size_t nControls = 0;
+                    auto q = findNonAscii(beg, beg + lim, nControls);
+                    width += (q - beg) - nControls;
+                    p += q - beg;
+                    continue;
+                }
+            }
+            // Zero-width chars are taken even if width is exhausted
+            auto q = p;
+            auto w = widthOf(ItEnc<It, Enc>::get(q, end, Mo{}));
+            if (width + w > maxWidth)
+                break;
+            width += w;
+            p = q;
+        }
+        return p;
+    }
+
+}   // namespace mojibake::detail
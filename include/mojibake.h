@@ -8,8 +8,12 @@
 ///
 
 #include <algorithm>
+#include <bit>
 #include <iterator>
+#include <ranges>
+#include <streambuf>
 #include <type_traits>
+#include <vector>
 
 #include "internal/auto.hpp"
 
@@ -39,6 +43,56 @@ namespace mojibake {
     struct Utf16 { using Ch = char16_t; };
     struct Utf32 { using Ch = char32_t; };
 
+    /// UTF-16/32 of given byte order in byte buffers: char, unsigned char, std::byte…
+    /// Places in mojibake handlers are byte iterators
+    template <std::endian e>
+    struct Utf16Bytes { using Ch = char; static constexpr std::endian endian = e; };
+
+    template <std::endian e>
+    struct Utf32Bytes { using Ch = char; static constexpr std::endian endian = e; };
+
+    using Utf16LE = Utf16Bytes<std::endian::little>;
+    using Utf16BE = Utf16Bytes<std::endian::big>;
+    using Utf32LE = Utf32Bytes<std::endian::little>;
+    using Utf32BE = Utf32Bytes<std::endian::big>;
+
+    /// UTF-8 with surrogateescape, like Python’s: every byte of bad data
+    /// is read as lone surrogate DC80…DCFF, and these surrogates are written
+    /// back as bytes. So any byte string survives round trip, e.g. file names
+    /// Reading never calls mojibake handler; writing needs handler::Lone
+    /// to keep lone surrogates of UTF-16/32
+    struct Utf8Esc { using Ch = char; };
+
+    /// CESU-8: UTF-8 whose supplementary code points are surrogate pairs,
+    /// three bytes per surrogate. Some databases store it
+    struct Cesu8 { using Ch = char; };
+
+    /// Java’s Modified UTF-8 (JNI, class files): CESU-8 with NUL as C0 80
+    struct Mutf8 { using Ch = char; };
+
+    /// Single-byte ASCII-based code pages
+    /// @warning  Values are indexes in generated tables, do not reorder
+    enum class Cp : unsigned char {
+        CP1250, CP1251, CP1252, KOI8_R, KOI8_U,
+        ISO8859_1, ISO8859_2, ISO8859_5, ISO8859_15, NN };
+
+    template <Cp x>
+    struct CodePage { using Ch = char; static constexpr Cp id = x; };
+
+    using Cp1250 = CodePage<Cp::CP1250>;        ///< Windows Central European
+    using Cp1251 = CodePage<Cp::CP1251>;        ///< Windows Cyrillic
+    using Cp1252 = CodePage<Cp::CP1252>;        ///< Windows Western
+    using Koi8r = CodePage<Cp::KOI8_R>;         ///< Russian
+    using Koi8u = CodePage<Cp::KOI8_U>;         ///< Ukrainian
+    using Iso8859_1 = CodePage<Cp::ISO8859_1>;  ///< Latin-1
+    using Iso8859_2 = CodePage<Cp::ISO8859_2>;  ///< Latin-2
+    using Iso8859_5 = CodePage<Cp::ISO8859_5>;  ///< Cyrillic
+    using Iso8859_15 = CodePage<Cp::ISO8859_15>; ///< Latin-9, Latin-1 with euro
+
+    /// Bytes are code points U+0000…00FF; converted by SIMD
+    /// from/to UTF-16/32, see also fitsLatin1
+    using Latin1 = Iso8859_1;
+
     /// @warning  Reimplement to true for limited iterators
     template <class Iterator>
     struct IteratorLimit {
@@ -60,12 +114,55 @@ namespace mojibake {
     enum class Event {
         CODE,       ///< UTF-8/32, bad character code, or too long sequence. Place = sequence start
                     ///< As UTF-16 limits code space, DOES NOT happen on UTF-16
+                    ///< Code pages: undefined byte; when writing, code point
+                    ///<   not in code page. Place = byte / sequence start
         BYTE_START, ///< UTF-8/16, bad starting byte/word. Place obvious
-                    ///< As UTF-32 does not have multi-unit sequences, this and the rest don’t happen
+                    ///< As UTF-32 does not have multi-unit sequences, this and BYTE_NEXT don’t happen
         BYTE_NEXT,  ///< UTF-8/16, bad any byte/word except start. Place = bad unit
         END,        ///< UTF-8/16, code sequence abruptly ended. Place = sequence start
+                    ///< Utf16Bytes/Utf32Bytes: also incomplete unit at the end
+    };
+
+    /// Where text may be cut
+    enum class Bound { CODE_POINT, GRAPHEME };
+
+    /// Unicode normalization forms
+    enum class Nf { NFC, NFD, NFKC, NFKD };
+
+    /// Result of normalization quick check
+    enum class Qc {
+        NO,         ///< surely not normalized
+        YES,        ///< surely normalized
+        MAYBE,      ///< need to normalize and compare
+    };
+
+    /// Encoding found by detect()
+    enum class Charset : unsigned char {
+        UNKNOWN,    ///< nothing fits, e.g. binary data
+        UTF8,       ///< also pure ASCII
+        UTF16LE, UTF16BE, UTF32LE, UTF32BE,
+        CODE_PAGE,  ///< single-byte, see Detected::codePage
     };
 
+    struct Detected {
+        Charset charset = Charset::UNKNOWN;
+        Cp codePage = Cp::NN;           ///< for CODE_PAGE
+        unsigned char bomSize = 0;      ///< # of bytes to skip
+        unsigned char confidence = 0;   ///< 0…100
+    };
+
+    /// Default # of bytes detect() looks at
+    constexpr size_t DETECT_PREFIX = 16384;
+
+    /// CpIndex has an entry per that many code points
+    constexpr size_t CPINDEX_STEP = 64;
+
+    /// transcodeInPlace: result does not fit buffer
+    constexpr size_t INPLACE_NO_ROOM = static_cast<size_t>(-1);
+
+    /// Streams are transcoded by blocks of that many bytes
+    constexpr size_t STREAM_BLOCK = 65536;
+
     namespace handler {
 
         constexpr char32_t RET_SKIP = 0xFFFFFF;
@@ -118,10 +215,70 @@ namespace mojibake {
                     [[maybe_unused]] Event event) const noexcept { return MOJIBAKE | FG_HALT; }
         };  // class Skip
 
+        ///
+        /// Keeps lone surrogates instead of mojibake, so ill-formed UTF-16
+        /// (Windows file names, JavaScript strings) survives round trip:
+        /// • UTF-16/32: unpaired surrogate → itself
+        /// • UTF-8: surrogate in three bytes ED A0 80…ED BF BF (WTF-8) → itself
+        /// As UTF-8 writes surrogates in three bytes, and UTF-16/32 as is,
+        ///   UTF-16 → UTF-8 makes WTF-8, and WTF-8 → UTF-16 restores data.
+        ///   Utf8Esc writes escaped bytes back.
+        /// Other bad data → MOJIBAKE
+        /// @warning  Needs units: byte buffers (Utf16LE…) just get MOJIBAKE
+        ///
+        template <class It>
+        class Lone final {
+        public:
+            char32_t operator () (It place, Event event) const
+            {
+                using Ch = typename std::iterator_traits<It>::value_type;
+                if constexpr (sizeof(Ch) == 1) {
+                    // CODE at ED = surrogate or bad 3-byte sequence, all bytes are here
+                    if (event == Event::CODE && static_cast<unsigned char>(*place) == 0xED) {
+                        auto b2 = static_cast<unsigned char>(*++place);
+                        auto b3 = static_cast<unsigned char>(*++place);
+                        if ((b2 & 0xE0) == 0xA0 && (b3 & 0xC0) == 0x80)
+                            return 0xD000 | ((b2 & 0x3F) << 6) | (b3 & 0x3F);
+                    }
+                } else if constexpr (sizeof(Ch) == 2) {
+                    if (event != Event::BYTE_NEXT)
+                        return static_cast<char16_t>(*place);
+                    // Place = unit after leading surrogate
+                    if constexpr (std::bidirectional_iterator<It>)
+                        return static_cast<char16_t>(*std::prev(place));
+                } else {
+                    char32_t c = *place;
+                    if (c >= SURROGATE_MIN && c <= SURROGATE_MAX)
+                        return c;
+                }
+                return MOJIBAKE;
+            }
+        };  // class Lone
+
     }   // namespace handler
 } // namespace mojibake
 
 #include "internal/detail.hpp"
+#include "internal/simd.hpp"
+#include "internal/byteorder.hpp"
+#include "internal/grapheme.hpp"
+#include "internal/width.hpp"
+#include "internal/latin1.hpp"
+#include "internal/codepage.hpp"
+#include "internal/normalize.hpp"
+#include "internal/escape.hpp"
+#include "internal/cesu.hpp"
+#include "internal/inplace.hpp"
+#include "internal/limited.hpp"
+#include "internal/stream.hpp"
+#include "internal/async.hpp"
+#include "internal/fdio.hpp"
+#include "internal/bulk.hpp"
+#include "internal/detect.hpp"
+#include "internal/cpindex.hpp"
+#include "internal/hash.hpp"
+#include "internal/compare.hpp"
+#include "internal/profile.hpp"
 
 namespace mojibake {
     ///
@@ -152,8 +309,19 @@ namespace mojibake {
     template <class It,
               class Enc = typename detail::ItUtfTraits<It>::Enc,
               class = std::void_t<typename std::iterator_traits<It>::value_type>>
-    inline size_t countCps(It beg, It end)
-        { return detail::ItEnc<It, Enc>::countCps(beg, end); }
+    inline size_t countCps(It beg, It end MJ_LOC_PARAM)
+    {
+    #ifdef MJ_PROFILE
+        detail::ProfileScope scope("countCps", mjLoc);
+        auto r = detail::ItEnc<It, Enc>::countCps(beg, end);
+        scope.stop();
+        scope.countBytesIn(beg, end);
+        scope.stats.nCps = r;
+        return r;
+    #else
+        return detail::ItEnc<It, Enc>::countCps(beg, end);
+    #endif
+    }
 
     /// Counts # of VALID codepoints in x
     /// All invalid codepoints are skipped as in toS functions
@@ -161,10 +329,10 @@ namespace mojibake {
     ///           countCps == toS<u32string>.length <= toQ.length
     template <class From,
               class Enc = typename detail::ContUtfTraits<From>::Enc>
-    inline size_t countCps(const From& x)
+    inline size_t countCps(const From& x MJ_LOC_PARAM)
     {
         using It = decltype(std::begin(x));
-        return detail::ItEnc<It, Enc>::countCps(std::begin(x), std::end(x));
+        return countCps<It, Enc>(std::begin(x), std::end(x) MJ_LOC_ARG);
     }
 
     /// Counts # of VALID codepoints in x
@@ -172,10 +340,10 @@ namespace mojibake {
     /// @warning  As copyQ writes mojibake (FFFD) or just bad input,
     ///           countCps == toS<u32string>.length <= toQ.length
     template <class Enc = Utf32>
-    inline size_t countCps(const char32_t* x)
+    inline size_t countCps(const char32_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return countCps<decltype(sv), Enc>(sv);
+        return countCps<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     /// Counts # of VALID codepoints in x
@@ -183,10 +351,10 @@ namespace mojibake {
     /// @warning  As copyQ writes mojibake (FFFD) or just bad input,
     ///           countCps == toS<u32string>.length <= toQ.length
     template <class Enc = Utf16>
-    inline size_t countCps(const char16_t* x)
+    inline size_t countCps(const char16_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return countCps<decltype(sv), Enc>(sv);
+        return countCps<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     /// Counts # of VALID codepoints in x
@@ -194,10 +362,10 @@ namespace mojibake {
     /// @warning  As copyQ writes mojibake (FFFD) or just bad input,
     ///           countCps == toS<u32string>.length <= toQ.length
     template <class Enc = typename detail::LenTraits<sizeof(wchar_t)>::Enc>
-    inline size_t countCps(const wchar_t* x)
+    inline size_t countCps(const wchar_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return countCps<decltype(sv), Enc>(sv);
+        return countCps<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     /// Counts # of VALID codepoints in x
@@ -205,10 +373,10 @@ namespace mojibake {
     /// @warning  As copyQ writes mojibake (FFFD) or just bad input,
     ///           countCps == toS<u32string>.length <= toQ.length
     template <class Enc = Utf8>
-    inline size_t countCps(const char* x)
+    inline size_t countCps(const char* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return countCps<decltype(sv), Enc>(sv);
+        return countCps<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     /// Counts # of VALID codepoints in x
@@ -216,10 +384,10 @@ namespace mojibake {
     /// @warning  As copyQ writes mojibake (FFFD) or just bad input,
     ///           countCps == toS<u32string>.length <= toQ.length
     template <class Enc = Utf8>
-    inline size_t countCps(const char8_t* x)
+    inline size_t countCps(const char8_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return countCps<decltype(sv), Enc>(sv);
+        return countCps<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     ///
@@ -235,26 +403,36 @@ namespace mojibake {
               class Mjh,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copy(It1 beg, It1 end, It2 dest, const Mjh& onMojibake = Mjh{})
+    inline It2 copy(It1 beg, It1 end, It2 dest, const Mjh& onMojibake = Mjh{} MJ_LOC_PARAM)
     {
-        return detail::ItEnc<It1, Enc1>::template copy<It2, Enc2, Mjh>(beg, end, dest, onMojibake);
+    #ifdef MJ_PROFILE
+        detail::ProfileScope scope("copy", mjLoc);
+        auto onBadData = scope.counting(onMojibake);
+        auto r = detail::copy<It1, It2, Enc1, Enc2, decltype(onBadData)>(beg, end, dest, onBadData);
+        scope.stop();
+        scope.countIn<It1, Enc1>(beg, end);
+        scope.countOut(dest, r);
+        return r;
+    #else
+        return detail::copy<It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake);
+    #endif
     }
 
     template <class Enc1, class Enc2, class Mjh, class It1, class It2,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copy(It1 beg, It1 end, It2 dest, const Mjh& onMojibake = Mjh{})
+    inline It2 copy(It1 beg, It1 end, It2 dest, const Mjh& onMojibake = Mjh{} MJ_LOC_PARAM)
     {
-        return copy<It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake);
+        return copy<It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake MJ_LOC_ARG);
     }
 
     template <class Enc2, class Mjh, class It1, class It2,
               class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copy(It1 beg, It1 end, It2 dest, const Mjh& onMojibake = Mjh{})
+    inline It2 copy(It1 beg, It1 end, It2 dest, const Mjh& onMojibake = Mjh{} MJ_LOC_PARAM)
     {
-        return copy<It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake);
+        return copy<It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake MJ_LOC_ARG);
     }
 
     ///
@@ -266,27 +444,27 @@ namespace mojibake {
               class Enc2 = typename detail::ItUtfTraits<It2>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyS(It1 beg, It1 end, It2 dest)
+    inline It2 copyS(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
         using Sk = mojibake::handler::Skip<It1>;
-        return detail::ItEnc<It1, Enc1>::template copy<It2, Enc2, Sk>(beg, end, dest, Sk{});
+        return copy<It1, It2, Enc1, Enc2, Sk>(beg, end, dest, Sk{} MJ_LOC_ARG);
     }
 
     template <class Enc1, class Enc2, class It1, class It2,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyS(It1 beg, It1 end, It2 dest)
+    inline It2 copyS(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyS<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyS<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     template <class Enc2, class It1, class It2,
               class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyS(It1 beg, It1 end, It2 dest)
+    inline It2 copyS(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyS<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyS<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     ///
@@ -298,27 +476,27 @@ namespace mojibake {
               class Enc2 = typename detail::ItUtfTraits<It2>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyM(It1 beg, It1 end, It2 dest)
+    inline It2 copyM(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
         using Mo = mojibake::handler::Moji<It1>;
-        return detail::ItEnc<It1, Enc1>::template copy<It2, Enc2, Mo>(beg, end, dest, Mo{});
+        return copy<It1, It2, Enc1, Enc2, Mo>(beg, end, dest, Mo{} MJ_LOC_ARG);
     }
 
     template <class Enc1, class Enc2, class It1, class It2,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyM(It1 beg, It1 end, It2 dest)
+    inline It2 copyM(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyM<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyM<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     template <class Enc2, class It1, class It2,
               class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyM(It1 beg, It1 end, It2 dest)
+    inline It2 copyM(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyM<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyM<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     ///
@@ -330,27 +508,27 @@ namespace mojibake {
               class Enc2 = typename detail::ItUtfTraits<It2>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyMH(It1 beg, It1 end, It2 dest)
+    inline It2 copyMH(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
         using Mh = mojibake::handler::MojiHalt<It1>;
-        return detail::ItEnc<It1, Enc1>::template copy<It2, Enc2, Mh>(beg, end, dest, Mh{});
+        return copy<It1, It2, Enc1, Enc2, Mh>(beg, end, dest, Mh{} MJ_LOC_ARG);
     }
 
     template <class Enc1, class Enc2, class It1, class It2,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyMH(It1 beg, It1 end, It2 dest)
+    inline It2 copyMH(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyMH<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyMH<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     template <class Enc2, class It1, class It2,
               class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyMH(It1 beg, It1 end, It2 dest)
+    inline It2 copyMH(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyMH<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyMH<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     ///
@@ -367,30 +545,30 @@ namespace mojibake {
               class Enc2 = typename detail::ItUtfTraits<It2>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyQ(It1 beg, It1 end, It2 dest)
+    inline It2 copyQ(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
         if constexpr (std::is_same_v<Enc1, Enc2>) {
             return std::copy(beg, end, dest);
         } else {
-            return copyM<It1, It2, Enc1, Enc2>(beg, end, dest);
+            return copyM<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
         }
     }
 
     template <class Enc1, class Enc2, class It1, class It2,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyQ(It1 beg, It1 end, It2 dest)
+    inline It2 copyQ(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyQ<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyQ<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     template <class Enc2, class It1, class It2,
               class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
               class = std::void_t<typename std::iterator_traits<It1>::value_type>,
               class = std::void_t<typename std::iterator_traits<It2>::value_type>>
-    inline It2 copyQ(It1 beg, It1 end, It2 dest)
+    inline It2 copyQ(It1 beg, It1 end, It2 dest MJ_LOC_PARAM)
     {
-        return copyQ<It1, It2, Enc1, Enc2>(beg, end, dest);
+        return copyQ<It1, It2, Enc1, Enc2>(beg, end, dest MJ_LOC_ARG);
     }
 
     ///
@@ -399,13 +577,27 @@ namespace mojibake {
     template <class To, class From, class Mjh,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::ContUtfTraits<From>::Enc>
-    To to(const From& from, const Mjh& onMojibake = Mjh{})
+    To to(const From& from, const Mjh& onMojibake = Mjh{} MJ_LOC_PARAM)
     {
+    #ifdef MJ_PROFILE
+        detail::ProfileScope scope("to", mjLoc);
+        auto onBadData = scope.counting(onMojibake);
+        using Mjh1 = decltype(onBadData);
+    #else
+        const Mjh& onBadData = onMojibake;
+        using Mjh1 = Mjh;
+    #endif
         To r;
+        auto beg = detail::appendAsciiPrefix<Enc1, Enc2>(r, std::begin(from), std::end(from));
         std::back_insert_iterator it(r);
         using It1 = decltype(std::begin(from));
         using It2 = decltype(it);
-        copy<It1, It2, Enc1, Enc2, Mjh>(std::begin(from), std::end(from), it, onMojibake);
+        mojibake::copy<It1, It2, Enc1, Enc2, Mjh1>(beg, std::end(from), it, onBadData);
+    #ifdef MJ_PROFILE
+        scope.stop();
+        scope.countIn<It1, Enc1>(std::begin(from), std::end(from));
+        scope.countOut(r);
+    #endif
         return r;
     }
 
@@ -415,21 +607,21 @@ namespace mojibake {
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::ContUtfTraits<From>::Enc>
-    inline To toS(const From& from)
+    inline To toS(const From& from MJ_LOC_PARAM)
     {
         using It = decltype(std::begin(from));
         using Sk = mojibake::handler::Skip<It>;
-        return to<To, From, Sk, Enc2, Enc1>(from);
+        return to<To, From, Sk, Enc2, Enc1>(from, Sk{} MJ_LOC_ARG);
     }
 
     /// Implementation for const char*
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::UtfTraits<From>::Enc>   // Also a SFINAE
-    inline To toS(const From* from)
+    inline To toS(const From* from MJ_LOC_PARAM)
     {
         std::basic_string_view from1{from};
-        return toS<To, decltype(from1), Enc2, Enc1>(from1);
+        return toS<To, decltype(from1), Enc2, Enc1>(from1 MJ_LOC_ARG);
     }
 
     ///
@@ -438,21 +630,21 @@ namespace mojibake {
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::ContUtfTraits<From>::Enc>
-    inline To toM(const From& from)
+    inline To toM(const From& from MJ_LOC_PARAM)
     {
         using It = decltype(std::begin(from));
         using Mo = mojibake::handler::Moji<It>;
-        return to<To, From, Mo, Enc2, Enc1>(from);
+        return to<To, From, Mo, Enc2, Enc1>(from, Mo{} MJ_LOC_ARG);
     }
 
     /// Implementation for const char*
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::UtfTraits<From>::Enc>   // Also a SFINAE
-    inline To toM(const From* from)
+    inline To toM(const From* from MJ_LOC_PARAM)
     {
         std::basic_string_view from1{from};
-        return toM<To, decltype(from1), Enc2, Enc1>(from1);
+        return toM<To, decltype(from1), Enc2, Enc1>(from1 MJ_LOC_ARG);
     }
 
     ///
@@ -464,14 +656,27 @@ namespace mojibake {
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::ContUtfTraits<From>::Enc>
-    inline To toQ(const From& from)
+    inline To toQ(const From& from MJ_LOC_PARAM)
     {
+    #ifdef MJ_PROFILE
+        detail::ProfileScope scope("to", mjLoc);
+    #endif
         To r;
-        std::back_insert_iterator it(r);
         using It1 = decltype(std::begin(from));
-        using It2 = decltype(it);
-        /// @todo [mojibake,performance] How to check for append (beg, end) function?
-        copyQ<It1, It2, Enc1, Enc2>(std::begin(from), std::end(from), it);
+        if constexpr (std::is_same_v<Enc1, Enc2> && std::contiguous_iterator<It1>) {
+            auto p = std::to_address(std::begin(from));
+            detail::appendUnits(r, p, p + (std::end(from) - std::begin(from)));
+        } else {
+            auto beg = detail::appendAsciiPrefix<Enc1, Enc2>(r, std::begin(from), std::end(from));
+            std::back_insert_iterator it(r);
+            using It2 = decltype(it);
+            copyQ<It1, It2, Enc1, Enc2>(beg, std::end(from), it);
+        }
+    #ifdef MJ_PROFILE
+        scope.stop();
+        scope.countIn<It1, Enc1>(std::begin(from), std::end(from));
+        scope.countOut(r);
+    #endif
         return r;
     }
 
@@ -479,10 +684,10 @@ namespace mojibake {
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::UtfTraits<From>::Enc>   // Also a SFINAE
-    inline To toQ(const From* from)
+    inline To toQ(const From* from MJ_LOC_PARAM)
     {
         std::basic_string_view from1{from};
-        return toQ<To, decltype(from1), Enc2, Enc1>(from1);
+        return toQ<To, decltype(from1), Enc2, Enc1>(from1 MJ_LOC_ARG);
     }
 
     ///
@@ -500,45 +705,53 @@ namespace mojibake {
     ///           that’s unlikely to appear in the wild etc.
     template <class Cont,
               class Enc = typename detail::ContUtfTraits<Cont>::Enc>
-    bool isValid(const Cont& cont)
+    bool isValid(const Cont& cont MJ_LOC_PARAM)
     {
         using It = decltype(std::begin(cont));
+    #ifdef MJ_PROFILE
+        detail::ProfileScope scope("isValid", mjLoc);
+        bool r = detail::ItEnc<It, Enc>::isValid(std::begin(cont), std::end(cont));
+        scope.stop();
+        scope.countIn<It, Enc>(std::begin(cont), std::end(cont));
+        return r;
+    #else
         return detail::ItEnc<It, Enc>::isValid(std::begin(cont), std::end(cont));
+    #endif
     }
 
     template <class Enc = Utf32>
-    inline bool isValid(const char32_t* x)
+    inline bool isValid(const char32_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return isValid<decltype(sv), Enc>(sv);
+        return isValid<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     template <class Enc = Utf16>
-    inline bool isValid(const char16_t* x)
+    inline bool isValid(const char16_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return isValid<decltype(sv), Enc>(sv);
+        return isValid<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     template <class Enc = typename detail::LenTraits<sizeof(wchar_t)>::Enc>
-    inline bool isValid(const wchar_t* x)
+    inline bool isValid(const wchar_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return isValid<decltype(sv), Enc>(sv);
+        return isValid<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     template <class Enc = Utf8>
-    inline bool isValid(const char* x)
+    inline bool isValid(const char* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return isValid<decltype(sv), Enc>(sv);
+        return isValid<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     template <class Enc = Utf8>
-    inline bool isValid(const char8_t* x)
+    inline bool isValid(const char8_t* x MJ_LOC_PARAM)
     {
         std::basic_string_view sv(x);
-        return isValid<decltype(sv), Enc>(sv);
+        return isValid<decltype(sv), Enc>(sv MJ_LOC_ARG);
     }
 
     ///
@@ -566,51 +779,748 @@ namespace mojibake {
         const AppendFuncIterator& operator ++() const noexcept { return *this; }
         const AppendFuncIterator& operator * () const noexcept { return *this; }
         const AppendFuncIterator* operator ->() const noexcept { return this; }
-        void operator = (value_type c) const { put<Enc>(it, func(c)); }
+        void operator = (value_type c) const
+        {
+            auto r = func(c);
+            if constexpr (detail::isCodePage<Enc>) {
+                // Not in code page → unchanged code point, or skipped as bad data
+                if (detail::cpEncode<Enc::id>(r) == 0 && r != 0) {
+                    if (detail::cpEncode<Enc::id>(c) == 0)
+                        return;
+                    r = c;
+                }
+            }
+            put<Enc>(it, r);
+        }
     private:
         mutable std::back_insert_iterator<To> it;
         const Func& func;
     };
 
+    /// This function exploits a common feature of most STL implementations:
+    /// containers do not shrink, just expand
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::ContUtfTraits<From>::Enc>
-    To simpleCaseFold(const From& from)
+    To& simpleCaseFold(const From& from, To& to MJ_LOC_PARAM)
     {
-        To to;
+    #ifdef MJ_PROFILE
+        detail::ProfileScope scope("simpleCaseFold", mjLoc);
+    #endif
+        to.clear();
         AppendFuncIterator<To, decltype(simpleCaseFoldCp), Enc2> it(to, simpleCaseFoldCp);
         // As case fold is just for comparison → skip bad!
         using It = decltype(std::begin(from));
         using Sk = mojibake::handler::Skip<It>;
         mojibake::copy<It, decltype(it), Enc1, Utf32, Sk>(
                     std::begin(from), std::end(from), it, Sk());
+    #ifdef MJ_PROFILE
+        scope.stop();
+        scope.countIn<It, Enc1>(std::begin(from), std::end(from));
+        scope.countOut(to);
+    #endif
         return to;
     }
 
-    /// This function exploits a common feature of most STL implementations:
-    /// containers do not shrink, just expand
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::ContUtfTraits<From>::Enc>
-    To& simpleCaseFold(const From& from, To& to)
+    To simpleCaseFold(const From& from MJ_LOC_PARAM)
     {
-        to.clear();
-        AppendFuncIterator<To, decltype(simpleCaseFoldCp), Enc2> it(to, simpleCaseFoldCp);
-        // As case fold is just for comparison → skip bad!
-        using It = decltype(std::begin(from));
-        using Sk = mojibake::handler::Skip<It>;
-        mojibake::copy<It, decltype(it), Enc1, Utf32, Sk>(
-                    std::begin(from), std::end(from), it, Sk());
+        To to;
+        simpleCaseFold<To, From, Enc2, Enc1>(from, to MJ_LOC_ARG);
         return to;
     }
 
     template <class To, class From,
               class Enc2 = typename detail::ContUtfTraits<To>::Enc,
               class Enc1 = typename detail::UtfTraits<From>::Enc>       // also a SFINAE
-    To simpleCaseFold(const From* from)
+    To simpleCaseFold(const From* from MJ_LOC_PARAM)
     {
         std::basic_string_view from1{from};
-        return simpleCaseFold<To, decltype(from1), Enc2, Enc1>(from1);
+        return simpleCaseFold<To, decltype(from1), Enc2, Enc1>(from1 MJ_LOC_ARG);
+    }
+
+    ///
+    /// Iterator over code points, decodes on the fly;
+    /// bidirectional if It is
+    /// Bad data goes to onMojibake: RET_SKIP skips it,
+    /// FG_HALT ends forward iteration after what handler returned
+    /// @warning  Refers to view’s handler, keep the view alive
+    ///
+    template <class It, class Enc, class Mjh>
+    class CpIterator
+    {
+    public:
+        using value_type = char32_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::conditional_t<std::bidirectional_iterator<It>,
+                std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+        using iterator_category = std::input_iterator_tag;  // * returns value
+
+        CpIterator() = default;
+        CpIterator(It aBeg, It aCurr, It aEnd, const Mjh* aOnMojibake)
+            : beg(aBeg), curr(aCurr), end(aEnd), onMojibake(aOnMojibake) { decode(); }
+
+        char32_t operator * () const { return value; }
+        CpIterator& operator ++ () { curr = next; decode(); return *this; }
+        CpIterator operator ++ (int) { auto r = *this; ++*this; return r; }
+        CpIterator& operator -- () requires std::bidirectional_iterator<It>;
+        CpIterator operator -- (int) requires std::bidirectional_iterator<It>
+            { auto r = *this; --*this; return r; }
+        bool operator == (const CpIterator& x) const { return curr == x.curr; }
+
+        /// @return  start of code point in data
+        It base() const { return curr; }
+        /// @return  end of code point in data
+        It nextBase() const { return next; }
+    private:
+        It beg {}, curr {}, next {}, end {};
+        const Mjh* onMojibake = nullptr;
+        char32_t value = 0;
+
+        /// Decodes code point at curr, skipping what handler skipped
+        void decode();
+    };
+
+    template <class It, class Enc, class Mjh>
+    void CpIterator<It, Enc, Mjh>::decode()
+    {
+        for (; curr != end; curr = next) {
+            next = curr;
+            auto c = detail::ItEnc<It, Enc>::get(next, end, *onMojibake);
+            if (c & handler::FG_HALT)
+                next = end;
+            value = c & handler::MASK_CODE;
+            if (value != handler::RET_SKIP)
+                return;
+        }
+        next = end;
+    }
+
+    /// Goes to the same code point forward iteration would find;
+    /// FG_HALT is ignored
+    template <class It, class Enc, class Mjh>
+    auto CpIterator<It, Enc, Mjh>::operator -- () -> CpIterator&
+        requires std::bidirectional_iterator<It>
+    {
+        while (curr != beg) {
+            auto start = detail::ItEnc<It, Enc>::prevStart(beg, curr);
+            next = start;
+            value = detail::ItEnc<It, Enc>::get(next, end, *onMojibake) & handler::MASK_CODE;
+            next = curr;
+            curr = start;
+            if (value != handler::RET_SKIP)
+                break;
+        }
+        return *this;
+    }
+
+    ///
+    /// Lazy view of code points, C++20 range
+    ///   for (char32_t c : codepoints(s)) …
+    ///
+    template <class It, class Enc, class Mjh>
+    class CpView : public std::ranges::view_interface<CpView<It, Enc, Mjh>>
+    {
+    public:
+        using iterator = CpIterator<It, Enc, Mjh>;
+
+        CpView() = default;
+        CpView(It aBeg, It aEnd, const Mjh& aOnMojibake)
+            : dataBeg(aBeg), dataEnd(aEnd), onMojibake(aOnMojibake) {}
+
+        iterator begin() const { return { dataBeg, dataBeg, dataEnd, &onMojibake }; }
+        iterator end() const { return { dataBeg, dataEnd, dataEnd, &onMojibake }; }
+    private:
+        It dataBeg {}, dataEnd {};
+        Mjh onMojibake {};
+    };
+
+    ///
+    /// Lazy view of code points in [beg, end)
+    /// Bad data is mojibake (U+FFFD) by default
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class Mjh = handler::Moji<It>,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline CpView<It, Enc, Mjh> codepoints(It beg, It end, const Mjh& onMojibake = Mjh{})
+        { return { beg, end, onMojibake }; }
+
+    ///
+    /// @overload  whole container, it should outlive the view
+    ///
+    template <class Cont,
+              class Enc = typename detail::ContUtfTraits<Cont>::Enc,
+              class Mjh = handler::Moji<decltype(std::begin(std::declval<const Cont&>()))>>
+    inline auto codepoints(const Cont& x, const Mjh& onMojibake = Mjh{})
+    {
+        using It = decltype(std::begin(x));
+        return CpView<It, Enc, Mjh>(std::begin(x), std::end(x), onMojibake);
+    }
+
+    /// Implementation for const char*
+    template <class Ch,
+              class Enc = typename detail::UtfTraits<Ch>::Enc,   // Also a SFINAE
+              class Mjh = handler::Moji<const Ch*>>
+    inline CpView<const Ch*, Enc, Mjh> codepoints(const Ch* x, const Mjh& onMojibake = Mjh{})
+    {
+        std::basic_string_view<Ch> x1 { x };
+        return { x1.data(), x1.data() + x1.length(), onMojibake };
+    }
+
+    ///
+    /// Reads code point that ends at p, backwards, p != beg
+    /// Bad data is split the same way as reading forward from beg,
+    /// as if data ends at p
+    /// O(1) for good data
+    /// @param [in,out] p  moves to start of code point
+    /// @return  code point, or what onMojibake returned
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class Mjh = handler::Moji<It>,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline char32_t getBack(It beg, It& p, const Mjh& onMojibake = Mjh{})
+    {
+        auto start = detail::ItEnc<It, Enc>::prevStart(beg, p);
+        auto q = start;
+        auto r = detail::ItEnc<It, Enc>::get(q, p, onMojibake);
+        p = start;
+        return r;
+    }
+
+    ///
+    /// @return  start of last n code points of [beg, end), w/o decoding the rest
+    ///          Every bad sequence counts as one
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline It lastCps(It beg, It end, size_t n)
+    {
+        for (; n != 0 && end != beg; --n)
+            end = detail::ItEnc<It, Enc>::prevStart(beg, end);
+        return end;
+    }
+
+    /// @overload  for container
+    template <class From,
+              class Enc = typename detail::ContUtfTraits<From>::Enc>
+    inline auto lastCps(const From& x, size_t n)
+    {
+        using It = decltype(std::begin(x));
+        return lastCps<It, Enc>(std::begin(x), std::end(x), n);
+    }
+
+    /// @return [+] cp has Unicode property White_Space
+    constexpr bool isSpace(char32_t cp)
+    {
+        if (cp <= U8_1BYTE_MAX)
+            return cp == ' ' || (cp >= '\t' && cp <= '\r');
+        switch (cp) {
+        case 0x85: case 0xA0: case 0x1680:
+        case 0x2028: case 0x2029: case 0x202F: case 0x205F: case 0x3000:
+            return true;
+        default:
+            return (cp >= 0x2000 && cp <= 0x200A);
+        }
+    }
+
+    ///
+    /// Trims trailing whitespace (isSpace) going backwards
+    /// Bad data is not space
+    /// @return  new end
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    It trimRight(It beg, It end)
+    {
+        using Mh = handler::Moji<It>;
+        while (end != beg) {
+            auto p = end;
+            if (!isSpace(getBack<It, Enc, Mh>(beg, p)))
+                break;
+            end = p;
+        }
+        return end;
+    }
+
+    /// @overload  for container
+    template <class From,
+              class Enc = typename detail::ContUtfTraits<From>::Enc>
+    inline auto trimRight(const From& x)
+    {
+        using It = decltype(std::begin(x));
+        return trimRight<It, Enc>(std::begin(x), std::end(x));
+    }
+
+    ///
+    /// Side index for random access to UTF-8/16 by code point:
+    /// offset of every CPINDEX_STEP’th code point, built by one pass
+    /// Code points start at all units except continuation ones
+    /// (UTF-8 10xx.xxxx, UTF-16 trailing surrogates), so for bad data
+    /// stray continuation units join the previous code point
+    /// @warning  Keeps string_view, rebuild when data changes
+    ///
+    template <class Ch>
+    class CpIndex
+    {
+    public:
+        static_assert(sizeof(Ch) <= 2, "UTF-32 needs no index");
+        using Sv = std::basic_string_view<Ch>;
+
+        CpIndex() = default;
+        explicit CpIndex(Sv x) : data(x)
+            { nCps = detail::buildCpIndex(x.data(), x.data() + x.length(), offsets); }
+
+        /// Cannot build from temporary string
+        template <class Trait, class Alloc>
+        CpIndex(std::basic_string<Ch, Trait, Alloc>&&) = delete;
+
+        Sv sv() const { return data; }
+        size_t cpCount() const { return nCps; }
+
+        /// @return  offset of code point #iCp in units, length if iCp ≥ cpCount
+        size_t unitOfCp(size_t iCp) const;
+
+        /// @return  # of code point that unit #iUnit belongs to,
+        ///          cpCount if iUnit ≥ length
+        size_t cpOfUnit(size_t iUnit) const;
+    private:
+        Sv data;
+        std::vector<size_t> offsets;
+        size_t nCps = 0;
+    };
+
+    template <class Ch>
+    size_t CpIndex<Ch>::unitOfCp(size_t iCp) const
+    {
+        if (iCp >= nCps)
+            return data.length();
+        auto offset = offsets[iCp / CPINDEX_STEP];
+        size_t n = iCp % CPINDEX_STEP;
+        if (n == 0)
+            return offset;
+        auto beg = data.data();
+        return detail::skipStarts(beg + offset + 1, beg + data.length(), n) - beg;
+    }
+
+    template <class Ch>
+    size_t CpIndex<Ch>::cpOfUnit(size_t iUnit) const
+    {
+        if (iUnit >= data.length())
+            return nCps;
+        size_t iEntry = std::upper_bound(offsets.begin(), offsets.end(), iUnit)
+                      - offsets.begin() - 1;
+        auto beg = data.data();
+        return iEntry * CPINDEX_STEP
+             + detail::countStarts(beg + offsets[iEntry] + 1, beg + iUnit + 1);
+    }
+
+    ///
+    /// Finds end of extended grapheme cluster (user-perceived character)
+    /// that starts at beg
+    /// Bad data is treated as mojibake (U+FFFD)
+    /// @return  end of cluster; == beg only if beg == end
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline It nextGrapheme(It beg, It end)
+        { return detail::nextGrapheme<It, Enc>(beg, end); }
+
+    /// Counts extended grapheme clusters in [beg, end)
+    /// @warning  Unlike countCps, every bad CP counts as mojibake
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    size_t countGraphemes(It beg, It end)
+    {
+        size_t r = 0;
+        for (; beg != end; ++r)
+            beg = detail::nextGrapheme<It, Enc>(beg, end);
+        return r;
+    }
+
+    /// Counts extended grapheme clusters in x
+    /// @warning  Unlike countCps, every bad CP counts as mojibake
+    template <class From,
+              class Enc = typename detail::ContUtfTraits<From>::Enc>
+    inline size_t countGraphemes(const From& x)
+    {
+        using It = decltype(std::begin(x));
+        return countGraphemes<It, Enc>(std::begin(x), std::end(x));
+    }
+
+    ///
+    /// Break iterator over extended grapheme clusters
+    ///   for (GraphemeIterator it(s.begin(), s.end()); !it.isEnd(); ++it)
+    ///       doSmth(it.clusterBeg(), it.clusterEnd());
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc>
+    class GraphemeIterator
+    {
+    public:
+        GraphemeIterator(It aBeg, It aEnd)
+            : curr(aBeg), next(detail::nextGrapheme<It, Enc>(aBeg, aEnd)), end(aEnd) {}
+
+        /// @return [+] no more clusters, clusterBeg == clusterEnd
+        bool isEnd() const { return curr == end; }
+        It clusterBeg() const { return curr; }
+        It clusterEnd() const { return next; }
+
+        GraphemeIterator& operator ++ ()
+        {
+            curr = next;
+            next = detail::nextGrapheme<It, Enc>(next, end);
+            return *this;
+        }
+    private:
+        It curr, next, end;
+    };
+
+    ///
+    /// Terminal width of code point, a replacement for POSIX wcwidth
+    /// @return  0 = combining, format, control (wcwidth says −1 for controls),
+    ///              Hangul medial vowels and final consonants
+    ///          2 = East Asian wide and fullwidth, incl. most emoji
+    ///          1 = the rest, incl. East Asian ambiguous
+    ///
+    inline int cpWidth(char32_t cp) { return detail::widthOf(cp); }
+
+    /// @return  terminal width of [beg, end), sum of cpWidth’s
+    ///          Bad data is mojibake, 1 column
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline size_t displayWidth(It beg, It end)
+        { return detail::displayWidth<It, Enc>(beg, end); }
+
+    /// @return  terminal width of x, sum of cpWidth’s
+    ///          Bad data is mojibake, 1 column
+    template <class From,
+              class Enc = typename detail::ContUtfTraits<From>::Enc>
+    inline size_t displayWidth(const From& x)
+    {
+        using It = decltype(std::begin(x));
+        return detail::displayWidth<It, Enc>(std::begin(x), std::end(x));
+    }
+
+    ///
+    /// Truncates [beg, end) to maxWidth columns
+    /// Zero-width characters right after the cut (e.g. combining marks)
+    /// are kept
+    /// @return  end of longest prefix not wider than maxWidth
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline It truncateWidth(It beg, It end, size_t maxWidth)
+        { return detail::truncateWidth<It, Enc>(beg, end, maxWidth); }
+
+    /// @overload  for container
+    template <class From,
+              class Enc = typename detail::ContUtfTraits<From>::Enc>
+    inline auto truncateWidth(const From& x, size_t maxWidth)
+    {
+        using It = decltype(std::begin(x));
+        return detail::truncateWidth<It, Enc>(std::begin(x), std::end(x), maxWidth);
+    }
+
+    ///
+    /// Truncates [beg, end) to maxUnits code units w/o decoding the prefix:
+    /// looks back 3 units at most for good UTF-8, 1 for UTF-16;
+    /// Bound::GRAPHEME goes back further to start of grapheme cluster
+    /// @return  end of longest prefix of ≤ maxUnits units that does not split
+    ///          code point (grapheme cluster)
+    ///
+    template <Bound bound = Bound::CODE_POINT, class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    It truncateToUnits(It beg, It end, size_t maxUnits)
+    {
+        static_assert(std::random_access_iterator<It>, "Need random-access data");
+        if (static_cast<size_t>(end - beg) <= maxUnits)
+            return end;
+        auto p = detail::ItEnc<It, Enc>::startOf(beg, beg + maxUnits);
+        if constexpr (bound == Bound::GRAPHEME) {
+            while (p != beg && !detail::isGraphemeBreak<It, Enc>(beg, p, end))
+                p = detail::ItEnc<It, Enc>::prevStart(beg, p);
+        }
+        return p;
+    }
+
+    /// @overload  for container
+    template <Bound bound = Bound::CODE_POINT, class From,
+              class Enc = typename detail::ContUtfTraits<From>::Enc>
+    inline auto truncateToUnits(const From& x, size_t maxUnits)
+    {
+        using It = decltype(std::begin(x));
+        return truncateToUnits<bound, It, Enc>(std::begin(x), std::end(x), maxUnits);
+    }
+
+    ///
+    /// Normalization quick check (UAX 15)
+    /// @return  YES/NO/MAYBE; badly-encoded data → NO
+    ///
+    template <Nf nf, class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline Qc quickCheck(It beg, It end)
+        { return detail::quickCheck<nf, It, Enc>(beg, end); }
+
+    template <Nf nf, class Cont,
+              class Enc = typename detail::ContUtfTraits<Cont>::Enc>
+    inline Qc quickCheck(const Cont& x)
+    {
+        using It = decltype(std::begin(x));
+        return detail::quickCheck<nf, It, Enc>(std::begin(x), std::end(x));
+    }
+
+    ///
+    /// Normalizes data, REACTING APPROPRIATELY TO MOJIBAKE
+    /// Always decodes, even if data is normalized already
+    ///
+    template <Nf nf, class It1, class It2,
+              class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
+              class Enc2 = typename detail::ItUtfTraits<It2>::Enc,
+              class Mjh,
+              class = std::void_t<typename std::iterator_traits<It1>::value_type>,
+              class = std::void_t<typename std::iterator_traits<It2>::value_type>>
+    inline It2 normalize(It1 beg, It1 end, It2 dest, const Mjh& onMojibake = Mjh{})
+    {
+        return detail::normalize<nf, It1, It2, Enc1, Enc2, Mjh>(beg, end, dest, onMojibake);
+    }
+
+    ///
+    /// Normalizes container to another container
+    ///
+    template <Nf nf, class To, class From, class Mjh,
+              class Enc2 = typename detail::ContUtfTraits<To>::Enc,
+              class Enc1 = typename detail::ContUtfTraits<From>::Enc>
+    To normalize(const From& from, const Mjh& onMojibake = Mjh{})
+    {
+        To r;
+        std::back_insert_iterator it(r);
+        using It1 = decltype(std::begin(from));
+        using It2 = decltype(it);
+        detail::normalize<nf, It1, It2, Enc1, Enc2, Mjh>(
+                std::begin(from), std::end(from), it, onMojibake);
+        return r;
+    }
+
+    ///
+    /// Same, mojibake quietly displayed
+    ///
+    template <Nf nf, class To, class From,
+              class Enc2 = typename detail::ContUtfTraits<To>::Enc,
+              class Enc1 = typename detail::ContUtfTraits<From>::Enc>
+    inline To normalizeM(const From& from)
+    {
+        using It = decltype(std::begin(from));
+        using Mo = mojibake::handler::Moji<It>;
+        return normalize<nf, To, From, Mo, Enc2, Enc1>(from);
+    }
+
+    ///
+    /// @return [+] x is well-formed and normalized
+    ///
+    template <Nf nf, class Cont,
+              class Enc = typename detail::ContUtfTraits<Cont>::Enc>
+    bool isNormalized(const Cont& x)
+    {
+        switch (quickCheck<nf, Cont, Enc>(x)) {
+        case Qc::YES: return true;
+        case Qc::NO:  return false;
+        case Qc::MAYBE: break;
+        }
+        // MAYBE → data is well-formed
+        using It = decltype(std::begin(x));
+        using Sk = mojibake::handler::Skip<It>;
+        auto normal = normalize<nf, std::u32string, Cont, Sk, Utf32, Enc>(x);
+        return (normal == toS<std::u32string, Cont, Utf32, Enc>(x));
+    }
+
+    ///
+    /// Guesses encoding of bytes [beg, end): BOM → UTF-16/32 by zero bytes →
+    /// UTF-8 validity → single-byte code pages by frequency of letters.
+    /// Looks at maxLength bytes at most.
+    /// @warning  UTF-16 w/o BOM is found by spaces and ASCII,
+    ///           and text w/o them (e.g. Chinese) is not recognized
+    ///
+    template <class It,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline Detected detect(It beg, It end, size_t maxLength = DETECT_PREFIX)
+    {
+        static_assert(std::contiguous_iterator<It> && sizeof(*beg) == 1,
+                      "Need contiguous buffer of bytes");
+        auto n = std::min<size_t>(end - beg, maxLength);
+        return detail::detect(
+                reinterpret_cast<const unsigned char*>(std::to_address(beg)), n);
+    }
+
+    ///
+    /// @overload  whole container
+    ///
+    template <class Cont>
+    inline Detected detect(const Cont& x, size_t maxLength = DETECT_PREFIX)
+        { return detect(std::begin(x), std::end(x), maxLength); }
+
+    ///
+    /// Hashes code points of [beg, end), wyhash-like, not cryptographic:
+    /// the same text in UTF-8, UTF-16 and UTF-32 gets the same hash.
+    /// Blocks of ASCII are hashed w/o decoding, with the same result.
+    /// Bad data is what onMojibake returns (U+FFFD by default)
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class Mjh = handler::Moji<It>,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline uint64_t hashCps(It beg, It end, const Mjh& onMojibake = Mjh{})
+        { return detail::hashCps<It, Enc, Mjh>(beg, end, onMojibake); }
+
+    /// @overload  for container
+    template <class Cont,
+              class Enc = typename detail::ContUtfTraits<Cont>::Enc,
+              class Mjh = handler::Moji<decltype(std::begin(std::declval<const Cont&>()))>>
+    inline uint64_t hashCps(const Cont& x, const Mjh& onMojibake = Mjh{})
+    {
+        using It = decltype(std::begin(x));
+        return detail::hashCps<It, Enc, Mjh>(std::begin(x), std::end(x), onMojibake);
+    }
+
+    /// Implementation for const char*
+    template <class Ch,
+              class Enc = typename detail::UtfTraits<Ch>::Enc,   // Also a SFINAE
+              class Mjh = handler::Moji<const Ch*>>
+    inline uint64_t hashCps(const Ch* x, const Mjh& onMojibake = Mjh{})
+    {
+        std::basic_string_view<Ch> x1 { x };
+        return detail::hashCps<const Ch*, Enc, Mjh>(x1.data(), x1.data() + x1.length(), onMojibake);
+    }
+
+    ///
+    /// Compares two strings, maybe of different encodings, by code points
+    /// (that’s UTF-8 byte order, but not UTF-16 unit order) w/o transcoding:
+    /// common ASCII prefix is skipped by SIMD, then code points are decoded
+    /// Bad data is U+FFFD
+    ///
+    template <class It1, class It2,
+              class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
+              class Enc2 = typename detail::ItUtfTraits<It2>::Enc,
+              class = std::void_t<typename std::iterator_traits<It1>::value_type>,
+              class = std::void_t<typename std::iterator_traits<It2>::value_type>>
+    inline std::strong_ordering compare(It1 beg1, It1 end1, It2 beg2, It2 end2)
+        { return detail::compare<It1, Enc1, It2, Enc2>(beg1, end1, beg2, end2); }
+
+    /// @overload  for containers
+    template <class Cont1, class Cont2,
+              class Enc1 = typename detail::ContUtfTraits<Cont1>::Enc,
+              class Enc2 = typename detail::ContUtfTraits<Cont2>::Enc>
+    inline std::strong_ordering compare(const Cont1& a, const Cont2& b)
+    {
+        using It1 = decltype(std::begin(a));
+        using It2 = decltype(std::begin(b));
+        return detail::compare<It1, Enc1, It2, Enc2>(
+                std::begin(a), std::end(a), std::begin(b), std::end(b));
+    }
+
+    ///
+    /// @return [+] two strings, maybe of different encodings, have the same
+    ///             code points; bad data is U+FFFD
+    ///
+    template <class It1, class It2,
+              class Enc1 = typename detail::ItUtfTraits<It1>::Enc,
+              class Enc2 = typename detail::ItUtfTraits<It2>::Enc,
+              class = std::void_t<typename std::iterator_traits<It1>::value_type>,
+              class = std::void_t<typename std::iterator_traits<It2>::value_type>>
+    inline bool equal(It1 beg1, It1 end1, It2 beg2, It2 end2)
+        { return detail::compare<It1, Enc1, It2, Enc2>(beg1, end1, beg2, end2) == 0; }
+
+    /// @overload  for containers
+    template <class Cont1, class Cont2,
+              class Enc1 = typename detail::ContUtfTraits<Cont1>::Enc,
+              class Enc2 = typename detail::ContUtfTraits<Cont2>::Enc>
+    inline bool equal(const Cont1& a, const Cont2& b)
+        { return compare<Cont1, Cont2, Enc1, Enc2>(a, b) == 0; }
+
+    ///
+    /// Finds 1st non-ASCII unit (≥ 80) by SIMD, for any unit width,
+    /// so that ASCII prefix may be copied as is, and only the rest decoded.
+    /// In UTF-8/16/32 and code pages ASCII units are ASCII chars
+    /// @return  its index, or length if all units are ASCII
+    ///
+    template <class It,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline size_t firstNonAscii(It beg, It end)
+        { return detail::firstNonAscii(beg, end); }
+
+    /// @overload  for container
+    template <class Cont>
+    inline size_t firstNonAscii(const Cont& x)
+        { return detail::firstNonAscii(std::begin(x), std::end(x)); }
+
+    /// Implementation for const char*
+    template <class Ch,
+              class = typename detail::UtfTraits<Ch>::Enc>   // Also a SFINAE
+    inline size_t firstNonAscii(const Ch* x)
+    {
+        std::basic_string_view<Ch> x1 { x };
+        return detail::firstNonAscii(x1.data(), x1.data() + x1.length());
+    }
+
+    /// @return [+] all units are ASCII, e.g. UTF-8 → UTF-16 is mere widening
+    template <class It,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline bool isAscii(It beg, It end)
+        { return detail::firstNonAscii(beg, end) == static_cast<size_t>(std::distance(beg, end)); }
+
+    /// @overload  for container
+    template <class Cont>
+    inline bool isAscii(const Cont& x)
+        { return firstNonAscii(x) == std::size(x); }
+
+    /// Implementation for const char*
+    template <class Ch,
+              class = typename detail::UtfTraits<Ch>::Enc>   // Also a SFINAE
+    inline bool isAscii(const Ch* x)
+    {
+        std::basic_string_view<Ch> x1 { x };
+        return firstNonAscii(x1) == x1.length();
+    }
+
+    ///
+    /// Checks whether data converts to Latin-1 w/o loss, e.g. to store
+    /// it in one byte per code point. UTF-16/32 is checked by SIMD
+    /// @return [+] every code point is U+0000…00FF
+    ///         [-] some is not, or data is bad
+    ///
+    template <class It,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    inline bool fitsLatin1(It beg, It end)
+        { return detail::fitsLatin1<It, Enc>(beg, end); }
+
+    /// @overload  for container
+    template <class Cont,
+              class Enc = typename detail::ContUtfTraits<Cont>::Enc>
+    inline bool fitsLatin1(const Cont& x)
+    {
+        using It = decltype(std::begin(x));
+        return detail::fitsLatin1<It, Enc>(std::begin(x), std::end(x));
+    }
+
+    /// Implementation for const char*
+    template <class Ch,
+              class Enc = typename detail::UtfTraits<Ch>::Enc>   // Also a SFINAE
+    inline bool fitsLatin1(const Ch* x)
+    {
+        std::basic_string_view<Ch> x1 { x };
+        return detail::fitsLatin1<const Ch*, Enc>(x1.data(), x1.data() + x1.length());
     }
 
     ///
@@ -691,7 +1601,8 @@ namespace mojibake {
         LimitedIterator it(beg, end);
         using It1 = decltype(std::begin(from));
         using It2 = decltype(it);
-        return copy<Enc1, Enc2, Mjh, It1, It2>(std::begin(from), std::end(from), it, onMojibake).curr;
+        return detail::copyLimited<It1, It2, Enc1, Enc2, Mjh>(
+                std::begin(from), std::end(from), it, onMojibake).curr;
     }
 
     ///
@@ -705,7 +1616,8 @@ namespace mojibake {
         LimitedIterator it(beg, size);
         using It1 = decltype(std::begin(from));
         using It2 = decltype(it);
-        return copy<Enc1, Enc2, Mjh, It1, It2>(std::begin(from), std::end(from), it, onMojibake).curr;
+        return detail::copyLimited<It1, It2, Enc1, Enc2, Mjh>(
+                std::begin(from), std::end(from), it, onMojibake).curr;
     }
 
     ///
@@ -765,24 +1677,96 @@ namespace mojibake {
         return copyLim<Mjh, From, ItTo, Enc1, Enc2>(from, beg, size);
     }
 
+    ///
+    /// Transcodes data in its own buffer, as long as result fits there.
+    /// Result goes to the start of buffer as units of Enc2, possibly
+    /// narrower than Ch1 (e.g. UTF-32 → UTF-16).
+    /// Length pre-pass finds out whether result fits, and whether writing
+    /// ever outruns reading; if so, source is copied away first.
+    /// @warning  onMojibake gets places in data, which may be overwritten
+    /// @return [+] # of Enc2 units [-] INPLACE_NO_ROOM, data is intact
+    ///
+    template <class Enc2, class Ch1,
+              class Mjh = handler::Moji<const Ch1*>,
+              class Enc1 = typename detail::UtfTraits<Ch1>::Enc>
+    inline size_t transcodeInPlace(Ch1* data, size_t length, const Mjh& onMojibake = Mjh{})
+        { return detail::transcodeInPlace<Enc1, Enc2, Ch1, Mjh>(data, length, onMojibake); }
+
+    ///
+    /// @overload  for contiguous container of Enc2 units’ size:
+    ///            resizes it; if result does not fit, transcodes to new one
+    /// @return  new length
+    ///
+    template <class Enc2, class Cont,
+              class Mjh = handler::Moji<const typename Cont::value_type*>,
+              class Enc1 = typename detail::ContUtfTraits<Cont>::Enc>
+    size_t transcodeInPlace(Cont& x, const Mjh& onMojibake = Mjh{})
+    {
+        using Ch1 = typename Cont::value_type;
+        static_assert(sizeof(Ch1) == sizeof(typename Enc2::Ch), "Container cannot hold Enc2");
+        auto n = detail::transcodeInPlace<Enc1, Enc2, Ch1, Mjh>(x.data(), x.size(), onMojibake);
+        if (n != INPLACE_NO_ROOM) {
+            x.resize(n);
+        } else {
+            Cont y;
+            copy<const Ch1*, std::back_insert_iterator<Cont>, Enc1, Enc2, Mjh>(
+                    x.data(), x.data() + x.size(), std::back_inserter(y), onMojibake);
+            x = std::move(y);
+        }
+        return x.size();
+    }
+
     template <class T>
     using EquivChar = typename detail::LenTraits<sizeof(T)>::EquivChar;
 } // namespace mojibake
 
 #include "internal/detail2.hpp"
+#include "internal/caseless.hpp"
 
 namespace mojibake {
+    ///
+    /// Finds needle in [beg, end) case-insensitively, by simple case fold,
+    /// w/o folding the whole haystack: needle is folded once, and haystack
+    /// on the fly; ASCII units that cannot start a match are skipped by SIMD.
+    /// Bad data is skipped, just like simpleCaseFold does
+    /// @return  range found, {end, end} if none; {beg, beg} for empty needle
+    ///
+    template <class It, class Needle,
+              class Enc = typename detail::ItUtfTraits<It>::Enc,
+              class EncN = typename detail::ContUtfTraits<Needle>::Enc,
+              class = std::void_t<typename std::iterator_traits<It>::value_type>>
+    std::ranges::subrange<It> findCaseless(It beg, It end, const Needle& needle)
+    {
+        auto folded = simpleCaseFold<std::u32string, Needle, Utf32, EncN>(needle);
+        return detail::findCaseless<It, Enc>(beg, end, folded);
+    }
+
+    /// @overload  for container
+    template <class Haystack, class Needle,
+              class Enc = typename detail::ContUtfTraits<Haystack>::Enc,
+              class EncN = typename detail::ContUtfTraits<Needle>::Enc>
+    inline auto findCaseless(const Haystack& haystack, const Needle& needle)
+    {
+        using It = decltype(std::begin(haystack));
+        return findCaseless<It, Needle, Enc, EncN>(std::begin(haystack), std::end(haystack), needle);
+    }
+
     ///
     /// Class that converts constant string to new encoding:
     /// either small string_view, or a full string
     /// @warning  Uses quick-and-dirty conversion method,
     ///           use for reliable or low-importance strings
+    /// @tparam  Enc2, Enc1  encodings, e.g. ConvString<char, char, Utf8, Cp1251>
     ///
-    template <typename ToC, typename FromC>
+    template <typename ToC, typename FromC,
+              class Enc2 = typename detail::UtfTraits<EquivChar<ToC>>::Enc,
+              class Enc1 = typename detail::UtfTraits<FromC>::Enc>
     class ConvString :
-            protected detail::ConvStringProto<EquivChar<ToC>, FromC, detail::isAliasable<ToC, FromC>()>
+            protected detail::ConvStringProto<EquivChar<ToC>, FromC, Enc2, Enc1,
+                    detail::isAliasable<ToC, FromC>() && std::is_same_v<Enc1, Enc2>>
     {
-        using Super = detail::ConvStringProto<EquivChar<ToC>, FromC, detail::isAliasable<ToC, FromC>()>;
+        using Super = detail::ConvStringProto<EquivChar<ToC>, FromC, Enc2, Enc1,
+                    detail::isAliasable<ToC, FromC>() && std::is_same_v<Enc1, Enc2>>;
     public:
         using FromSv = std::basic_string_view<FromC>;
         using ToSv = std::basic_string_view<ToC>;
@@ -820,6 +1804,467 @@ namespace mojibake {
         static constexpr bool isStringView() { return !isConverted(); }
     };
 
+    ///
+    /// Class that normalizes constant string:
+    /// keeps string_view when it is normalized already (quick check = YES,
+    /// or MAYBE but normalization changed nothing), otherwise a full string
+    ///
+    template <Nf nf, typename Ch>
+    class NormString
+    {
+    public:
+        using Sv = std::basic_string_view<Ch>;
+        using Str = std::basic_string<Ch>;
+
+        /// Bad data is written as mojibake (U+FFFD)
+        NormString(Sv x) : NormString(x, handler::Moji<typename Sv::const_iterator>{}) {}
+
+        template <class Mjh>
+        NormString(Sv x, const Mjh& onMojibake) : view(x)
+        {
+            auto qc = quickCheck<nf>(x);
+            if (qc == Qc::YES)
+                return;
+            tmp = normalize<nf, Str, Sv, Mjh>(x, onMojibake);
+            if (qc == Qc::MAYBE && tmp == x) {
+                tmp = Str{};
+                return;
+            }
+            isConv = true;
+        }
+
+        /// Cannot build from temporary string
+        template <class Trait, class Alloc>
+        NormString(std::basic_string<Ch, Trait, Alloc>&&) = delete;
+
+        Sv sv() const { return isConv ? Sv{tmp} : view; }
+        operator Sv() const { return sv(); }
+        const Ch* data() const { return sv().data(); }
+        size_t length() const { return sv().length(); }
+        size_t size() const { return sv().length(); }
+
+        /// @return [+] is converted [-] is simple string view
+        bool isConverted() const { return isConv; }
+    private:
+        Sv view;
+        Str tmp;
+        bool isConv = false;
+    };
+
+    ///
+    /// Stream buffer that transcodes another one by blocks:
+    /// reading takes Enc1 from under and gives Enc2,
+    /// writing takes Enc1 and puts Enc2 to under.
+    /// Code point cut by end of block waits for the next one.
+    /// Both encodings are byte-based: Utf8, Utf16LE, CodePage<…>…
+    /// @warning  Incomplete code point at the end is written by finish()
+    ///           or destructor; flush() leaves it for further writes
+    ///
+    template <class Enc1, class Enc2, class Mjh = handler::Moji<const char*>>
+    class TranscodingStreambuf : public std::streambuf
+    {
+    public:
+        explicit TranscodingStreambuf(std::streambuf* aUnder, const Mjh& aOnMojibake = Mjh{})
+            : under(aUnder), onMojibake(aOnMojibake) {}
+        ~TranscodingStreambuf() override { finish(); }
+
+        /// Writes everything incl. incomplete code point (that’s bad data)
+        /// @return [+] OK
+        bool finish();
+    protected:
+        int_type underflow() override;
+        int_type overflow(int_type c) override;
+        int sync() override;
+    private:
+        std::streambuf* under;
+        Mjh onMojibake;
+        std::vector<char> getRaw, getBuf, putRaw, putBuf;
+        size_t nGetCarry = 0;
+        bool isGetHalted = false, isPutHalted = false;
+
+        /// @return [+] OK
+        bool writeOut(bool isLast);
+    };
+
+    template <class Enc1, class Enc2, class Mjh>
+    auto TranscodingStreambuf<Enc1, Enc2, Mjh>::underflow() -> int_type
+    {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+        if (getRaw.empty())
+            getRaw.resize(STREAM_BLOCK);
+        while (!isGetHalted) {
+            auto n = under->sgetn(getRaw.data() + nGetCarry, getRaw.size() - nGetCarry);
+            auto len = nGetCarry + static_cast<size_t>(n);
+            if (len == 0)
+                break;
+            getBuf.resize(len * detail::STREAM_RATIO<Enc2>);
+            auto r = detail::transcodeBlock<Enc1, Enc2, Mjh>(
+                        getRaw.data(), getRaw.data() + len, n == 0, getBuf.data(), onMojibake);
+            isGetHalted = r.isHalted;
+            nGetCarry = getRaw.data() + len - r.used;
+            std::memmove(getRaw.data(), r.used, nGetCarry);
+            if (r.destEnd != getBuf.data()) {
+                setg(getBuf.data(), getBuf.data(), r.destEnd);
+                return traits_type::to_int_type(*gptr());
+            }
+        }
+        return traits_type::eof();
+    }
+
+    template <class Enc1, class Enc2, class Mjh>
+    bool TranscodingStreambuf<Enc1, Enc2, Mjh>::writeOut(bool isLast)
+    {
+        if (isPutHalted)
+            return false;
+        putBuf.resize((pptr() - pbase()) * detail::STREAM_RATIO<Enc2>);
+        auto r = detail::transcodeBlock<Enc1, Enc2, Mjh>(
+                    pbase(), pptr(), isLast, putBuf.data(), onMojibake);
+        auto n = r.destEnd - putBuf.data();
+        if (under->sputn(putBuf.data(), n) != n)
+            return false;
+        if (r.isHalted) {
+            isPutHalted = true;
+            return false;
+        }
+        auto nCarry = pptr() - r.used;
+        std::memmove(putRaw.data(), r.used, nCarry);
+        setp(putRaw.data(), putRaw.data() + putRaw.size());
+        pbump(static_cast<int>(nCarry));
+        return true;
+    }
+
+    template <class Enc1, class Enc2, class Mjh>
+    auto TranscodingStreambuf<Enc1, Enc2, Mjh>::overflow(int_type c) -> int_type
+    {
+        if (putRaw.empty()) {
+            putRaw.resize(STREAM_BLOCK);
+            setp(putRaw.data(), putRaw.data() + putRaw.size());
+        } else if (!writeOut(false)) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    template <class Enc1, class Enc2, class Mjh>
+    int TranscodingStreambuf<Enc1, Enc2, Mjh>::sync()
+    {
+        if (pbase() != nullptr && !writeOut(false))
+            return -1;
+        return under->pubsync();
+    }
+
+    template <class Enc1, class Enc2, class Mjh>
+    bool TranscodingStreambuf<Enc1, Enc2, Mjh>::finish()
+    {
+        if (pbase() == nullptr)
+            return true;
+        return writeOut(true) && under->pubsync() == 0;
+    }
+
+    ///
+    /// Stateful decoder of data that comes by pieces: Enc1 is byte-based,
+    /// code point cut between pieces waits for the next one
+    ///
+    template <class Enc1, class Enc2 = Utf32, class Mjh = handler::Moji<const char*>>
+    class StreamDecoder
+    {
+    public:
+        using Ch2 = typename Enc2::Ch;
+
+        explicit StreamDecoder(const Mjh& aOnMojibake = Mjh{}) : onMojibake(aOnMojibake) {}
+
+        ///
+        /// Decodes next piece
+        /// @param [in] isLast  [+] no more data, incomplete code point is bad data
+        /// @return  decoded data, valid until next call
+        ///
+        std::basic_string_view<Ch2> feed(std::string_view data, bool isLast = false);
+
+        /// @return [+] onMojibake halted, further data is ignored
+        bool isHalted() const { return fIsHalted; }
+    private:
+        Mjh onMojibake;
+        std::string carry;
+        std::vector<Ch2> out;
+        bool fIsHalted = false;
+    };
+
+    template <class Enc1, class Enc2, class Mjh>
+    auto StreamDecoder<Enc1, Enc2, Mjh>::feed(std::string_view data, bool isLast)
+            -> std::basic_string_view<Ch2>
+    {
+        if (fIsHalted)
+            return {};
+        out.resize((carry.length() + data.length()) * detail::STREAM_RATIO<Enc2>);
+        auto dest = out.data();
+        if (!carry.empty()) {
+            // Complete code point with a few bytes of data
+            auto nOld = carry.length();
+            auto n = std::min(data.length(), detail::MAX_CP_BYTES<Enc1>);
+            carry.append(data.data(), n);
+            auto r = detail::transcodeBlock<Enc1, Enc2, Mjh>(carry.data(), carry.data() + carry.length(),
+                        isLast && n == data.length(), dest, onMojibake);
+            dest = r.destEnd;
+            fIsHalted = r.isHalted;
+            size_t used = r.used - carry.data();
+            if (used < nOld || fIsHalted) {     // still incomplete, data is used up
+                carry.erase(0, used);
+                return { out.data(), static_cast<size_t>(dest - out.data()) };
+            }
+            carry.clear();
+            data.remove_prefix(used - nOld);
+        }
+        auto r = detail::transcodeBlock<Enc1, Enc2, Mjh>(
+                    data.data(), data.data() + data.length(), isLast, dest, onMojibake);
+        fIsHalted = r.isHalted;
+        carry.assign(r.used, data.data() + data.length());
+        return { out.data(), static_cast<size_t>(r.destEnd - out.data()) };
+    }
+
+    ///
+    /// Decodes async byte source by C++20 coroutines w/o blocking threads:
+    /// awaits source.next() for next piece (convertible to string_view,
+    /// empty at the end) and yields chunks of Enc2 units
+    ///   auto chunks = decodeAsync<Utf8>(source);
+    ///   while (auto chunk = co_await chunks.next()) { … }
+    /// @warning  Chunk is valid until next co_await; source should outlive generator
+    ///
+    template <class Enc1, class Enc2 = Utf32, class Mjh = handler::Moji<const char*>, class Source>
+    detail::AsyncGenerator<std::basic_string_view<typename Enc2::Ch>>
+        decodeAsync(Source& source, Mjh onMojibake = Mjh{})
+    {
+        StreamDecoder<Enc1, Enc2, Mjh> decoder(onMojibake);
+        while (true) {
+            std::string_view piece = co_await source.next();
+            auto chunk = decoder.feed(piece, piece.empty());
+            if (!chunk.empty())
+                co_yield chunk;
+            if (piece.empty() || decoder.isHalted())
+                co_return;
+        }
+    }
+
+#ifdef MJ_POSIX
+    ///
+    /// Pull-based transcoding reader of POSIX file descriptor:
+    /// file, pipe, socket; Enc1 → Enc2, both byte-based.
+    /// Code point cut by read() waits for the next one
+    ///
+    template <class Enc1, class Enc2, class Mjh = handler::Moji<const char*>>
+    class FdReader
+    {
+    public:
+        static constexpr size_t BUF_SIZE = STREAM_BLOCK * 16;
+
+        explicit FdReader(int aFd, const Mjh& aOnMojibake = Mjh{})
+            : fd(aFd), onMojibake(aOnMojibake),
+              raw(BUF_SIZE), out(BUF_SIZE * detail::STREAM_RATIO<Enc2>) {}
+
+        ///
+        /// Reads what fd has, up to BUF_SIZE, and transcodes it
+        /// @return  transcoded data, valid until next call;
+        ///          empty at EOF or on error
+        ///
+        std::string_view next();
+
+        bool isEof() const { return isEnd && err == 0; }
+        /// @return  errno of failed read, 0 if none
+        int error() const { return err; }
+    private:
+        int fd;
+        Mjh onMojibake;
+        detail::AlignedBuffer raw, out;
+        size_t nCarry = 0;
+        bool isEnd = false;
+        int err = 0;
+    };
+
+    template <class Enc1, class Enc2, class Mjh>
+    std::string_view FdReader<Enc1, Enc2, Mjh>::next()
+    {
+        while (!isEnd) {
+            auto n = detail::readSome(fd, raw.data() + nCarry, raw.size() - nCarry);
+            if (n < 0) {
+                err = errno;
+                isEnd = true;
+                break;
+            }
+            auto len = nCarry + static_cast<size_t>(n);
+            auto r = detail::transcodeBlock<Enc1, Enc2, Mjh>(
+                        raw.data(), raw.data() + len, n == 0, out.data(), onMojibake);
+            nCarry = raw.data() + len - r.used;
+            std::memmove(raw.data(), r.used, nCarry);
+            isEnd = (n == 0 || r.isHalted);
+            if (r.destEnd != out.data())
+                return { out.data(), static_cast<size_t>(r.destEnd - out.data()) };
+        }
+        return {};
+    }
+
+    ///
+    /// Transcoding writer to POSIX file descriptor: Enc1 → Enc2, both
+    /// byte-based. Output goes by BATCH blocks in one writev()
+    /// @warning  Incomplete code point at the end is written by finish()
+    ///           or destructor; flush() leaves it for further writes
+    ///
+    template <class Enc1, class Enc2, class Mjh = handler::Moji<const char*>>
+    class FdWriter
+    {
+    public:
+        static constexpr int BATCH = 8;
+
+        explicit FdWriter(int aFd, const Mjh& aOnMojibake = Mjh{})
+            : fd(aFd), onMojibake(aOnMojibake), raw(STREAM_BLOCK),
+              out(STREAM_BLOCK * detail::STREAM_RATIO<Enc2> * BATCH) {}
+        ~FdWriter() { finish(); }
+
+        /// @return [+] OK [-] error, see error()
+        bool write(std::string_view data);
+        /// Writes everything but incomplete code point at the end
+        bool flush() { return transcode(false) && writeOut(); }
+        /// Writes everything, incomplete code point is bad data
+        bool finish() { return transcode(true) && writeOut(); }
+
+        /// @return  errno of failed write, 0 if none
+        int error() const { return err; }
+    private:
+        int fd;
+        Mjh onMojibake;
+        detail::AlignedBuffer raw, out;
+        iovec iov[BATCH];
+        int nIov = 0;
+        size_t nRaw = 0;
+        bool isHalted = false;
+        int err = 0;
+
+        /// Transcodes raw to next iovec
+        bool transcode(bool isLast);
+        bool writeOut();
+    };
+
+    template <class Enc1, class Enc2, class Mjh>
+    bool FdWriter<Enc1, Enc2, Mjh>::write(std::string_view data)
+    {
+        while (!data.empty()) {
+            auto n = std::min(data.length(), raw.size() - nRaw);
+            std::memcpy(raw.data() + nRaw, data.data(), n);
+            nRaw += n;
+            data.remove_prefix(n);
+            if (nRaw == raw.size() && !transcode(false))
+                return false;
+        }
+        return err == 0 && !isHalted;
+    }
+
+    template <class Enc1, class Enc2, class Mjh>
+    bool FdWriter<Enc1, Enc2, Mjh>::transcode(bool isLast)
+    {
+        if (err != 0 || isHalted)
+            return false;
+        if (nIov == BATCH && !writeOut())
+            return false;
+        auto dest = out.data() + nIov * STREAM_BLOCK * detail::STREAM_RATIO<Enc2>;
+        auto r = detail::transcodeBlock<Enc1, Enc2, Mjh>(
+                    raw.data(), raw.data() + nRaw, isLast, dest, onMojibake);
+        if (r.destEnd != dest)
+            iov[nIov++] = { dest, static_cast<size_t>(r.destEnd - dest) };
+        nRaw = raw.data() + nRaw - r.used;
+        std::memmove(raw.data(), r.used, nRaw);
+        isHalted = r.isHalted;
+        return true;
+    }
+
+    template <class Enc1, class Enc2, class Mjh>
+    bool FdWriter<Enc1, Enc2, Mjh>::writeOut()
+    {
+        if (err != 0)
+            return false;
+        if (!detail::writeAll(fd, iov, nIov)) {
+            err = errno;
+            return false;
+        }
+        nIov = 0;
+        return !isHalted;
+    }
+
+    ///
+    /// Transcodes file fdIn to fdOut, Enc1 → Enc2, both byte-based.
+    /// Regular file goes by large blocks: nThreads workers (0 = # of cores)
+    /// read them in parallel, so that several reads are in flight,
+    /// and transcode them; results are written in order.
+    /// Pipes, sockets… are transcoded serially
+    /// @warning  onMojibake is called from several threads
+    /// @return [+] OK [-] error in errno, or onMojibake halted
+    ///
+    template <class Enc1, class Enc2, class Mjh = handler::Moji<const char*>>
+    inline bool transcodeFile(int fdIn, int fdOut, unsigned nThreads = 0,
+                              const Mjh& onMojibake = Mjh{})
+    {
+        return detail::transcodeFile<Enc1, Enc2, Mjh>(
+                    fdIn, fdOut, nThreads, STREAM_BLOCK * 16, onMojibake);
+    }
+#endif
+
+#ifdef MJ_PROFILE
+    ///
+    /// Stats of call sites of copy*, to*, isValid, countCps, simpleCaseFold
+    ///   -DMJ_PROFILE … profile::setSink(profile::fileSink("mj.txt"), 10s);
+    /// Nested calls (e.g. to → copy) are recorded to the outer one only
+    ///
+    namespace profile {
+
+        /// @return  stats of all call sites, most costly first
+        inline std::vector<Entry> snapshot()
+            { return detail::profileRegistry().snapshot(); }
+
+        /// Forgets all stats
+        inline void reset() { detail::profileRegistry().reset(); }
+
+        /// Writes stats as a table, one call site per line
+        inline void dump(std::FILE* f, const std::vector<Entry>& entries)
+        {
+            using Ull = unsigned long long;
+            std::fprintf(f, "%14s %10s %12s %12s %12s %10s  %-14s %s\n",
+                         "ticks", "calls", "bytes in", "bytes out", "cps", "mojibake", "op", "site");
+            for (auto& [site, x] : entries) {
+                std::fprintf(f, "%14llu %10llu %12llu %12llu %12llu %10llu  %-14s %s:%u:%u %s\n",
+                             Ull(x.ticks), Ull(x.nCalls), Ull(x.bytesIn), Ull(x.bytesOut),
+                             Ull(x.nCps), Ull(x.nMojibake), site.op, site.file,
+                             unsigned(site.line), unsigned(site.column), site.function);
+            }
+            std::fflush(f);
+        }
+
+        inline void dump(std::FILE* f) { dump(f, snapshot()); }
+
+        ///
+        /// Sets periodic dump: once period passes, the next profiled call
+        /// gives all stats to sink, in the caller’s thread.
+        /// Calls inside sink are not recorded
+        /// @param [in] sink   empty to stop
+        ///
+        inline void setSink(Sink sink, std::chrono::steady_clock::duration period)
+            { detail::profileRegistry().setSink(std::move(sink), period); }
+
+        /// @return  sink that rewrites file with the latest stats
+        inline Sink fileSink(std::string fname)
+        {
+            return [fname = std::move(fname)](const std::vector<Entry>& entries) {
+                if (auto f = std::fopen(fname.c_str(), "w")) {
+                    dump(f, entries);
+                    std::fclose(f);
+                }
+            };
+        }
+
+    }   // namespace profile
+#endif
+
 }   // namespace mojibake
 
 